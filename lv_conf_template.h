@@ -149,6 +149,17 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #endif
 
+    /* Cache the bitmaps of the recently used glyphs in an A8 atlas of
+     * LV_DRAW_SW_GLYPH_ATLAS_SIZE x LV_DRAW_SW_GLYPH_ATLAS_SIZE pixels per draw unit
+     * and blend the glyphs of a text run in one step.
+     * 0: to disable the atlas */
+    #define LV_DRAW_SW_GLYPH_ATLAS_SIZE 0
+
+    /* Cache the coverage masks of the solid filled or stroked vector paths.
+     * Redrawing the same path with other colors or opacity blends only the cached mask.
+     * The size of the cache in bytes. 0: to disable the cache */
+    #define LV_DRAW_SW_VECTOR_CACHE_SIZE 0
+
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
@@ -321,6 +332,17 @@
  *The main logic is like `LV_CACHE_DEF_SIZE` but for image headers.*/
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/*Size of the cache of image bands in bytes.
+ *Large PNG and JPEG files which don't fit into this cache are decoded in horizontal bands while drawing,
+ *so only the visible part of the image needs to be decoded and kept in RAM.
+ *Only the bands of not transformed images are used. If 0, the images are always decoded entirely.*/
+#define LV_IMAGE_BAND_CACHE_DEF_SIZE 0
+
+/*Enable `lv_image_decoder_decode_async()` and `lv_image_cache_prefetch()` to decode images in the background.
+ *With an OS a thread is created for it on the first use.
+ *Requires `LV_CACHE_DEF_SIZE > 0`*/
+#define LV_USE_IMAGE_DECODER_ASYNC 0
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS   2
@@ -332,6 +354,10 @@
 /* Add 2 x 32 bit variables to each lv_obj_t to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/* Find the clicked object with a grid of the clickable objects' areas instead of walking the whole object tree.
+ * Useful with many objects. The grid is rebuilt only when the object tree is unchanged between two presses */
+#define LV_USE_INDEV_HIT_INDEX  0
+
 /* Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -505,6 +531,10 @@
     *`LV_BASE_DIR_RTL` Right-to-Left
     *`LV_BASE_DIR_AUTO` detect texts base direction*/
     #define LV_BIDI_BASE_DIR_DEF LV_BASE_DIR_AUTO
+
+    /*Number of bidi processed lines to cache. The drawn texts are processed only
+     *when they change. 0: disable caching*/
+    #define LV_BIDI_CACHE_CNT 16
 #endif
 
 /*Enable Arabic/Persian processing
@@ -716,6 +746,19 @@
 /*GIF decoder accelerate*/
 #define LV_GIF_CACHE_DECODE_DATA 0
 
+/*Decode the next frame in a background thread while the current one is shown.
+ *Uses an extra buffer of the size of the GIF. Requires LV_USE_OS != LV_OS_NONE*/
+#define LV_GIF_DECODE_ASYNC 0
+
+/*Decode all frames of a GIF in advance and store them in the image cache (LV_CACHE_DEF_SIZE).
+ *Playing the animation only swaps the shown buffer. If the frames don't fit into the cache
+ *they are decoded one by one as normally.*/
+#define LV_GIF_CACHE_FRAMES 0
+#if LV_GIF_CACHE_FRAMES
+    /*Compress the cached frames with LZ4 to fit more of them. Requires LV_USE_LZ4_INTERNAL or LV_USE_LZ4_EXTERNAL*/
+    #define LV_GIF_CACHE_FRAMES_LZ4 0
+#endif
+
 #define LV_USE_CUSTOM_GIF 0
 
 #if LV_USE_CUSTOM_GIF
@@ -752,6 +795,11 @@
     /*Cache count of the glyphs in FreeType. It means the number of glyphs that can be cached.
      *The higher the value, the more memory will be used.*/
     #define LV_FREETYPE_CACHE_FT_GLYPH_CNT 256
+
+    /*Memory used for the rendered glyph bitmaps of all FreeType fonts in bytes.
+     *The bitmaps of every font, size and style share this budget and
+     *the least recently used ones are freed when it's exceeded.*/
+    #define LV_FREETYPE_CACHE_SIZE (64 * 1024)
 #endif
 
 /* Built-in TTF decoder */
@@ -774,6 +822,11 @@
 /* Enable ThorVG by assuming that its installed and linked to the project */
 #define LV_USE_THORVG_EXTERNAL 0
 
+/* Number of worker threads ThorVG prepares and rasterizes the shapes in.
+ * Requires an OS (`LV_USE_OS != LV_OS_NONE`).
+ * 0: prepare the shapes in the thread which draws them */
+#define LV_THORVG_THREAD_CNT 0
+
 /*Use lvgl built-in LZ4 lib*/
 #define LV_USE_LZ4_INTERNAL  0
 
@@ -784,6 +837,11 @@
 #define LV_USE_SVG 0
 #define LV_USE_SVG_ANIMATION 0
 #define LV_USE_SVG_DEBUG 0
+#if LV_USE_SVG
+    /*Number of SVG documents and transformations whose paths are kept by `lv_draw_svg()`
+     *to not parse and build them again on every redraw. 0: disable the cache*/
+    #define LV_SVG_DISPLAY_LIST_CACHE_CNT 8
+#endif
 
 /*FFmpeg library for image decoding and playing videos
  *Supports all major image formats so do not enable other image decoder with it*/
@@ -791,6 +849,10 @@
 #if LV_USE_FFMPEG
     /*Dump input information to stderr*/
     #define LV_FFMPEG_DUMP_FORMAT 0
+
+    /*Decode and convert the frames of the player in a thread into a few buffers.
+     *Requires LV_USE_OS != LV_OS_NONE*/
+    #define LV_FFMPEG_DECODE_ASYNC 0
 #endif
 
 /*==================
@@ -851,6 +913,13 @@
     /*Profiler end point function with custom tag*/
     #define LV_PROFILER_END_TAG   LV_PROFILER_BUILTIN_END_TAG
 
+    /*Profiler counter function, records the value of a counter track*/
+    #if LV_USE_PROFILER_BUILTIN
+        #define LV_PROFILER_COUNTER   LV_PROFILER_BUILTIN_COUNTER
+    #else
+        #define LV_PROFILER_COUNTER(name,value) do { LV_UNUSED(name); LV_UNUSED(value); } while(0)
+    #endif
+
     /*Enable layout profiler*/
     #define LV_PROFILER_LAYOUT 0
 
@@ -880,6 +949,9 @@
 
     /*Enable cache profiler*/
     #define LV_PROFILER_CACHE 0
+
+    /*Enable sysmon profiler*/
+    #define LV_PROFILER_SYSMON 0
 #endif
 
 /*1: Enable Monkey test*/
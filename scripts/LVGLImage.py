@@ -373,30 +373,69 @@ class LVGLCompressData:
     def __init__(self,
                  cf: ColorFormat,
                  method: CompressMethod,
-                 raw_data: bytes = b''):
+                 raw_data: bytes = b'',
+                 stride: int = 0,
+                 block_rows: int = 0):
+        self.cf = cf
         self.blk_size = (cf.bpp + 7) // 8
         self.compress = method
+        self.stride = stride
+        self.block_rows = block_rows
         self.raw_data = raw_data
         self.raw_data_len = len(raw_data)
         self.compressed = self._compress(raw_data)
 
-    def _compress(self, raw_data: bytes) -> bytearray:
-        if self.compress == CompressMethod.NONE:
-            return raw_data
-
+    def _compress_block(self, raw_data: bytes) -> bytes:
         if self.compress == CompressMethod.RLE:
             # RLE compression performs on pixel unit, pad data to pixel unit
-            pad = b'\x00' * (self.blk_size - self.raw_data_len % self.blk_size)
-            compressed = RLEImage().rle_compress(raw_data + pad, self.blk_size)
+            pad = b'\x00' * (self.blk_size - len(raw_data) % self.blk_size)
+            return RLEImage().rle_compress(raw_data + pad, self.blk_size)
         elif self.compress == CompressMethod.LZ4:
-            compressed = lz4.block.compress(raw_data, store_size=False)
+            return lz4.block.compress(raw_data, store_size=False)
         else:
             raise ParameterError(f"Invalid compress method: {self.compress}")
 
+    def _compress_blocks(self, raw_data: bytes) -> bytes:
+        """
+        Compress every `block_rows` rows independently, so that the decoder
+        can decompress only the rows it draws. The blocks are preceded by
+        the offsets of the blocks and the end of the last block.
+        """
+        if self.cf.is_indexed or self.cf == ColorFormat.RGB565A8:
+            raise ParameterError(
+                f"Compressing in blocks is not supported for {self.cf.name}")
+
+        if not 0 < self.block_rows < 0x10000 or self.stride == 0:
+            raise ParameterError(f"Invalid block rows: {self.block_rows}")
+
+        block_len = self.block_rows * self.stride
+        blocks = [
+            self._compress_block(raw_data[i:i + block_len])
+            for i in range(0, self.raw_data_len, block_len)
+        ]
+
+        offsets = bytearray()
+        offset = 0
+        for block in blocks:
+            offsets += uint32_t(offset)
+            offset += len(block)
+        offsets += uint32_t(offset)
+
+        return bytes(offsets) + b"".join(blocks)
+
+    def _compress(self, raw_data: bytes) -> bytearray:
+        if self.compress == CompressMethod.NONE:
+            return raw_data
+
+        if self.block_rows:
+            compressed = self._compress_blocks(raw_data)
+        else:
+            compressed = self._compress_block(raw_data)
+
         self.compressed_len = len(compressed)
 
         bin = bytearray()
-        bin += uint32_t(self.compress.value)
+        bin += uint32_t(self.compress.value | self.block_rows << 4)
         bin += uint32_t(self.compressed_len)
         bin += uint32_t(self.raw_data_len)
         bin += compressed
@@ -565,7 +604,8 @@ class LVGLImage:
 
     def to_bin(self,
                filename: str,
-               compress: CompressMethod = CompressMethod.NONE):
+               compress: CompressMethod = CompressMethod.NONE,
+               blocks: int = 0):
         """
         Write this image to file, filename should be ended with '.bin'
         """
@@ -583,7 +623,8 @@ class LVGLImage:
                                      self.stride,
                                      flags=flags)
             bin += header.binary
-            compressed = LVGLCompressData(self.cf, compress, self.data)
+            compressed = LVGLCompressData(self.cf, compress, self.data,
+                                          self.stride, blocks)
             bin += compressed.compressed
 
             f.write(bin)
@@ -592,7 +633,8 @@ class LVGLImage:
 
     def to_c_array(self,
                    filename: str,
-                   compress: CompressMethod = CompressMethod.NONE):
+                   compress: CompressMethod = CompressMethod.NONE,
+                   blocks: int = 0):
         self._check_ext(filename, ".c")
         self._check_dir(filename)
 
@@ -604,7 +646,8 @@ class LVGLImage:
         if compress is not CompressMethod.NONE:
             flags += " | LV_IMAGE_FLAGS_COMPRESSED"
 
-        compressed = LVGLCompressData(self.cf, compress, self.data)
+        compressed = LVGLCompressData(self.cf, compress, self.data,
+                                      self.stride, blocks)
 
         header = f'''
 #if defined(LV_LVGL_H_INCLUDE_SIMPLE)
@@ -917,6 +960,12 @@ class RLEHeader:
 
 class RLEImage(LVGLImage):
 
+    # Minimal length of the repeated runs for each block size. Every run costs
+    # a control byte and a step of the decoder, so shorter runs give smaller
+    # files but slower decompression. Runs of 2 and 4 bytes blocks are filled
+    # word by word, so they pay off sooner.
+    RLE_THRESHOLD = {1: 16, 2: 8, 3: 16, 4: 4}
+
     def __init__(self,
                  cf: ColorFormat = ColorFormat.UNKNOWN,
                  w: int = 0,
@@ -940,7 +989,10 @@ class RLEImage(LVGLImage):
             f.write(header)
             f.write(compressed)
 
-    def rle_compress(self, data: bytearray, blksize: int, threshold=16):
+    def rle_compress(self, data: bytearray, blksize: int, threshold=None):
+        if threshold is None:
+            threshold = self.RLE_THRESHOLD.get(blksize, 16)
+
         index = 0
         data_len = len(data)
         compressed_data = []
@@ -1038,6 +1090,7 @@ class PNGConverter:
                  background: int = 0x00,
                  align: int = 1,
                  compress: CompressMethod = CompressMethod.NONE,
+                 blocks: int = 0,
                  keep_folder=True) -> None:
         self.files = files
         self.cf = cf
@@ -1047,6 +1100,7 @@ class PNGConverter:
         self.keep_folder = keep_folder
         self.align = align
         self.compress = compress
+        self.blocks = blocks
         self.background = background
 
     def _replace_ext(self, input, ext):
@@ -1066,10 +1120,12 @@ class PNGConverter:
             output.append((f, img))
             if self.ofmt == OutputFormat.BIN_FILE:
                 img.to_bin(self._replace_ext(f, ".bin"),
-                           compress=self.compress)
+                           compress=self.compress,
+                           blocks=self.blocks)
             elif self.ofmt == OutputFormat.C_ARRAY:
                 img.to_c_array(self._replace_ext(f, ".c"),
-                               compress=self.compress)
+                               compress=self.compress,
+                               blocks=self.blocks)
             elif self.ofmt == OutputFormat.PNG_FILE:
                 img.to_png(self._replace_ext(f, ".png"))
 
@@ -1097,6 +1153,15 @@ def main():
                         default="NONE",
                         choices=["NONE", "RLE", "LZ4"])
 
+    parser.add_argument('--blocks',
+                        help=("compress every N rows independently so that "
+                              "large images can be decompressed in parts, "
+                              "default to 0 (compress the image at once)"),
+                        default=0,
+                        type=int,
+                        metavar='rows',
+                        nargs='?')
+
     parser.add_argument('--align',
                         help="stride alignment in bytes for bin image",
                         default=1,
@@ -1146,6 +1211,7 @@ def main():
                              background=args.background,
                              align=args.align,
                              compress=compress,
+                             blocks=args.blocks,
                              keep_folder=False)
     output = converter.convert()
     for f, img in output:
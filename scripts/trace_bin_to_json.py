@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+
+import argparse
+import json
+from pathlib import Path
+
+MAGIC = b'LVPT'
+VERSION = 1
+
+
+def get_arg():
+    parser = argparse.ArgumentParser(
+        description='Convert a binary trace of the LVGL built-in profiler to a Chrome JSON trace file.')
+    parser.add_argument('bin_file', metavar='bin_file', type=str,
+                        help='The binary trace file to process.')
+    parser.add_argument('json_file', metavar='json_file', type=str, nargs='?',
+                        help='The output trace file. If not provided, defaults to \'<bin_file>.json\'.')
+
+    args = parser.parse_args()
+    return args
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def eof(self):
+        return self.pos >= len(self.data)
+
+    def byte(self):
+        b = self.data[self.pos]
+        self.pos += 1
+        return b
+
+    def bytes(self, n):
+        b = self.data[self.pos:self.pos + n]
+        if len(b) != n:
+            raise EOFError()
+        self.pos += n
+        return b
+
+    def varint(self):
+        v = 0
+        shift = 0
+        while True:
+            b = self.byte()
+            v |= (b & 0x7f) << shift
+            if b < 0x80:
+                return v
+            shift += 7
+
+    def zigzag(self):
+        v = self.varint()
+        return (v >> 1) ^ -(v & 1)
+
+
+def convert(data, out):
+    r = Reader(data)
+    strings = {}
+    tick = 0
+    tick_per_sec = 1000
+    first = True
+
+    out.write('{"displayTimeUnit":"ns","traceEvents":[\n')
+
+    def emit(event):
+        nonlocal first
+        if not first:
+            out.write(',\n')
+        first = False
+        out.write(json.dumps(event, separators=(',', ':')))
+
+    try:
+        while not r.eof():
+            tag = chr(r.byte())
+            if tag == 'L':
+                # Stream header, written on every profiler initialization
+                if r.bytes(3) != MAGIC[1:]:
+                    raise ValueError('bad magic at offset %d' % (r.pos - 4))
+                version = r.byte()
+                if version != VERSION:
+                    raise ValueError('unsupported version %d' % version)
+                tick_per_sec = r.varint()
+                strings = {}
+                tick = 0
+            elif tag == 'S':
+                str_id = r.varint()
+                length = r.varint()
+                strings[str_id] = r.bytes(length).decode('utf-8', 'replace')
+            elif tag in 'BEC':
+                tick += r.zigzag()
+                tid = r.zigzag()
+                cpu = r.zigzag()
+                name = strings.get(r.varint(), '?')
+                event = {
+                    'name': name,
+                    'ph': tag,
+                    'ts': tick * 1000000 / tick_per_sec,
+                    'pid': 1,
+                    'tid': tid,
+                }
+                if tag == 'C':
+                    event['args'] = {'value': r.zigzag()}
+                else:
+                    event['args'] = {'cpu': cpu}
+                emit(event)
+            else:
+                raise ValueError('unknown record \'%s\' at offset %d' % (tag, r.pos - 1))
+    except (EOFError, IndexError):
+        print('warning: the trace is truncated')
+
+    out.write('\n]}\n')
+
+
+if __name__ == '__main__':
+    args = get_arg()
+
+    if not args.json_file:
+        bin_file = Path(args.bin_file)
+        args.json_file = bin_file.with_suffix('.json').as_posix()
+
+    print('bin_file  :', args.bin_file)
+    print('json_file :', args.json_file)
+
+    with open(args.bin_file, 'rb') as f:
+        content = f.read()
+
+    with open(args.json_file, 'w') as f:
+        convert(content, f)
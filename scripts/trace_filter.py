@@ -34,7 +34,7 @@ if __name__ == '__main__':
     # compile regex pattern
     pattern = re.compile(r'(^.+-[0-9]+\s\[[0-9]]\s[0-9]+\.[0-9]+:\s('
                          + "|".join(MARK_LIST)
-                         + r'):\s[B|E]\|[0-9]+\|.+$)', re.M)
+                         + r'):\s[B|E|C]\|[0-9]+\|.+$)', re.M)
 
     matches = pattern.findall(content)
 
@@ -88,6 +88,9 @@ typedef struct _lv_global_t {
     lv_ll_t indev_ll;
     lv_indev_t * indev_active;
     lv_obj_t * indev_obj_active;
+#if LV_USE_INDEV_HIT_INDEX
+    uint32_t indev_hit_gen;
+#endif
 
     uint32_t layout_count;
     lv_layout_dsc_t * layout_list;
@@ -112,6 +115,17 @@ typedef struct _lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+    lv_cache_t * img_band_cache;
+    lv_ll_t img_band_ll;            /**< The data of the cached bands to find the bands of a file*/
+#if LV_USE_BIDI
+    lv_cache_t * bidi_cache;
+#endif
+#if LV_USE_IMAGE_DECODER_ASYNC
+    struct _lv_image_decoder_async_t * img_decoder_async;
+#endif
+#if LV_USE_GIF && !LV_USE_CUSTOM_GIF && LV_GIF_DECODE_ASYNC && LV_USE_OS
+    struct _lv_gifdec_worker_t * gifdec_worker;
+#endif
 
     lv_draw_global_info_t draw_info;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
@@ -120,6 +134,12 @@ typedef struct _lv_global_t {
 #if LV_DRAW_SW_COMPLEX
     _lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
 #endif
+#if defined(LV_DRAW_SW_GLYPH_ATLAS_SIZE) && LV_DRAW_SW_GLYPH_ATLAS_SIZE > 0
+    uint32_t sw_glyph_atlas_generation;
+#endif
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG && defined(LV_DRAW_SW_VECTOR_CACHE_SIZE) && LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+    lv_cache_t * sw_vector_cache;
+#endif
 
 #if LV_USE_LOG
     lv_log_print_g_cb_t custom_log_print_cb;
@@ -9,6 +9,7 @@
 #include "lv_obj.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
+#include "../indev/lv_indev_hit_index.h"
 #include "lv_refr.h"
 #include "lv_group.h"
 #include "../display/lv_display.h"
@@ -123,6 +124,7 @@ void lv_obj_add_flag(lv_obj_t * obj, lv_obj_flag_t f)
     if(f & LV_OBJ_FLAG_HIDDEN) lv_obj_invalidate(obj);
 
     obj->flags |= f;
+    _lv_indev_hit_index_mark_dirty();
 
     if(f & LV_OBJ_FLAG_HIDDEN) {
         if(lv_obj_has_state(obj, LV_STATE_FOCUSED)) {
@@ -163,6 +165,7 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
     }
 
     obj->flags &= (~f);
+    _lv_indev_hit_index_mark_dirty();
 
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
@@ -744,6 +747,7 @@ static void update_obj_state(lv_obj_t * obj, lv_state_t new_state)
 
     obj->state = new_state;
     _lv_obj_update_layer_type(obj);
+    _lv_indev_hit_index_mark_dirty();
     _lv_obj_style_transition_dsc_t * ts = lv_malloc_zeroed(sizeof(_lv_obj_style_transition_dsc_t) * STYLE_TRANSITION_MAX);
     uint32_t tsi = 0;
     uint32_t i;
@@ -10,6 +10,7 @@
 #include "../themes/lv_theme.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
+#include "../indev/lv_indev_hit_index.h"
 #include "../stdlib/lv_string.h"
 
 /*********************
@@ -46,6 +47,7 @@ static uint32_t get_instance_size(const lv_obj_class_t * class_p);
 lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * parent)
 {
     LV_TRACE_OBJ_CREATE("Creating object with %p class on %p parent", (void *)class_p, (void *)parent);
+    _lv_indev_hit_index_mark_dirty();
     uint32_t s = get_instance_size(class_p);
     lv_obj_t * obj = lv_malloc_zeroed(s);
     if(obj == NULL) return NULL;
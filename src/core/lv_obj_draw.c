@@ -10,6 +10,7 @@
 #include "lv_obj.h"
 #include "../display/lv_display.h"
 #include "../indev/lv_indev.h"
+#include "../indev/lv_indev_hit_index.h"
 #include "../stdlib/lv_string.h"
 
 /*********************
@@ -307,7 +308,10 @@ void lv_obj_refresh_ext_draw_size(lv_obj_t * obj)
         obj->spec_attr->ext_draw_size = s_new;
     }
 
-    if(s_new != s_old) lv_obj_invalidate(obj);
+    if(s_new != s_old) {
+        lv_obj_invalidate(obj);
+        _lv_indev_hit_index_mark_dirty();
+    }
 }
 
 int32_t _lv_obj_get_ext_draw_size(const lv_obj_t * obj)
@@ -11,6 +11,7 @@
 #include "../display/lv_display_private.h"
 #include "lv_refr.h"
 #include "../core/lv_global.h"
+#include "../indev/lv_indev_hit_index.h"
 
 /*********************
  *      DEFINES
@@ -175,6 +176,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
 
     /*Set the length and height
      *Be sure the content is not scrolled in an invalid position on the new size*/
+    _lv_indev_hit_index_mark_dirty();
     obj->coords.y2 = obj->coords.y1 + h - 1;
     if(lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL) {
         obj->coords.x1 = obj->coords.x2 - w + 1;
@@ -725,6 +727,7 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
         if(!on1) lv_obj_scrollbar_invalidate(parent);
     }
 
+    _lv_indev_hit_index_mark_dirty();
     obj->coords.x1 += diff.x;
     obj->coords.y1 += diff.y;
     obj->coords.x2 += diff.x;
@@ -748,6 +751,8 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
 
 void lv_obj_move_children_by(lv_obj_t * obj, int32_t x_diff, int32_t y_diff, bool ignore_floating)
 {
+    _lv_indev_hit_index_mark_dirty();
+
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
     for(i = 0; i < child_cnt; i++) {
@@ -916,6 +921,7 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, int32_t size)
 
     lv_obj_allocate_spec_attr(obj);
     obj->spec_attr->ext_click_pad = size;
+    _lv_indev_hit_index_mark_dirty();
 }
 
 void lv_obj_get_click_area(const lv_obj_t * obj, lv_area_t * area)
@@ -12,6 +12,7 @@
 #include "../misc/lv_color.h"
 #include "../stdlib/lv_string.h"
 #include "../core/lv_global.h"
+#include "../indev/lv_indev_hit_index.h"
 /*********************
  *      DEFINES
  *********************/
@@ -286,6 +287,11 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
     bool is_inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE);
     bool is_layer_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_LAYER_UPDATE);
 
+    /*The coordinates are handled when they really change, only the transformation matters here*/
+    if(prop == LV_STYLE_PROP_ANY || is_layer_refr || lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_TRANSFORM)) {
+        _lv_indev_hit_index_mark_dirty();
+    }
+
     if(is_layout_refr) {
         if(part == LV_PART_ANY ||
            part == LV_PART_MAIN ||
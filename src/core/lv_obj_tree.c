@@ -9,6 +9,7 @@
 #include "lv_obj.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
+#include "../indev/lv_indev_hit_index.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../misc/lv_anim.h"
@@ -158,6 +159,8 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     lv_obj_allocate_spec_attr(parent);
 
+    _lv_indev_hit_index_mark_dirty();
+
     lv_obj_t * old_parent = obj->parent;
     /*Remove the object from the old parent's child list*/
     int32_t i;
@@ -241,6 +244,7 @@ void lv_obj_move_to_index(lv_obj_t * obj, int32_t index)
     }
 
     parent->spec_attr->children[index] = obj;
+    _lv_indev_hit_index_mark_dirty();
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, NULL);
     lv_obj_invalidate(parent);
 }
@@ -259,6 +263,8 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
     lv_obj_send_event(parent2, LV_EVENT_CHILD_DELETED, obj2);
     lv_obj_send_event(parent, LV_EVENT_CHILD_DELETED, obj1);
 
+    _lv_indev_hit_index_mark_dirty();
+
     parent->spec_attr->children[index1] = obj2;
     obj2->parent = parent;
 
@@ -502,6 +508,7 @@ static void obj_delete_core(lv_obj_t * obj)
         return;
 
     obj->is_deleting = true;
+    _lv_indev_hit_index_mark_dirty();
 
     /*Let the user free the resources used in `LV_EVENT_DELETE`*/
     lv_result_t res = lv_obj_send_event(obj, LV_EVENT_DELETE, NULL);
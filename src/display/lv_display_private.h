@@ -149,6 +149,11 @@ struct _lv_display_t {
     /** The area being refreshed*/
     lv_area_t refreshed_area;
     uint32_t vsync_count;
+
+#if LV_USE_INDEV_HIT_INDEX
+    /** Grids of the clickable objects of the screens and layers*/
+    struct _lv_indev_hit_index_t * hit_index;
+#endif
 };
 
 /**********************
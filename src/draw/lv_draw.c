@@ -179,6 +179,7 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
     /*Remove the finished tasks first*/
     lv_draw_task_t * t_prev = NULL;
     lv_draw_task_t * t = layer->draw_task_head;
+    uint32_t task_cnt = 0;
     while(t) {
         lv_draw_task_t * t_next = t->next;
         if(t->state == LV_DRAW_TASK_STATE_READY) {
@@ -196,6 +197,7 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
 
                     _draw_info.used_memory_for_layers_kb -= get_layer_size_kb(layer_size_byte);
                     LV_LOG_INFO("Layer memory used: %" LV_PRIu32 " kB\n", _draw_info.used_memory_for_layers_kb);
+                    LV_PROFILER_DRAW_COUNTER("layer_mem_kb", (int32_t)_draw_info.used_memory_for_layers_kb);
                     lv_draw_buf_destroy(layer_drawn->draw_buf);
                     layer_drawn->draw_buf = NULL;
                 }
@@ -234,10 +236,13 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         }
         else {
             t_prev = t;
+            task_cnt++;
         }
         t = t_next;
     }
 
+    LV_PROFILER_DRAW_COUNTER("draw_task_cnt", (int32_t)task_cnt);
+
     bool render_running = false;
 
     /*This layer is ready, enable blending its buffer*/
@@ -399,6 +404,7 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
 
     _draw_info.used_memory_for_layers_kb += get_layer_size_kb(layer_size_byte);
     LV_LOG_INFO("Layer memory used: %" LV_PRIu32 " kB\n", _draw_info.used_memory_for_layers_kb);
+    LV_PROFILER_DRAW_COUNTER("layer_mem_kb", (int32_t)_draw_info.used_memory_for_layers_kb);
 
     if(lv_color_format_has_alpha(layer->color_format)) {
         lv_draw_buf_clear(layer->draw_buf, NULL);
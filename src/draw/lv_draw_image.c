@@ -30,6 +30,7 @@ static void img_decode_and_draw(lv_draw_unit_t * draw_unit, const lv_draw_image_
                                 lv_image_decoder_dsc_t * decoder_dsc, lv_area_t * relative_decoded_area,
                                 const lv_area_t * img_area, const lv_area_t * clipped_img_area,
                                 lv_draw_image_core_cb draw_core_cb);
+static lv_result_t image_decoder_open(lv_image_decoder_dsc_t * decoder_dsc, const lv_draw_image_dsc_t * draw_dsc);
 
 /**********************
  *  STATIC VARIABLES
@@ -105,7 +106,11 @@ void lv_draw_image(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv
 
     lv_draw_image_dsc_t * new_image_dsc = lv_malloc(sizeof(*dsc));
     lv_memcpy(new_image_dsc, dsc, sizeof(*dsc));
-    lv_result_t res = lv_image_decoder_get_info(new_image_dsc->src, &new_image_dsc->header);
+    lv_image_decoder_args_t args;
+    lv_memzero(&args, sizeof(args));
+    args.target_w = dsc->target_w;
+    args.target_h = dsc->target_h;
+    lv_result_t res = lv_image_decoder_get_info_with_args(new_image_dsc->src, &args, &new_image_dsc->header);
     if(res != LV_RESULT_OK) {
         LV_LOG_WARN("Couldn't get info about the image");
         lv_free(new_image_dsc);
@@ -174,7 +179,7 @@ void _lv_draw_image_normal_helper(lv_draw_unit_t * draw_unit, const lv_draw_imag
     }
 
     lv_image_decoder_dsc_t decoder_dsc;
-    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, NULL);
+    lv_result_t res = image_decoder_open(&decoder_dsc, draw_dsc);
     if(res != LV_RESULT_OK) {
         LV_LOG_ERROR("Failed to open image");
         return;
@@ -194,7 +199,7 @@ void _lv_draw_image_tiled_helper(lv_draw_unit_t * draw_unit, const lv_draw_image
     }
 
     lv_image_decoder_dsc_t decoder_dsc;
-    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, NULL);
+    lv_result_t res = image_decoder_open(&decoder_dsc, draw_dsc);
     if(res != LV_RESULT_OK) {
         LV_LOG_ERROR("Failed to open image");
         return;
@@ -269,6 +274,21 @@ void _lv_image_buf_get_transformed_area(lv_area_t * res, int32_t w, int32_t h, i
  *   STATIC FUNCTIONS
  **********************/
 
+static lv_result_t image_decoder_open(lv_image_decoder_dsc_t * decoder_dsc, const lv_draw_image_dsc_t * draw_dsc)
+{
+    /*Only not transformed images can be drawn band by band*/
+    bool transformed = draw_dsc->rotation || draw_dsc->scale_x != LV_SCALE_NONE || draw_dsc->scale_y != LV_SCALE_NONE;
+
+    lv_image_decoder_args_t args;
+    lv_memzero(&args, sizeof(args));
+    args.stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1;
+    args.allow_partial = !transformed;
+    args.target_w = draw_dsc->target_w;
+    args.target_h = draw_dsc->target_h;
+
+    return lv_image_decoder_open(decoder_dsc, draw_dsc->src, &args);
+}
+
 static void img_decode_and_draw(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
                                 lv_image_decoder_dsc_t * decoder_dsc, lv_area_t * relative_decoded_area,
                                 const lv_area_t * img_area, const lv_area_t * clipped_img_area,
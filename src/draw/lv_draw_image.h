@@ -71,6 +71,11 @@ typedef struct _lv_draw_image_dsc_t {
     const lv_image_dsc_t * bitmap_mask_src;
 
     int32_t clip_radius;
+
+    /**Decode the image with a lower resolution if the decoder is scalable. See `lv_image_decoder_args_t`.
+     * 0: decode the image with its full resolution*/
+    int32_t target_w;
+    int32_t target_h;
 } lv_draw_image_dsc_t;
 
 /**
@@ -35,7 +35,8 @@
  *  STATIC PROTOTYPES
  **********************/
 static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
-                        const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb);
+                        const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb,
+                        lv_draw_glyph_bitmap_cb_t bitmap_cb);
 
 /**********************
  *  STATIC VARIABLES
@@ -147,6 +148,13 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_character(lv_layer_t * layer, lv_draw_label_d
 void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_label_dsc_t * dsc,
                                       const lv_area_t * coords,
                                       lv_draw_glyph_cb_t cb)
+{
+    lv_draw_label_iterate_characters_ex(draw_unit, dsc, coords, cb, NULL);
+}
+
+void lv_draw_label_iterate_characters_ex(lv_draw_unit_t * draw_unit, const lv_draw_label_dsc_t * dsc,
+                                         const lv_area_t * coords, lv_draw_glyph_cb_t cb,
+                                         lv_draw_glyph_bitmap_cb_t bitmap_cb)
 {
     const lv_font_t * font = dsc->font;
     int32_t w;
@@ -290,9 +298,10 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
         /*Write all letter of a line*/
         i = 0;
 #if LV_USE_BIDI
-        char * bidi_txt = lv_malloc(line_end - line_start + 1);
-        LV_ASSERT_MALLOC(bidi_txt);
-        _lv_bidi_process_paragraph(dsc->text + line_start, bidi_txt, line_end - line_start, base_dir, NULL, 0);
+        const lv_bidi_paragraph_t * bidi_par = _lv_bidi_paragraph_acquire(dsc->text + line_start, line_end - line_start,
+                                                                          base_dir);
+        LV_ASSERT_MALLOC(bidi_par);
+        const char * bidi_txt = bidi_par->visual_txt;
 #else
         const char * bidi_txt = dsc->text + line_start;
 #endif
@@ -303,7 +312,7 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
 #if LV_USE_BIDI
                 logical_char_pos = lv_text_encoded_get_char_id(dsc->text, line_start);
                 uint32_t t = lv_text_encoded_get_char_id(bidi_txt, i);
-                logical_char_pos += _lv_bidi_get_logical_pos(bidi_txt, NULL, line_end - line_start, base_dir, t, NULL);
+                logical_char_pos += _lv_bidi_paragraph_get_logical_pos(bidi_par, t, NULL);
 #else
                 logical_char_pos = lv_text_encoded_get_char_id(dsc->text, line_start + i);
 #endif
@@ -353,7 +362,7 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
                 draw_letter_dsc.color = dsc->color;
             }
 
-            draw_letter(draw_unit, &draw_letter_dsc, &pos, font, letter, cb);
+            draw_letter(draw_unit, &draw_letter_dsc, &pos, font, letter, cb, bitmap_cb);
 
             if(letter_w > 0) {
                 pos.x += letter_w + dsc->letter_space;
@@ -361,7 +370,8 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
         }
 
 #if LV_USE_BIDI
-        lv_free(bidi_txt);
+        _lv_bidi_paragraph_release(bidi_par);
+        bidi_par = NULL;
         bidi_txt = NULL;
 #endif
 
@@ -383,7 +393,8 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
  **********************/
 
 static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
-                        const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb)
+                        const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb,
+                        lv_draw_glyph_bitmap_cb_t bitmap_cb)
 {
     lv_font_glyph_dsc_t g;
 
@@ -426,7 +437,16 @@ static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,
         return;
     }
 
-    if(g.resolved_font) {
+    lv_draw_buf_t * cached_buf = NULL;
+    if(g.resolved_font && bitmap_cb && LV_FONT_GLYPH_FORMAT_NONE < g.format && g.format < LV_FONT_GLYPH_FORMAT_IMAGE) {
+        cached_buf = bitmap_cb(draw_unit, &g, letter);
+    }
+
+    if(cached_buf) {
+        dsc->glyph_data = cached_buf;
+        dsc->format = g.format;
+    }
+    else if(g.resolved_font) {
         lv_draw_buf_t * draw_buf = NULL;
         if(LV_FONT_GLYPH_FORMAT_NONE < g.format && g.format < LV_FONT_GLYPH_FORMAT_IMAGE) {
             /*Only check draw buf for bitmap glyph*/
@@ -454,7 +474,8 @@ static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,
     dsc->g = &g;
     cb(draw_unit, dsc, NULL, NULL);
 
-    lv_font_glyph_release_draw_data(&g);
+    /*The cached bitmaps are already released by `bitmap_cb`*/
+    if(cached_buf == NULL) lv_font_glyph_release_draw_data(&g);
 
     LV_PROFILER_DRAW_END;
 }
@@ -98,6 +98,20 @@ typedef struct {
 typedef void(*lv_draw_glyph_cb_t)(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc, lv_draw_fill_dsc_t * fill_dsc,
                                   const lv_area_t * fill_area);
 
+/**
+ * Passed as a parameter to `lv_draw_label_iterate_characters_ex` to provide the
+ * bitmaps of the glyphs from a cache (e.g. a glyph atlas) instead of getting them
+ * from the font for each glyph
+ * @param draw_unit     pointer to a draw unit
+ * @param g             descriptor of the glyph. Called only for A1, A2, A4 and A8 glyphs.
+ * @param letter        the Unicode letter of the glyph
+ * @return              an A8 draw buffer with the bitmap of the glyph, or NULL to get it from the font
+ * @note                if a bitmap is returned the callback needs to release the glyph's draw data
+ *                      with `lv_font_glyph_release_draw_data` if it got the bitmap from the font
+ */
+typedef lv_draw_buf_t * (*lv_draw_glyph_bitmap_cb_t)(lv_draw_unit_t * draw_unit, lv_font_glyph_dsc_t * g,
+                                                     uint32_t letter);
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -152,6 +166,19 @@ void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_character(lv_layer_t * layer, lv_draw_l
 void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_label_dsc_t * dsc,
                                       const lv_area_t * coords, lv_draw_glyph_cb_t cb);
 
+/**
+ * Same as `lv_draw_label_iterate_characters` but the bitmaps of the glyphs are
+ * requested from `bitmap_cb` first
+ * @param draw_unit     pointer to a draw unit
+ * @param dsc           pointer to draw descriptor
+ * @param coords        coordinates of the label
+ * @param cb            a callback to call to draw each glyphs one by one
+ * @param bitmap_cb     a callback to get the bitmap of the glyphs from a cache
+ */
+void lv_draw_label_iterate_characters_ex(lv_draw_unit_t * draw_unit, const lv_draw_label_dsc_t * dsc,
+                                         const lv_area_t * coords, lv_draw_glyph_cb_t cb,
+                                         lv_draw_glyph_bitmap_cb_t bitmap_cb);
+
 /***********************
  * GLOBAL VARIABLES
  ***********************/
@@ -67,6 +67,56 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_line(lv_layer_t * layer, const lv_draw_line_d
     LV_PROFILER_DRAW_END;
 }
 
+lv_draw_polyline_dsc_t * lv_draw_task_get_polyline_dsc(lv_draw_task_t * task)
+{
+    return task->type == LV_DRAW_TASK_TYPE_POLYLINE ? (lv_draw_polyline_dsc_t *)task->draw_dsc : NULL;
+}
+
+void lv_draw_polyline(lv_layer_t * layer, const lv_draw_line_dsc_t * dsc, const lv_point_precise_t points[],
+                      uint32_t point_cnt)
+{
+    if(point_cnt < 2) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+    lv_area_t a;
+    a.x1 = (int32_t)points[0].x;
+    a.x2 = (int32_t)points[0].x;
+    a.y1 = (int32_t)points[0].y;
+    a.y2 = (int32_t)points[0].y;
+
+    uint32_t i;
+    for(i = 1; i < point_cnt; i++) {
+        a.x1 = LV_MIN(a.x1, (int32_t)points[i].x);
+        a.x2 = LV_MAX(a.x2, (int32_t)points[i].x);
+        a.y1 = LV_MIN(a.y1, (int32_t)points[i].y);
+        a.y2 = LV_MAX(a.y2, (int32_t)points[i].y);
+    }
+
+    lv_area_increase(&a, dsc->width, dsc->width);
+
+    /*Allocate the points together with the descriptor so that they are freed with it*/
+    size_t points_size = sizeof(lv_point_precise_t) * point_cnt;
+    lv_draw_polyline_dsc_t * polyline_dsc = lv_malloc(sizeof(lv_draw_polyline_dsc_t) + points_size);
+    LV_ASSERT_MALLOC(polyline_dsc);
+    if(polyline_dsc == NULL) {
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
+    lv_point_precise_t * points_local = (lv_point_precise_t *)(polyline_dsc + 1);
+    lv_memcpy(points_local, points, points_size);
+    lv_memcpy(&polyline_dsc->line, dsc, sizeof(*dsc));
+    polyline_dsc->points = points_local;
+    polyline_dsc->point_cnt = point_cnt;
+
+    lv_draw_task_t * t = lv_draw_add_task(layer, &a);
+    t->draw_dsc = polyline_dsc;
+    t->type = LV_DRAW_TASK_TYPE_POLYLINE;
+
+    lv_draw_finalize_task_creation(layer, t);
+    LV_PROFILER_DRAW_END;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
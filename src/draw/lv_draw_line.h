@@ -41,6 +41,12 @@ typedef struct {
     uint8_t raw_end     : 1;    /*Do not bother with perpendicular line ending if it's not visible for any reason*/
 } lv_draw_line_dsc_t;
 
+typedef struct {
+    lv_draw_line_dsc_t line;        /*Style of the segments. `p1` and `p2` are not used.*/
+    const lv_point_precise_t * points;
+    uint32_t point_cnt;
+} lv_draw_polyline_dsc_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -65,6 +71,24 @@ lv_draw_line_dsc_t * lv_draw_task_get_line_dsc(lv_draw_task_t * task);
  */
 void lv_draw_line(lv_layer_t * layer, const lv_draw_line_dsc_t * dsc);
 
+/**
+ * Try to get a polyline draw descriptor from a draw task.
+ * @param task      draw task
+ * @return          the task's draw descriptor or NULL if the task is not of type LV_DRAW_TASK_TYPE_POLYLINE
+ */
+lv_draw_polyline_dsc_t * lv_draw_task_get_polyline_dsc(lv_draw_task_t * task);
+
+/**
+ * Create a single draw task which draws lines between the consecutive points.
+ * It's much cheaper than calling `lv_draw_line()` for each segment.
+ * @param layer     pointer to a layer
+ * @param dsc       pointer to an initialized `lv_draw_line_dsc_t` variable. `p1` and `p2` are ignored.
+ * @param points    array of points. It's copied so it can be a local variable.
+ * @param point_cnt number of points. Nothing is drawn if less than 2.
+ */
+void lv_draw_polyline(lv_layer_t * layer, const lv_draw_line_dsc_t * dsc, const lv_point_precise_t points[],
+                      uint32_t point_cnt);
+
 /**********************
  *      MACROS
  **********************/
@@ -800,4 +800,42 @@ void _lv_vector_for_each_destroy_tasks(lv_ll_t * task_list, vector_draw_task_cb
     }
     lv_free(task_list);
 }
+
+void _lv_vector_dsc_add_tasks(lv_vector_dsc_t * dsc, const lv_ll_t * task_list)
+{
+    lv_area_t clip;
+    if(!_lv_area_intersect(&clip, &(dsc->layer->_clip_area), &(dsc->current_dsc.scissor_area))) {
+        return;
+    }
+
+    _lv_vector_draw_task * task;
+    _LV_LL_READ(task_list, task) {
+        /*Clear tasks keep their area as lv_vector_clear_area() does*/
+        lv_area_t rect;
+        if(task->path && !_lv_area_intersect(&rect, &clip, &(task->dsc.scissor_area))) {
+            continue;
+        }
+
+        if(!dsc->tasks.task_list) {
+            dsc->tasks.task_list = lv_malloc(sizeof(lv_ll_t));
+            LV_ASSERT_MALLOC(dsc->tasks.task_list);
+            _lv_ll_init(dsc->tasks.task_list, sizeof(_lv_vector_draw_task));
+        }
+
+        _lv_vector_draw_task * new_task = (_lv_vector_draw_task *)_lv_ll_ins_tail(dsc->tasks.task_list);
+        lv_memset(new_task, 0, sizeof(_lv_vector_draw_task));
+
+        if(task->path) {
+            new_task->path = lv_vector_path_create(0);
+            _copy_draw_dsc(&(new_task->dsc), &(task->dsc));
+            lv_vector_path_copy(new_task->path, task->path);
+            new_task->dsc.scissor_area = rect;
+        }
+        else {
+            new_task->dsc.fill_dsc.color = task->dsc.fill_dsc.color;
+            new_task->dsc.fill_dsc.opa = task->dsc.fill_dsc.opa;
+            lv_area_copy(&(new_task->dsc.scissor_area), &(task->dsc.scissor_area));
+        }
+    }
+}
 #endif /* LV_USE_VECTOR_GRAPHIC */
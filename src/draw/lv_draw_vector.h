@@ -557,6 +557,14 @@ typedef void (*vector_draw_task_cb)(void * ctx, const lv_vector_path_t * path, c
 
 void _lv_vector_for_each_destroy_tasks(lv_ll_t * task_list, vector_draw_task_cb cb, void * data);
 
+/**
+ * Add copies of recorded draw tasks to a vector graphic descriptor. The tasks are clipped
+ * to the clip area of the layer of the descriptor.
+ * @param dsc           pointer to a vector graphic descriptor
+ * @param task_list     the recorded tasks, e.g. taken from the `tasks` of another descriptor
+ */
+void _lv_vector_dsc_add_tasks(lv_vector_dsc_t * dsc, const lv_ll_t * task_list);
+
 #endif /* LV_USE_VECTOR_GRAPHIC */
 
 #ifdef __cplusplus
@@ -12,6 +12,9 @@
 #include "../misc/lv_ll.h"
 #include "../stdlib/lv_string.h"
 #include "../core/lv_global.h"
+#include "../misc/lv_timer.h"
+#include "../misc/lv_profiler.h"
+#include "../osal/lv_os.h"
 
 /*********************
  *      DEFINES
@@ -19,12 +22,47 @@
 #define img_decoder_ll_p &(LV_GLOBAL_DEFAULT()->img_decoder_ll)
 #define img_cache_p (LV_GLOBAL_DEFAULT()->img_cache)
 #define img_header_cache_p (LV_GLOBAL_DEFAULT()->img_header_cache)
+#define img_band_cache_p (LV_GLOBAL_DEFAULT()->img_band_cache)
 #define image_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers)
+#define img_decoder_async_p (LV_GLOBAL_DEFAULT()->img_decoder_async)
+
+#define ASYNC_TIMER_PERIOD  10
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+typedef enum {
+    ASYNC_STATE_QUEUED,
+    ASYNC_STATE_BUSY,
+    ASYNC_STATE_READY,
+} async_state_t;
+
+typedef struct {
+    const void * src;           /*Own copy for files*/
+    lv_image_src_t src_type;
+    lv_image_decoder_args_t args;
+    bool has_args;
+    lv_image_decoder_async_cb_t cb;
+    void * user_data;
+    lv_result_t res;
+    async_state_t state;
+} async_req_t;
+
+struct _lv_image_decoder_async_t {
+    lv_ll_t req_ll;             /*Requests in the order of queuing*/
+    uint32_t pending_cnt;       /*Requests whose callback isn't called yet*/
+    lv_timer_t * timer;         /*Calls the callbacks (and decodes if there is no OS)*/
+#if LV_USE_OS != LV_OS_NONE
+    lv_thread_t thread;
+    lv_thread_sync_t sync;
+    lv_mutex_t lock;
+    volatile bool exit_status;
+#endif
+};
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -40,6 +78,18 @@ static uint32_t img_width_to_stride(lv_image_header_t * header);
 static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc, lv_image_header_t * header);
 
 static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc);
+static void clamp_target_size(lv_image_decoder_args_t * args);
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+static struct _lv_image_decoder_async_t * async_get(void);
+static void async_deinit(void);
+static void async_decode(async_req_t * req);
+static void async_timer_cb(lv_timer_t * t);
+static void async_free_req(async_req_t * req);
+#if LV_USE_OS != LV_OS_NONE
+static void async_thread_cb(void * ptr);
+#endif
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -56,13 +106,14 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc);
 /**
  * Initialize the image decoder module
  */
-void _lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_count)
+void _lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_count, uint32_t image_band_cache_size)
 {
     _lv_ll_init(img_decoder_ll_p, sizeof(lv_image_decoder_t));
 
     /*Initialize the cache*/
     lv_image_cache_init(image_cache_size);
     lv_image_header_cache_init(image_header_count);
+    lv_image_band_cache_init(image_band_cache_size);
 }
 
 /**
@@ -70,18 +121,33 @@ void _lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_cou
  */
 void _lv_image_decoder_deinit(void)
 {
+#if LV_USE_IMAGE_DECODER_ASYNC
+    async_deinit();
+#endif
+
     lv_cache_destroy(img_cache_p, NULL);
     lv_cache_destroy(img_header_cache_p, NULL);
+    lv_cache_destroy(img_band_cache_p, NULL);
 
     _lv_ll_clear(img_decoder_ll_p);
 }
 
 lv_result_t lv_image_decoder_get_info(const void * src, lv_image_header_t * header)
+{
+    return lv_image_decoder_get_info_with_args(src, NULL, header);
+}
+
+lv_result_t lv_image_decoder_get_info_with_args(const void * src, const lv_image_decoder_args_t * args,
+                                                lv_image_header_t * header)
 {
     lv_image_decoder_dsc_t dsc;
     lv_memzero(&dsc, sizeof(lv_image_decoder_dsc_t));
     dsc.src = src;
     dsc.src_type = lv_image_src_get_type(src);
+    if(args) {
+        dsc.args = *args;
+        clamp_target_size(&dsc.args);
+    }
 
     lv_image_decoder_t * decoder = image_decoder_get_info(&dsc, header);
     if(decoder == NULL) return LV_RESULT_INVALID;
@@ -97,10 +163,23 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
     dsc->src = src;
     dsc->src_type = lv_image_src_get_type(src);
 
+    /*Make a copy of args. The target size is needed already to look up the cache.*/
+    dsc->args = args ? *args : (lv_image_decoder_args_t) {
+        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
+        .premultiply = false,
+        .no_cache = false,
+        .use_indexed = false,
+        .flush_cache = false,
+        .allow_partial = false,
+        .target_w = 0,
+        .target_h = 0,
+    };
+    clamp_target_size(&dsc->args);
+
     if(lv_image_cache_is_enabled()) {
         dsc->cache = img_cache_p;
         /*Try cache first, unless we are told to ignore cache.*/
-        if(!(args && args->no_cache)) {
+        if(!dsc->args.no_cache) {
             /*
             * Check the cache first
             * If the image is found in the cache, just return it.*/
@@ -112,15 +191,6 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
     dsc->decoder = image_decoder_get_info(dsc, &dsc->header);
     if(dsc->decoder == NULL) return LV_RESULT_INVALID;
 
-    /*Make a copy of args*/
-    dsc->args = args ? *args : (lv_image_decoder_args_t) {
-        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
-        .premultiply = false,
-        .no_cache = false,
-        .use_indexed = false,
-        .flush_cache = false,
-    };
-
     /*
      * We assume that if a decoder can get the info, it can open the image.
      * If decoder open failed, free the source and return error.
@@ -164,6 +234,91 @@ void lv_image_decoder_close(lv_image_decoder_dsc_t * dsc)
     }
 }
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+lv_result_t lv_image_decoder_decode_async(const void * src, const lv_image_decoder_args_t * args,
+                                          lv_image_decoder_async_cb_t cb, void * user_data)
+{
+    if(src == NULL) return LV_RESULT_INVALID;
+
+    /*Without cache the decoded image would be freed right after decoding*/
+    if(!lv_image_cache_is_enabled()) {
+        LV_LOG_WARN("image cache is disabled");
+        return LV_RESULT_INVALID;
+    }
+
+    struct _lv_image_decoder_async_t * ctx = async_get();
+    if(ctx == NULL) return LV_RESULT_INVALID;
+
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    if(src_type == LV_IMAGE_SRC_FILE) {
+        src = lv_strdup(src);
+        LV_ASSERT_MALLOC(src);
+        if(src == NULL) return LV_RESULT_INVALID;
+    }
+
+#if LV_USE_OS != LV_OS_NONE
+    lv_mutex_lock(&ctx->lock);
+#endif
+    async_req_t * req = _lv_ll_ins_tail(&ctx->req_ll);
+    if(req) {
+        lv_memzero(req, sizeof(async_req_t));
+        req->src = src;
+        req->src_type = src_type;
+        req->has_args = args != NULL;
+        if(args) req->args = *args;
+        req->cb = cb;
+        req->user_data = user_data;
+        req->state = ASYNC_STATE_QUEUED;
+    }
+#if LV_USE_OS != LV_OS_NONE
+    lv_mutex_unlock(&ctx->lock);
+#endif
+
+    LV_ASSERT_MALLOC(req);
+    if(req == NULL) {
+        if(src_type == LV_IMAGE_SRC_FILE) lv_free((void *)src);
+        return LV_RESULT_INVALID;
+    }
+
+    ctx->pending_cnt++;
+    lv_timer_resume(ctx->timer);
+#if LV_USE_OS != LV_OS_NONE
+    lv_thread_sync_signal(&ctx->sync);
+#endif
+
+    return LV_RESULT_OK;
+}
+
+void lv_image_decoder_cancel_async(lv_image_decoder_async_cb_t cb, void * user_data)
+{
+    struct _lv_image_decoder_async_t * ctx = img_decoder_async_p;
+    if(ctx == NULL) return;
+
+#if LV_USE_OS != LV_OS_NONE
+    lv_mutex_lock(&ctx->lock);
+#endif
+    async_req_t * req = _lv_ll_get_head(&ctx->req_ll);
+    while(req) {
+        async_req_t * req_next = _lv_ll_get_next(&ctx->req_ll, req);
+        if(req->cb == cb && req->user_data == user_data) {
+            if(req->state == ASYNC_STATE_QUEUED) {
+                _lv_ll_remove(&ctx->req_ll, req);
+                async_free_req(req);
+                ctx->pending_cnt--;
+            }
+            else {
+                /*Let it finish, the decoded image is still useful for the cache*/
+                req->cb = NULL;
+            }
+        }
+        req = req_next;
+    }
+#if LV_USE_OS != LV_OS_NONE
+    lv_mutex_unlock(&ctx->lock);
+#endif
+}
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /**
  * Create a new image decoder
  * @return pointer to the new image decoder
@@ -218,6 +373,12 @@ lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
                                                  lv_image_cache_data_t * search_key,
                                                  const lv_draw_buf_t * decoded, void * user_data)
 {
+    /*Other decoders ignore the target size, so their images are cached only once*/
+    if(decoder == NULL || !decoder->scalable) {
+        search_key->target_w = 0;
+        search_key->target_h = 0;
+    }
+
     lv_cache_entry_t * cache_entry = lv_cache_add(img_cache_p, search_key, NULL);
     if(cache_entry == NULL) {
         return NULL;
@@ -288,6 +449,136 @@ lv_draw_buf_t * lv_image_decoder_post_process(lv_image_decoder_dsc_t * dsc, lv_d
     return decoded;
 }
 
+bool lv_image_decoder_use_bands(const lv_image_decoder_dsc_t * dsc, lv_color_format_t cf)
+{
+    if(!dsc->args.allow_partial || dsc->src_type != LV_IMAGE_SRC_FILE) return false;
+    if(!lv_image_band_cache_is_enabled()) return false;
+
+    uint32_t stride = lv_draw_buf_width_to_stride(dsc->header.w, cf);
+    return (uint64_t)stride * dsc->header.h > lv_image_band_cache_get_size();
+}
+
+lv_result_t lv_image_decoder_get_band(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                      lv_area_t * decoded_area, lv_color_format_t cf, uint32_t align,
+                                      uint32_t crop_align, lv_image_decoder_band_cb_t decode_cb)
+{
+    int32_t img_w = dsc->header.w;
+    int32_t img_h = dsc->header.h;
+
+    /*Decode only the columns to draw if the decoder can crop the rows*/
+    int32_t x = 0;
+    int32_t w = img_w;
+    if(crop_align) {
+        x = LV_MAX(full_area->x1, 0);
+        x -= x % crop_align;
+        int32_t x_end = LV_MIN(full_area->x2 + 1, img_w);
+        x_end += (crop_align - x_end % crop_align) % crop_align;
+        w = LV_MIN(x_end, img_w) - x;
+        if(w <= 0) return LV_RESULT_INVALID;
+    }
+
+    /*Make the bands small enough to have a few of them in the cache, e.g. for parallel draw units*/
+    uint32_t stride = lv_draw_buf_width_to_stride(w, cf);
+    int32_t band_h = lv_image_band_cache_get_size() / 8 / stride;
+    band_h -= band_h % align;
+    if(band_h < (int32_t)align) band_h = align;
+
+    int32_t y;
+    if(decoded_area->y1 == LV_COORD_MIN) {
+        y = LV_MAX(full_area->y1, 0);
+        y -= y % band_h;
+    }
+    else {
+        y = decoded_area->y2 + 1;
+    }
+
+    if(y > full_area->y2 || y >= img_h) return LV_RESULT_INVALID;
+
+    lv_image_decoder_release_band(dsc);
+
+    LV_PROFILER_BEGIN;
+
+    lv_image_band_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.src = dsc->src;
+    search_key.x = x;
+    search_key.y = y;
+    search_key.w = w;
+    if(dsc->decoder->scalable) {
+        search_key.target_w = dsc->args.target_w;
+        search_key.target_h = dsc->args.target_h;
+    }
+
+    lv_cache_entry_t * entry = lv_cache_acquire(img_band_cache_p, &search_key, NULL);
+    if(entry == NULL) {
+        lv_draw_buf_t * band = lv_draw_buf_create_user(image_cache_draw_buf_handlers, w,
+                                                       LV_MIN(band_h, img_h - y), cf, LV_STRIDE_AUTO);
+        if(band == NULL) {
+            LV_LOG_WARN("can't allocate a band of %" LV_PRId32 " rows", band_h);
+            LV_PROFILER_END;
+            return LV_RESULT_INVALID;
+        }
+
+        if(decode_cb(dsc->decoder, dsc, band, x, y) != LV_RESULT_OK) {
+            lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, band);
+            LV_PROFILER_END;
+            return LV_RESULT_INVALID;
+        }
+
+        lv_draw_buf_t * adjusted = lv_image_decoder_post_process(dsc, band);
+        if(adjusted != band) {
+            lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, band);
+            band = adjusted;
+        }
+
+        if(band == NULL) {
+            LV_PROFILER_END;
+            return LV_RESULT_INVALID;
+        }
+
+        /*Another draw unit might have decoded the same band meanwhile*/
+        entry = lv_cache_acquire(img_band_cache_p, &search_key, NULL);
+        if(entry) {
+            lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, band);
+        }
+        else {
+            search_key.src = lv_strdup(dsc->src);
+            search_key.decoded = band;
+            search_key.slot.size = band->data_size;
+            entry = lv_image_band_cache_add(&search_key);
+            if(entry == NULL) {
+                LV_LOG_WARN("can't add a band to the cache");
+                lv_free((void *)search_key.src);
+                lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, band);
+                LV_PROFILER_END;
+                return LV_RESULT_INVALID;
+            }
+        }
+    }
+
+    lv_image_band_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+    dsc->cache = img_band_cache_p;
+    dsc->cache_entry = entry;
+    dsc->decoded = cached_data->decoded;
+
+    decoded_area->x1 = x;
+    decoded_area->x2 = x + w - 1;
+    decoded_area->y1 = y;
+    decoded_area->y2 = y + cached_data->decoded->header.h - 1;
+
+    LV_PROFILER_END;
+    return LV_RESULT_OK;
+}
+
+void lv_image_decoder_release_band(lv_image_decoder_dsc_t * dsc)
+{
+    if(dsc->cache_entry == NULL || dsc->cache != img_band_cache_p) return;
+
+    lv_cache_release(img_band_cache_p, dsc->cache_entry, NULL);
+    dsc->cache_entry = NULL;
+    dsc->decoded = NULL;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -318,9 +609,23 @@ static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc,
         lv_image_header_cache_data_t search_key;
         search_key.src_type = src_type;
         search_key.src = src;
+        search_key.target_w = dsc->args.target_w;
+        search_key.target_h = dsc->args.target_h;
 
         lv_cache_entry_t * entry = lv_cache_acquire(img_header_cache_p, &search_key, NULL);
 
+        /*The header of a not scalable decoder is cached only for the full size*/
+        if(entry == NULL && (search_key.target_w != 0 || search_key.target_h != 0)) {
+            search_key.target_w = 0;
+            search_key.target_h = 0;
+            entry = lv_cache_acquire(img_header_cache_p, &search_key, NULL);
+            lv_image_header_cache_data_t * cached_data = entry ? lv_cache_entry_get_data(entry) : NULL;
+            if(cached_data && cached_data->decoder->scalable) {
+                lv_cache_release(img_header_cache_p, entry, NULL);
+                entry = NULL;
+            }
+        }
+
         if(entry) {
             lv_image_header_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
             *header = cached_data->header;
@@ -374,6 +679,8 @@ static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc,
         lv_image_header_cache_data_t search_key;
         search_key.src_type = src_type;
         search_key.src = lv_strdup(src);
+        search_key.target_w = decoder->scalable ? dsc->args.target_w : 0;
+        search_key.target_h = decoder->scalable ? dsc->args.target_h : 0;
         search_key.decoder = decoder;
         search_key.header = *header;
         entry = lv_cache_add(img_header_cache_p, &search_key, NULL);
@@ -406,9 +713,23 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
     lv_image_cache_data_t search_key;
     search_key.src_type = dsc->src_type;
     search_key.src = dsc->src;
+    search_key.target_w = dsc->args.target_w;
+    search_key.target_h = dsc->args.target_h;
 
     lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
 
+    /*The image of a not scalable decoder is cached only for the full size*/
+    if(entry == NULL && (search_key.target_w != 0 || search_key.target_h != 0)) {
+        search_key.target_w = 0;
+        search_key.target_h = 0;
+        entry = lv_cache_acquire(cache, &search_key, NULL);
+        lv_image_cache_data_t * cached_data = entry ? lv_cache_entry_get_data(entry) : NULL;
+        if(cached_data && cached_data->decoder && cached_data->decoder->scalable) {
+            lv_cache_release(cache, entry, NULL);
+            entry = NULL;
+        }
+    }
+
     if(entry) {
         lv_image_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
         dsc->decoded = cached_data->decoded;
@@ -419,3 +740,161 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
 
     return LV_RESULT_INVALID;
 }
+
+/**
+ * Negative target sizes are used only internally to match all the sizes of an image in the caches
+ * @param args      the args to clamp
+ */
+static void clamp_target_size(lv_image_decoder_args_t * args)
+{
+    if(args->target_w < 0) args->target_w = 0;
+    if(args->target_h < 0) args->target_h = 0;
+}
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+static struct _lv_image_decoder_async_t * async_get(void)
+{
+    if(img_decoder_async_p) return img_decoder_async_p;
+
+    struct _lv_image_decoder_async_t * ctx = lv_malloc_zeroed(sizeof(struct _lv_image_decoder_async_t));
+    LV_ASSERT_MALLOC(ctx);
+    if(ctx == NULL) return NULL;
+
+    _lv_ll_init(&ctx->req_ll, sizeof(async_req_t));
+    ctx->timer = lv_timer_create(async_timer_cb, ASYNC_TIMER_PERIOD, ctx);
+    if(ctx->timer == NULL) {
+        lv_free(ctx);
+        return NULL;
+    }
+    lv_timer_pause(ctx->timer);
+
+#if LV_USE_OS != LV_OS_NONE
+    lv_mutex_init(&ctx->lock);
+    lv_thread_sync_init(&ctx->sync);
+    if(lv_thread_init(&ctx->thread, LV_THREAD_PRIO_LOW, async_thread_cb, LV_DRAW_THREAD_STACKSIZE,
+                      ctx) != LV_RESULT_OK) {
+        LV_LOG_ERROR("failed to create the image decoder thread");
+        lv_thread_sync_delete(&ctx->sync);
+        lv_mutex_delete(&ctx->lock);
+        lv_timer_delete(ctx->timer);
+        lv_free(ctx);
+        return NULL;
+    }
+#endif
+
+    img_decoder_async_p = ctx;
+    return ctx;
+}
+
+static void async_deinit(void)
+{
+    struct _lv_image_decoder_async_t * ctx = img_decoder_async_p;
+    if(ctx == NULL) return;
+
+#if LV_USE_OS != LV_OS_NONE
+    ctx->exit_status = true;
+    lv_thread_sync_signal(&ctx->sync);
+    lv_thread_delete(&ctx->thread);
+    lv_thread_sync_delete(&ctx->sync);
+    lv_mutex_delete(&ctx->lock);
+#endif
+
+    _lv_ll_clear_custom(&ctx->req_ll, (void (*)(void *))async_free_req);
+    lv_timer_delete(ctx->timer);
+    lv_free(ctx);
+    img_decoder_async_p = NULL;
+}
+
+static void async_decode(async_req_t * req)
+{
+    LV_PROFILER_BEGIN;
+
+    /*Opening adds the image to the cache, or just finds it there if it's already decoded*/
+    lv_image_decoder_dsc_t dsc;
+    req->res = lv_image_decoder_open(&dsc, req->src, req->has_args ? &req->args : NULL);
+    if(req->res == LV_RESULT_OK) lv_image_decoder_close(&dsc);
+
+    LV_PROFILER_END;
+}
+
+static void async_timer_cb(lv_timer_t * t)
+{
+    struct _lv_image_decoder_async_t * ctx = lv_timer_get_user_data(t);
+
+#if LV_USE_OS == LV_OS_NONE
+    /*Decode only one image in a cycle to keep the UI responsive*/
+    async_req_t * req_todo = _lv_ll_get_head(&ctx->req_ll);
+    if(req_todo && req_todo->state == ASYNC_STATE_QUEUED) {
+        async_decode(req_todo);
+        req_todo->state = ASYNC_STATE_READY;
+    }
+#endif
+
+    while(1) {
+#if LV_USE_OS != LV_OS_NONE
+        lv_mutex_lock(&ctx->lock);
+#endif
+        async_req_t * req = _lv_ll_get_head(&ctx->req_ll);
+        while(req && req->state != ASYNC_STATE_READY) req = _lv_ll_get_next(&ctx->req_ll, req);
+
+        async_req_t ready;
+        if(req) {
+            ready = *req;
+            _lv_ll_remove(&ctx->req_ll, req);
+            lv_free(req);
+        }
+#if LV_USE_OS != LV_OS_NONE
+        lv_mutex_unlock(&ctx->lock);
+#endif
+        if(req == NULL) break;
+
+        ctx->pending_cnt--;
+        if(ready.cb) ready.cb(ready.src, ready.res, ready.user_data);
+        if(ready.src_type == LV_IMAGE_SRC_FILE) lv_free((void *)ready.src);
+
+        /*The callback might have deinitialized LVGL*/
+        if(img_decoder_async_p != ctx) return;
+    }
+
+    if(ctx->pending_cnt == 0) lv_timer_pause(t);
+}
+
+static void async_free_req(async_req_t * req)
+{
+    if(req->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)req->src);
+    lv_free(req);
+}
+
+#if LV_USE_OS != LV_OS_NONE
+static void async_thread_cb(void * ptr)
+{
+    struct _lv_image_decoder_async_t * ctx = ptr;
+
+    while(1) {
+        lv_mutex_lock(&ctx->lock);
+        async_req_t * req = _lv_ll_get_head(&ctx->req_ll);
+        while(req && req->state != ASYNC_STATE_QUEUED) req = _lv_ll_get_next(&ctx->req_ll, req);
+        if(req) req->state = ASYNC_STATE_BUSY;
+        lv_mutex_unlock(&ctx->lock);
+
+        if(ctx->exit_status) break;
+
+        if(req == NULL) {
+            lv_thread_sync_wait(&ctx->sync);
+            continue;
+        }
+
+        /*`req` can't be freed while it's busy, so it's safe to use without the lock*/
+        async_decode(req);
+
+        lv_mutex_lock(&ctx->lock);
+        req->state = ASYNC_STATE_READY;
+        lv_mutex_unlock(&ctx->lock);
+    }
+
+    LV_LOG_INFO("exit image decoder thread");
+}
+#endif
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
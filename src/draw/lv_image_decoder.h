@@ -63,6 +63,9 @@ typedef struct _lv_image_decoder_args_t {
     bool no_cache;          /*When set, decoded image won't be put to cache, and decoder open will also ignore cache.*/
     bool use_indexed;       /*Decoded indexed image as is. Convert to ARGB8888 if false.*/
     bool flush_cache;       /*Whether to flush the data cache after decoding*/
+    bool allow_partial;     /*Large images can be decoded in bands via `get_area_cb`, so `decoded` can be NULL after open*/
+    int32_t target_w;       /*Decoders which can scale (see `scalable`) decode the image only this large. 0: full size*/
+    int32_t target_h;       /*The images decoded for different target sizes are cached separately*/
 } lv_image_decoder_args_t;
 
 /**
@@ -111,6 +114,10 @@ struct _lv_image_decoder_t {
 
     const char * name;
 
+    /*The decoder can decode the images with a lower resolution if `args.target_w/h` is set.
+     *Other decoders ignore the target size and their images are cached only once.*/
+    bool scalable;
+
     void * user_data;
 };
 
@@ -119,15 +126,32 @@ typedef struct _lv_image_decoder_cache_data_t {
 
     const void * src;
     lv_image_src_t src_type;
+    int32_t target_w;           /*The target size the image was decoded for. Always 0 if the decoder is not scalable*/
+    int32_t target_h;
 
     const lv_draw_buf_t * decoded;
     const lv_image_decoder_t * decoder;
     void * user_data;
 } lv_image_cache_data_t;
 
+typedef struct _lv_image_decoder_band_cache_data_t {
+    lv_cache_slot_size_t slot;
+
+    const char * src;           /*Only files are decoded in bands*/
+    int32_t x;                  /*The first column of the band in the image*/
+    int32_t y;                  /*The first row of the band in the image*/
+    int32_t w;                  /*The width of the band. The image's width if the rows are not cropped*/
+    int32_t target_w;           /*The target size the image was decoded for. Always 0 if the decoder is not scalable*/
+    int32_t target_h;
+
+    lv_draw_buf_t * decoded;
+} lv_image_band_cache_data_t;
+
 typedef struct _lv_image_decoder_header_cache_data_t {
     const void * src;
     lv_image_src_t src_type;
+    int32_t target_w;           /*The target size the header was read for. Always 0 if the decoder is not scalable*/
+    int32_t target_h;
 
     lv_image_header_t header;
     lv_image_decoder_t * decoder;
@@ -176,6 +200,28 @@ struct _lv_image_decoder_dsc_t {
     void * user_data;
 };
 
+/**
+ * Decode rows of an image into a band. Used by `lv_image_decoder_get_band`.
+ * @param decoder   pointer to the decoder
+ * @param dsc       pointer to the decoder descriptor
+ * @param band      decode `band->header.h` rows and `band->header.w` columns into this draw buffer
+ * @param x         the first column to decode. Always 0 if the bands are not cropped.
+ * @param y         the first row to decode
+ * @return          LV_RESULT_OK: the rows are decoded; LV_RESULT_INVALID: failed
+ */
+typedef lv_result_t (*lv_image_decoder_band_cb_t)(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                                  lv_draw_buf_t * band, int32_t x, int32_t y);
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+/**
+ * Called when an asynchronous decoding is ready
+ * @param src       the image source passed to `lv_image_decoder_decode_async`
+ * @param res       LV_RESULT_OK: the image is decoded and added to the image cache; LV_RESULT_INVALID: failed
+ * @param user_data the user data passed to `lv_image_decoder_decode_async`
+ */
+typedef void (*lv_image_decoder_async_cb_t)(const void * src, lv_result_t res, void * user_data);
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -184,8 +230,9 @@ struct _lv_image_decoder_dsc_t {
  * Initialize the image decoder module
  * @param image_cache_size    Image cache size in bytes. 0 to disable cache.
  * @param image_header_count  Number of header cache entries. 0 to disable header cache.
+ * @param image_band_cache_size Size of the cache of image bands in bytes. 0 to decode images entirely.
  */
-void _lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_count);
+void _lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_count, uint32_t image_band_cache_size);
 
 /**
  * Deinitialize the image decoder module
@@ -204,6 +251,17 @@ void _lv_image_decoder_deinit(void);
  */
 lv_result_t lv_image_decoder_get_info(const void * src, lv_image_header_t * header);
 
+/**
+ * Get information about an image as it will be decoded with the given args.
+ * E.g. a scalable decoder reports the reduced size if `args->target_w/h` is set.
+ * @param src       the image source, see `lv_image_decoder_get_info`
+ * @param args      args about how the image will be opened or NULL to use the default args
+ * @param header    the image info will be stored here
+ * @return          LV_RESULT_OK: success; LV_RESULT_INVALID: wasn't able to get info about the image
+ */
+lv_result_t lv_image_decoder_get_info_with_args(const void * src, const lv_image_decoder_args_t * args,
+                                                lv_image_header_t * header);
+
 /**
  * Open an image.
  * Try the created image decoders one by one. Once one is able to open the image that decoder is saved in `dsc`
@@ -236,6 +294,31 @@ lv_result_t lv_image_decoder_get_area(lv_image_decoder_dsc_t * dsc, const lv_are
  */
 void lv_image_decoder_close(lv_image_decoder_dsc_t * dsc);
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+/**
+ * Decode an image in the background and add it to the image cache, so that drawing it later
+ * won't block the rendering. With an OS the images are decoded one by one on a separate thread,
+ * else one image is decoded in each `lv_timer_handler` call.
+ * Should be called from the thread of `lv_timer_handler`.
+ * @param src       the image source. A file name is copied.
+ * @param args      args about how the image should be decoded or NULL to use the default args
+ * @param cb        called from `lv_timer_handler` when the decoding is ready. Can be NULL.
+ * @param user_data custom data passed to `cb`
+ * @return          LV_RESULT_OK: the decoding is queued;
+ *                  LV_RESULT_INVALID: the image cache is disabled or out of memory (`cb` won't be called)
+ */
+lv_result_t lv_image_decoder_decode_async(const void * src, const lv_image_decoder_args_t * args,
+                                          lv_image_decoder_async_cb_t cb, void * user_data);
+
+/**
+ * Don't call the callback of the pending asynchronous decodings started with `cb` and `user_data`.
+ * The decodings which haven't started yet are dropped.
+ * @param cb        the callback passed to `lv_image_decoder_decode_async`
+ * @param user_data the user data passed to `lv_image_decoder_decode_async`
+ */
+void lv_image_decoder_cancel_async(lv_image_decoder_async_cb_t cb, void * user_data);
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /**
  * Create a new image decoder
  * @return pointer to the new image decoder
@@ -296,6 +379,42 @@ lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
  */
 lv_draw_buf_t * lv_image_decoder_post_process(lv_image_decoder_dsc_t * dsc, lv_draw_buf_t * decoded);
 
+/**
+ * Tell whether a decoder should decode an image in horizontal bands in `get_area_cb`
+ * instead of decoding it entirely in `open_cb`. It's true if `dsc->args` allows partial decoding
+ * and the decoded image wouldn't fit into the band cache.
+ * @param dsc       pointer to a decoder descriptor
+ * @param cf        the color format of the decoded image
+ * @return          true: decode the image in bands
+ */
+bool lv_image_decoder_use_bands(const lv_image_decoder_dsc_t * dsc, lv_color_format_t cf);
+
+/**
+ * A `get_area_cb` helper for decoders decoding images in horizontal bands.
+ * Returns the next band covering `full_area` from the band cache or decodes it with `decode_cb`.
+ * The band is stored in `dsc->decoded` and it's kept in the cache until the next call or
+ * until closing the session.
+ * @param dsc           pointer to a decoder descriptor
+ * @param full_area     the area to decode, relative to the image
+ * @param decoded_area  `LV_COORD_MIN` on the first call, else the previously decoded area. The new area is stored here.
+ * @param cf            color format of the bands
+ * @param align         the height of the bands will be a multiple of this (e.g. JPEG MCU height)
+ * @param crop_align    0: the bands are as wide as the image; else the bands cover only the columns of
+ *                      `full_area`, extended to a multiple of this
+ * @param decode_cb     called to decode the rows of a band which is not cached
+ * @return              LV_RESULT_OK: a band is decoded; LV_RESULT_INVALID: error or `full_area` is fully decoded
+ */
+lv_result_t lv_image_decoder_get_band(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                      lv_area_t * decoded_area, lv_color_format_t cf, uint32_t align,
+                                      uint32_t crop_align, lv_image_decoder_band_cb_t decode_cb);
+
+/**
+ * Release the band used by the decoding session. Should be called from the `close_cb` of the
+ * decoders using `lv_image_decoder_get_band`.
+ * @param dsc           pointer to a decoder descriptor
+ */
+void lv_image_decoder_release_band(lv_image_decoder_dsc_t * dsc);
+
 /**********************
  *      MACROS
  **********************/
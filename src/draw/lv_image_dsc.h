@@ -38,7 +38,8 @@ typedef enum _lv_image_flags_t {
     /**
      * The image data is compressed, so decoder needs to decode image firstly.
      * If this flag is set, the whole image will be decompressed upon decode, and
-     * `get_area_cb` won't be necessary.
+     * `get_area_cb` won't be necessary. Only large files compressed in blocks
+     * of rows are decompressed in bands via `get_area_cb`.
      */
     LV_IMAGE_FLAGS_COMPRESSED       = 0x0008,
 
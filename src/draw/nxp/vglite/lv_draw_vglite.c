@@ -196,6 +196,7 @@ static int32_t _vglite_evaluate(lv_draw_unit_t * u, lv_draw_task_t * t)
             return 1;
 
         case LV_DRAW_TASK_TYPE_LINE:
+        case LV_DRAW_TASK_TYPE_POLYLINE:
         case LV_DRAW_TASK_TYPE_ARC:
         case LV_DRAW_TASK_TYPE_TRIANGLE:
             if(t->preference_score > 90) {
@@ -387,6 +388,9 @@ static void _vglite_execute_drawing(lv_draw_vglite_unit_t * u)
         case LV_DRAW_TASK_TYPE_LINE:
             lv_draw_vglite_line(draw_unit, t->draw_dsc);
             break;
+        case LV_DRAW_TASK_TYPE_POLYLINE:
+            lv_draw_vglite_polyline(draw_unit, t->draw_dsc);
+            break;
         case LV_DRAW_TASK_TYPE_LAYER:
             lv_draw_vglite_layer(draw_unit, t->draw_dsc, &t->area);
             break;
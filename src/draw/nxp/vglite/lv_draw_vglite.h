@@ -65,6 +65,8 @@ void lv_draw_vglite_layer(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
 
 void lv_draw_vglite_line(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc);
 
+void lv_draw_vglite_polyline(lv_draw_unit_t * draw_unit, const lv_draw_polyline_dsc_t * dsc);
+
 void lv_draw_vglite_triangle(lv_draw_unit_t * draw_unit, const lv_draw_triangle_dsc_t * dsc);
 
 /**********************
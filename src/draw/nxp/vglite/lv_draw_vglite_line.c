@@ -34,13 +34,13 @@
 /**
  * Draw line shape with effects
  *
- * @param[in] point1 Starting point with relative coordinates
- * @param[in] point2 Ending point with relative coordinates
+ * @param[in] line_path VG path of the line (move to the first point, line to the next points)
+ * @param[in] path_size Size of the path in bytes
  * @param[in] clip_area Clip area with relative coordinates to dest buff
  * @param[in] dsc Line description structure (width, rounded ending, opacity, ...)
  *
  */
-static void _vglite_draw_line(const lv_point_t * point1, const lv_point_t * point2,
+static void _vglite_draw_line(const int32_t * line_path, uint32_t path_size,
                               const lv_area_t * clip_area, const lv_draw_line_dsc_t * dsc);
 
 /**********************
@@ -76,17 +76,69 @@ void lv_draw_vglite_line(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t *
 
     lv_area_move(&clip_area, -layer->buf_area.x1, -layer->buf_area.y1);
 
-    lv_point_t point1 = {dsc->p1.x - layer->buf_area.x1, dsc->p1.y - layer->buf_area.y1};
-    lv_point_t point2 = {dsc->p2.x - layer->buf_area.x1, dsc->p2.y - layer->buf_area.y1};
+    int32_t line_path[] = { /*VG line path*/
+        VLC_OP_MOVE, dsc->p1.x - layer->buf_area.x1, dsc->p1.y - layer->buf_area.y1,
+        VLC_OP_LINE, dsc->p2.x - layer->buf_area.x1, dsc->p2.y - layer->buf_area.y1,
+        VLC_OP_END
+    };
+
+    _vglite_draw_line(line_path, sizeof(line_path), &clip_area, dsc);
+}
+
+void lv_draw_vglite_polyline(lv_draw_unit_t * draw_unit, const lv_draw_polyline_dsc_t * dsc)
+{
+    if(dsc->line.width == 0)
+        return;
+    if(dsc->line.opa <= (lv_opa_t)LV_OPA_MIN)
+        return;
+
+    lv_layer_t * layer = draw_unit->target_layer;
+    lv_area_t clip_area;
+    clip_area.x1 = dsc->points[0].x;
+    clip_area.x2 = dsc->points[0].x;
+    clip_area.y1 = dsc->points[0].y;
+    clip_area.y2 = dsc->points[0].y;
+
+    uint32_t i;
+    for(i = 1; i < dsc->point_cnt; i++) {
+        clip_area.x1 = LV_MIN(clip_area.x1, dsc->points[i].x);
+        clip_area.x2 = LV_MAX(clip_area.x2, dsc->points[i].x);
+        clip_area.y1 = LV_MIN(clip_area.y1, dsc->points[i].y);
+        clip_area.y2 = LV_MAX(clip_area.y2, dsc->points[i].y);
+    }
+
+    lv_area_increase(&clip_area, dsc->line.width / 2, dsc->line.width / 2);
 
-    _vglite_draw_line(&point1, &point2, &clip_area, dsc);
+    if(!_lv_area_intersect(&clip_area, &clip_area, draw_unit->clip_area))
+        return; /*Fully clipped, nothing to do*/
+
+    lv_area_move(&clip_area, -layer->buf_area.x1, -layer->buf_area.y1);
+
+    /*Stroke all the points as a single path: an opcode and 2 coordinates per point and the end opcode*/
+    uint32_t path_size = (dsc->point_cnt * 3 + 1) * sizeof(int32_t);
+    int32_t * line_path = lv_malloc(path_size);
+    LV_ASSERT_MALLOC(line_path);
+    if(line_path == NULL)
+        return;
+
+    uint32_t idx = 0;
+    for(i = 0; i < dsc->point_cnt; i++) {
+        line_path[idx++] = i == 0 ? VLC_OP_MOVE : VLC_OP_LINE;
+        line_path[idx++] = (int32_t)dsc->points[i].x - layer->buf_area.x1;
+        line_path[idx++] = (int32_t)dsc->points[i].y - layer->buf_area.y1;
+    }
+    line_path[idx++] = VLC_OP_END;
+
+    _vglite_draw_line(line_path, path_size, &clip_area, &dsc->line);
+
+    lv_free(line_path);
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
-static void _vglite_draw_line(const lv_point_t * point1, const lv_point_t * point2,
+static void _vglite_draw_line(const int32_t * line_path, uint32_t path_size,
                               const lv_area_t * clip_area, const lv_draw_line_dsc_t * dsc)
 {
     vg_lite_path_t path;
@@ -111,13 +163,7 @@ static void _vglite_draw_line(const lv_point_t * point1, const lv_point_t * poin
     /*** Init path ***/
     int32_t width = dsc->width;
 
-    int32_t line_path[] = { /*VG line path*/
-        VLC_OP_MOVE, point1->x, point1->y,
-        VLC_OP_LINE, point2->x, point2->y,
-        VLC_OP_END
-    };
-
-    VGLITE_CHECK_ERROR(vg_lite_init_path(&path, VG_LITE_S32, VG_LITE_HIGH, sizeof(line_path), line_path,
+    VGLITE_CHECK_ERROR(vg_lite_init_path(&path, VG_LITE_S32, VG_LITE_HIGH, path_size, (void *)line_path,
                                          (vg_lite_float_t)clip_area->x1, (vg_lite_float_t)clip_area->y1,
                                          ((vg_lite_float_t)clip_area->x2) + 1.0f, ((vg_lite_float_t)clip_area->y2) + 1.0f));
 
@@ -301,7 +301,8 @@ static int32_t _dave2d_evaluate(lv_draw_unit_t * u, lv_draw_task_t * t)
                 break;
             }
 
-        case LV_DRAW_TASK_TYPE_LINE: {
+        case LV_DRAW_TASK_TYPE_LINE:
+        case LV_DRAW_TASK_TYPE_POLYLINE: {
 #if USE_D2
                 t->preferred_draw_unit_id = DRAW_UNIT_ID_DAVE2D;
                 t->preference_score = 0;
@@ -503,6 +504,9 @@ static void execute_drawing(lv_draw_dave2d_unit_t * u)
         case LV_DRAW_TASK_TYPE_LINE:
             lv_draw_dave2d_line(u, t->draw_dsc);
             break;
+        case LV_DRAW_TASK_TYPE_POLYLINE:
+            lv_draw_dave2d_polyline(u, t->draw_dsc);
+            break;
         case LV_DRAW_TASK_TYPE_ARC:
             lv_draw_dave2d_arc(u, t->draw_dsc, &t->area);
             break;
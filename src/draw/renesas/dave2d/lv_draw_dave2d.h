@@ -62,6 +62,8 @@ void lv_draw_dave2d_arc(lv_draw_dave2d_unit_t * draw_unit, const lv_draw_arc_dsc
 
 void lv_draw_dave2d_line(lv_draw_dave2d_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc);
 
+void lv_draw_dave2d_polyline(lv_draw_dave2d_unit_t * draw_unit, const lv_draw_polyline_dsc_t * dsc);
+
 void lv_draw_dave2d_layer(lv_draw_dave2d_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
                           const lv_area_t * coords);
 
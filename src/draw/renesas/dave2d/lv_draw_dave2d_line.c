@@ -1,7 +1,24 @@
 #include "lv_draw_dave2d.h"
 #if LV_USE_DRAW_DAVE2D
 
+static void dave2d_render_lines(lv_draw_dave2d_unit_t * u, const lv_draw_line_dsc_t * dsc,
+                                const lv_point_precise_t points[], uint32_t point_cnt);
+
 void lv_draw_dave2d_line(lv_draw_dave2d_unit_t * u, const lv_draw_line_dsc_t * dsc)
+{
+    lv_point_precise_t points[2] = {dsc->p1, dsc->p2};
+
+    dave2d_render_lines(u, dsc, points, 2);
+}
+
+void lv_draw_dave2d_polyline(lv_draw_dave2d_unit_t * u, const lv_draw_polyline_dsc_t * dsc)
+{
+    dave2d_render_lines(u, &dsc->line, dsc->points, dsc->point_cnt);
+}
+
+/*Render the lines between the consecutive points with a single set of render operations*/
+static void dave2d_render_lines(lv_draw_dave2d_unit_t * u, const lv_draw_line_dsc_t * dsc,
+                                const lv_point_precise_t points[], uint32_t point_cnt)
 {
 
     lv_area_t clip_line;
@@ -9,17 +26,21 @@ void lv_draw_dave2d_line(lv_draw_dave2d_unit_t * u, const lv_draw_line_dsc_t * d
     d2_s32 result;
     lv_area_t buffer_area;
     uint32_t res;
-    lv_value_precise_t p1_x;
-    lv_value_precise_t p1_y;
-    lv_value_precise_t p2_x;
-    lv_value_precise_t p2_y;
     int32_t x;
     int32_t y;
-
-    clip_line.x1 = LV_MIN(dsc->p1.x, dsc->p2.x) - dsc->width / 2;
-    clip_line.x2 = LV_MAX(dsc->p1.x, dsc->p2.x) + dsc->width / 2;
-    clip_line.y1 = LV_MIN(dsc->p1.y, dsc->p2.y) - dsc->width / 2;
-    clip_line.y2 = LV_MAX(dsc->p1.y, dsc->p2.y) + dsc->width / 2;
+    uint32_t i;
+
+    clip_line.x1 = (int32_t)points[0].x;
+    clip_line.x2 = (int32_t)points[0].x;
+    clip_line.y1 = (int32_t)points[0].y;
+    clip_line.y2 = (int32_t)points[0].y;
+    for(i = 1; i < point_cnt; i++) {
+        clip_line.x1 = LV_MIN(clip_line.x1, (int32_t)points[i].x);
+        clip_line.x2 = LV_MAX(clip_line.x2, (int32_t)points[i].x);
+        clip_line.y1 = LV_MIN(clip_line.y1, (int32_t)points[i].y);
+        clip_line.y2 = LV_MAX(clip_line.y2, (int32_t)points[i].y);
+    }
+    lv_area_increase(&clip_line, dsc->width / 2, dsc->width / 2);
 
     bool is_common;
     is_common = _lv_area_intersect(&clip_line, &clip_line, u->base_unit.clip_area);
@@ -34,10 +55,6 @@ void lv_draw_dave2d_line(lv_draw_dave2d_unit_t * u, const lv_draw_line_dsc_t * d
 #endif
 
     buffer_area = u->base_unit.target_layer->buf_area;
-    p1_x = dsc->p1.x - buffer_area.x1;
-    p1_y = dsc->p1.y - buffer_area.y1;
-    p2_x = dsc->p2.x - buffer_area.x1;
-    p2_y = dsc->p2.y - buffer_area.y1;
 
     x = 0 - u->base_unit.target_layer->buf_area.x1;
     y = 0 - u->base_unit.target_layer->buf_area.y1;
@@ -75,8 +92,15 @@ void lv_draw_dave2d_line(lv_draw_dave2d_unit_t * u, const lv_draw_line_dsc_t * d
 
     d2_setlinecap(u->d2_handle, mode);
 
-    d2_renderline(u->d2_handle, D2_FIX4(p1_x), D2_FIX4(p1_y), D2_FIX4(p2_x),
-                  D2_FIX4(p2_y), D2_FIX4(dsc->width), d2_le_exclude_none);
+    for(i = 1; i < point_cnt; i++) {
+        lv_value_precise_t p1_x = points[i - 1].x + x;
+        lv_value_precise_t p1_y = points[i - 1].y + y;
+        lv_value_precise_t p2_x = points[i].x + x;
+        lv_value_precise_t p2_y = points[i].y + y;
+
+        d2_renderline(u->d2_handle, D2_FIX4(p1_x), D2_FIX4(p1_y), D2_FIX4(p2_x),
+                      D2_FIX4(p2_y), D2_FIX4(dsc->width), d2_le_exclude_none);
+    }
 
     //
     // Execute render operations
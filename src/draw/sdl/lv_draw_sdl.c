@@ -383,6 +383,7 @@ static void execute_drawing(lv_draw_sdl_unit_t * u)
 
     if(t->type == LV_DRAW_TASK_TYPE_BOX_SHADOW) return;
     if(t->type == LV_DRAW_TASK_TYPE_LINE) return;
+    if(t->type == LV_DRAW_TASK_TYPE_POLYLINE) return;
     if(t->type == LV_DRAW_TASK_TYPE_TRIANGLE) return;
 
     if(t->type == LV_DRAW_TASK_TYPE_LAYER) {
@@ -140,7 +140,7 @@ void lv_draw_sw_init(void)
         draw_sw_unit->base_unit.dispatch_cb = dispatch;
         draw_sw_unit->base_unit.evaluate_cb = evaluate;
         draw_sw_unit->idx = i;
-        draw_sw_unit->base_unit.delete_cb = LV_USE_OS ? lv_draw_sw_delete : NULL;
+        draw_sw_unit->base_unit.delete_cb = lv_draw_sw_delete;
 
 #if LV_USE_OS
         lv_thread_init(&draw_sw_unit->thread, LV_THREAD_PRIO_HIGH, render_thread_cb, LV_DRAW_THREAD_STACKSIZE, draw_sw_unit);
@@ -148,13 +148,15 @@ void lv_draw_sw_init(void)
     }
 
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
-    tvg_engine_init(TVG_ENGINE_SW, 0);
+    tvg_engine_init(TVG_ENGINE_SW, LV_USE_OS ? LV_THORVG_THREAD_CNT : 0);
+    _lv_draw_sw_vector_init();
 #endif
 }
 
 void lv_draw_sw_deinit(void)
 {
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+    _lv_draw_sw_vector_deinit();
     tvg_engine_term(TVG_ENGINE_SW);
 #endif
 
@@ -175,9 +177,11 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
         lv_thread_sync_signal(&draw_sw_unit->sync);
     }
 
-    return lv_thread_delete(&draw_sw_unit->thread);
+    lv_result_t res = lv_thread_delete(&draw_sw_unit->thread);
+    _lv_draw_sw_glyph_atlas_deinit(draw_unit);
+    return res;
 #else
-    LV_UNUSED(draw_unit);
+    _lv_draw_sw_glyph_atlas_deinit(draw_unit);
     return 0;
 #endif
 }
@@ -385,6 +389,9 @@ static void execute_drawing(lv_draw_sw_unit_t * u)
         case LV_DRAW_TASK_TYPE_LINE:
             lv_draw_sw_line((lv_draw_unit_t *)u, t->draw_dsc);
             break;
+        case LV_DRAW_TASK_TYPE_POLYLINE:
+            lv_draw_sw_polyline((lv_draw_unit_t *)u, t->draw_dsc);
+            break;
         case LV_DRAW_TASK_TYPE_TRIANGLE:
             lv_draw_sw_triangle((lv_draw_unit_t *)u, t->draw_dsc);
             break;
@@ -31,6 +31,36 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE
+typedef struct {
+    const lv_font_t * font;     /**< NULL if the slot is free*/
+    uint32_t letter;
+    uint16_t x;
+    uint16_t y;
+} lv_draw_sw_glyph_atlas_entry_t;
+
+typedef struct {
+    uint8_t * buf;                                  /**< A8 pixels, LV_DRAW_SW_GLYPH_ATLAS_SIZE is the stride*/
+    lv_draw_sw_glyph_atlas_entry_t * entries;       /**< Open addressing hash table of the stored glyphs*/
+    uint32_t entry_cnt;
+    uint32_t entry_cap;                             /**< Power of 2*/
+    uint32_t generation;                            /**< Reset the atlas if it differs from the global generation*/
+    int32_t shelf_x;                                /**< Glyphs are packed in rows (shelves) from left to right*/
+    int32_t shelf_y;
+    int32_t shelf_h;
+    lv_draw_buf_t * staging_buf;                    /**< Get the bitmaps from the fonts here*/
+    lv_draw_buf_t view;                             /**< Points to a glyph in `buf`*/
+
+    /*The glyphs of the current text run*/
+    uint8_t * run_buf;
+    uint32_t run_buf_size;
+    lv_area_t run_area;                             /**< `x2` is the last written column*/
+    lv_color_t run_color;
+    lv_opa_t run_opa;
+    bool run_active;
+} lv_draw_sw_glyph_atlas_t;
+#endif
+
 typedef struct {
     lv_draw_unit_t base_unit;
     lv_draw_task_t * task_act;
@@ -41,6 +71,9 @@ typedef struct {
     volatile bool exit_status;
 #endif
     uint32_t idx;
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE
+    lv_draw_sw_glyph_atlas_t glyph_atlas;
+#endif
 } lv_draw_sw_unit_t;
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
@@ -107,6 +140,19 @@ void lv_draw_sw_image(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * dr
  */
 void lv_draw_sw_label(lv_draw_unit_t * draw_unit, const lv_draw_label_dsc_t * dsc, const lv_area_t * coords);
 
+/**
+ * Drop all glyphs from the glyph atlases of the SW draw units.
+ * Needs to be called when a font is deleted or its glyphs are changed.
+ * Does nothing if `LV_DRAW_SW_GLYPH_ATLAS_SIZE` is 0.
+ */
+void lv_draw_sw_glyph_atlas_drop(void);
+
+/**
+ * Free the glyph atlas of a SW draw unit. Called internally.
+ * @param draw_unit     pointer to a SW draw unit
+ */
+void _lv_draw_sw_glyph_atlas_deinit(lv_draw_unit_t * draw_unit);
+
 /**
  * Draw an arc with SW render.
  * @param draw_unit     pointer to a draw unit
@@ -122,6 +168,13 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
  */
 void lv_draw_sw_line(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc);
 
+/**
+ * Draw a polyline with SW render.
+ * @param draw_unit     pointer to a draw unit
+ * @param dsc           the draw descriptor
+ */
+void lv_draw_sw_polyline(lv_draw_unit_t * draw_unit, const lv_draw_polyline_dsc_t * dsc);
+
 /**
  * Blend a layer with SW render
  * @param draw_unit     pointer to a draw unit
@@ -169,6 +222,22 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
  * @param dsc           the draw descriptor
  */
 void lv_draw_sw_vector(lv_draw_unit_t * draw_unit, const lv_draw_vector_task_dsc_t * dsc);
+
+/**
+ * Drop all coverage masks from the vector path cache.
+ * Does nothing if `LV_DRAW_SW_VECTOR_CACHE_SIZE` is 0.
+ */
+void lv_draw_sw_vector_cache_drop(void);
+
+/**
+ * Create the vector path cache. Called internally.
+ */
+void _lv_draw_sw_vector_init(void);
+
+/**
+ * Free the vector path cache. Called internally.
+ */
+void _lv_draw_sw_vector_deinit(void);
 #endif
 
 /**
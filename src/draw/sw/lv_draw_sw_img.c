@@ -42,10 +42,24 @@
     #define LV_DRAW_SW_RGB888_RECOLOR(...)  LV_RESULT_INVALID
 #endif
 
+#ifndef LV_DRAW_SW_YUV_TO_XRGB8888
+    #define LV_DRAW_SW_YUV_TO_XRGB8888(...)  LV_RESULT_INVALID
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*The samples of a row of a YUV image*/
+typedef struct {
+    const uint8_t * y;
+    const uint8_t * u;      /*NULL if there is no chroma*/
+    const uint8_t * v;
+    uint32_t y_step;        /*Distance of the Y samples in bytes*/
+    uint32_t uv_step;       /*Distance of the U and V samples in bytes*/
+    uint32_t uv_shift;      /*2^uv_shift pixels share a U and V sample horizontally*/
+} yuv_row_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -53,6 +67,12 @@
 static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
                           const lv_image_decoder_dsc_t * decoder_dsc, lv_draw_image_sup_t * sup,
                           const lv_area_t * img_coords, const lv_area_t * clipped_img_area);
+static lv_draw_buf_t * yuv_convert_image(const lv_draw_buf_t * decoded);
+static void yuv_to_xrgb8888(lv_color_format_t cf, const uint8_t * src_buf, uint32_t src_stride,
+                            const lv_area_t * src_area, uint8_t * dest_buf, uint32_t dest_stride);
+static bool yuv_get_row(lv_color_format_t cf, const uint8_t * src_buf, uint32_t src_stride, int32_t y,
+                        yuv_row_t * row);
+static void yuv_row_to_xrgb8888(const yuv_row_t * row, int32_t x, int32_t w, uint8_t * dest);
 
 /**********************
  *  STATIC VARIABLES
@@ -188,6 +208,18 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
     uint32_t img_stride = decoded->header.stride;
     lv_color_format_t cf = decoded->header.cf;
 
+    /*The transformation and the bitmap mask need the whole image in RGB.
+     *Else only the visible part is converted while blending.*/
+    lv_draw_buf_t * yuv_converted = NULL;
+    if(LV_COLOR_FORMAT_IS_YUV(cf) && (transformed || masked)) {
+        yuv_converted = yuv_convert_image(decoded);
+        if(yuv_converted == NULL) return;
+
+        src_buf = yuv_converted->data;
+        img_stride = yuv_converted->header.stride;
+        cf = yuv_converted->header.cf;
+    }
+
     lv_memzero(&blend_dsc, sizeof(lv_draw_sw_blend_dsc_t));
     blend_dsc.opa = draw_dsc->opa;
     blend_dsc.blend_mode = draw_dsc->blend_mode;
@@ -228,7 +260,8 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
         lv_draw_sw_blend(draw_unit, &blend_dsc);
     }
     /*The simplest case just copy the pixels into the draw_buf. Blending will convert the colors if needed*/
-    else if(!transformed && !masked && draw_dsc->recolor_opa <= LV_OPA_MIN && draw_dsc->colorkey == NULL) {
+    else if(!transformed && !masked && draw_dsc->recolor_opa <= LV_OPA_MIN && draw_dsc->colorkey == NULL &&
+            !LV_COLOR_FORMAT_IS_YUV(cf)) {
         blend_dsc.src_area = img_coords;
         blend_dsc.src_buf = src_buf;
         blend_dsc.blend_area = img_coords;
@@ -278,6 +311,9 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
             if(cf == LV_COLOR_FORMAT_RGB888 || cf == LV_COLOR_FORMAT_XRGB8888) cf_final = LV_COLOR_FORMAT_ARGB8888;
             else if(cf == LV_COLOR_FORMAT_RGB565) cf_final = LV_COLOR_FORMAT_RGB565A8;
         }
+        else if(LV_COLOR_FORMAT_IS_YUV(cf)) {
+            cf_final = LV_COLOR_FORMAT_XRGB8888;
+        }
 
         uint8_t * tmp_buf;
         uint32_t px_size = lv_color_format_get_size(cf_final);
@@ -333,6 +369,13 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
                 lv_draw_sw_transform(draw_unit, &relative_area, src_buf, src_w, src_h, img_stride,
                                      draw_dsc, sup, cf, tmp_buf);
             }
+            else if(LV_COLOR_FORMAT_IS_YUV(cf)) {
+                uint32_t dest_stride = blend_w * px_size;
+                if(LV_RESULT_INVALID == LV_DRAW_SW_YUV_TO_XRGB8888(cf, src_buf, img_stride, &relative_area, tmp_buf,
+                                                                   dest_stride)) {
+                    yuv_to_xrgb8888(cf, src_buf, img_stride, &relative_area, tmp_buf, dest_stride);
+                }
+            }
             else if(draw_dsc->recolor_opa >= LV_OPA_MIN || draw_dsc->colorkey) {
                 int32_t h = lv_area_get_height(&relative_area);
                 if(cf_final == LV_COLOR_FORMAT_RGB565A8) {
@@ -459,6 +502,158 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
 
         lv_free(tmp_buf);
     }
+
+    if(yuv_converted) lv_draw_buf_destroy(yuv_converted);
+}
+
+/**
+ * Convert a whole YUV image to XRGB8888
+ * @param decoded   the YUV image
+ * @return          the converted image, NULL on error
+ */
+static lv_draw_buf_t * yuv_convert_image(const lv_draw_buf_t * decoded)
+{
+    lv_draw_buf_t * converted = lv_draw_buf_create(decoded->header.w, decoded->header.h, LV_COLOR_FORMAT_XRGB8888,
+                                                   LV_STRIDE_AUTO);
+    if(converted == NULL) {
+        LV_LOG_WARN("No memory to convert the YUV image");
+        return NULL;
+    }
+
+    lv_area_t area = {0, 0, decoded->header.w - 1, decoded->header.h - 1};
+    yuv_to_xrgb8888(decoded->header.cf, decoded->data, decoded->header.stride, &area, converted->data,
+                    converted->header.stride);
+
+    return converted;
+}
+
+/**
+ * Convert an area of a YUV image to XRGB8888.
+ * The colors are converted according to BT.601 with limited (16..235) range.
+ * @param cf            a YUV color format
+ * @param src_buf       the pixels of packed formats, or an `lv_yuv_buf_t` describing the planes
+ * @param src_stride    stride of packed formats
+ * @param src_area      the area to convert relative to the image
+ * @param dest_buf      write the XRGB8888 pixels here
+ * @param dest_stride   stride of `dest_buf` in bytes
+ */
+static void yuv_to_xrgb8888(lv_color_format_t cf, const uint8_t * src_buf, uint32_t src_stride,
+                            const lv_area_t * src_area, uint8_t * dest_buf, uint32_t dest_stride)
+{
+    int32_t w = lv_area_get_width(src_area);
+    int32_t y;
+    for(y = src_area->y1; y <= src_area->y2; y++) {
+        yuv_row_t row;
+        if(yuv_get_row(cf, src_buf, src_stride, y, &row)) {
+            yuv_row_to_xrgb8888(&row, src_area->x1, w, dest_buf);
+        }
+        else {
+            lv_memzero(dest_buf, w * 4);
+        }
+        dest_buf += dest_stride;
+    }
+}
+
+static bool yuv_get_row(lv_color_format_t cf, const uint8_t * src_buf, uint32_t src_stride, int32_t y,
+                        yuv_row_t * row)
+{
+    const lv_yuv_buf_t * yuv = (const lv_yuv_buf_t *)src_buf;
+
+    switch(cf) {
+        case LV_COLOR_FORMAT_I420:
+        case LV_COLOR_FORMAT_I422:
+        case LV_COLOR_FORMAT_I444: {
+                int32_t uv_y = cf == LV_COLOR_FORMAT_I420 ? y / 2 : y;
+                row->y = (const uint8_t *)yuv->planar.y.buf + y * yuv->planar.y.stride;
+                row->u = (const uint8_t *)yuv->planar.u.buf + uv_y * yuv->planar.u.stride;
+                row->v = (const uint8_t *)yuv->planar.v.buf + uv_y * yuv->planar.v.stride;
+                row->y_step = 1;
+                row->uv_step = 1;
+                row->uv_shift = cf == LV_COLOR_FORMAT_I444 ? 0 : 1;
+                return true;
+            }
+        case LV_COLOR_FORMAT_I400:
+            row->y = (const uint8_t *)yuv->planar.y.buf + y * yuv->planar.y.stride;
+            row->u = NULL;
+            row->v = NULL;
+            row->y_step = 1;
+            row->uv_step = 0;
+            row->uv_shift = 0;
+            return true;
+        case LV_COLOR_FORMAT_NV12:
+        case LV_COLOR_FORMAT_NV21: {
+                const uint8_t * uv = (const uint8_t *)yuv->semi_planar.uv.buf + (y / 2) * yuv->semi_planar.uv.stride;
+                row->y = (const uint8_t *)yuv->semi_planar.y.buf + y * yuv->semi_planar.y.stride;
+                row->u = cf == LV_COLOR_FORMAT_NV12 ? uv : uv + 1;
+                row->v = cf == LV_COLOR_FORMAT_NV12 ? uv + 1 : uv;
+                row->y_step = 1;
+                row->uv_step = 2;
+                row->uv_shift = 1;
+                return true;
+            }
+        case LV_COLOR_FORMAT_YUY2:
+        case LV_COLOR_FORMAT_UYVY: {
+                const uint8_t * px = src_buf + y * src_stride;
+                row->y = cf == LV_COLOR_FORMAT_YUY2 ? px : px + 1;
+                row->u = cf == LV_COLOR_FORMAT_YUY2 ? px + 1 : px;
+                row->v = row->u + 2;
+                row->y_step = 2;
+                row->uv_step = 4;
+                row->uv_shift = 1;
+                return true;
+            }
+        default:
+            LV_LOG_WARN("Not supported YUV format: %d", cf);
+            return false;
+    }
+}
+
+/**
+ * Convert `w` pixels of a YUV row starting from `x`
+ */
+static void yuv_row_to_xrgb8888(const yuv_row_t * row, int32_t x, int32_t w, uint8_t * dest)
+{
+    const uint8_t * y_src = row->y + x * row->y_step;
+    int32_t i;
+
+    if(row->u == NULL) {
+        for(i = 0; i < w; i++) {
+            int32_t c = ((int32_t)y_src[0] - 16) * 298 + 128;
+            uint8_t l = (uint8_t)LV_CLAMP(0, c >> 8, 255);
+            dest[0] = l;
+            dest[1] = l;
+            dest[2] = l;
+            dest[3] = 0xff;
+            y_src += row->y_step;
+            dest += 4;
+        }
+        return;
+    }
+
+    /*The chroma terms are calculated once for the pixels sharing them*/
+    int32_t r_add = 0;
+    int32_t g_add = 0;
+    int32_t b_add = 0;
+    int32_t uv_x_prev = -1;
+    for(i = 0; i < w; i++) {
+        int32_t uv_x = (x + i) >> row->uv_shift;
+        if(uv_x != uv_x_prev) {
+            int32_t d = (int32_t)row->u[uv_x * row->uv_step] - 128;
+            int32_t e = (int32_t)row->v[uv_x * row->uv_step] - 128;
+            r_add = 409 * e;
+            g_add = -100 * d - 208 * e;
+            b_add = 516 * d;
+            uv_x_prev = uv_x;
+        }
+
+        int32_t c = ((int32_t)y_src[0] - 16) * 298 + 128;
+        dest[0] = (uint8_t)LV_CLAMP(0, (c + b_add) >> 8, 255);
+        dest[1] = (uint8_t)LV_CLAMP(0, (c + g_add) >> 8, 255);
+        dest[2] = (uint8_t)LV_CLAMP(0, (c + r_add) >> 8, 255);
+        dest[3] = 0xff;
+        y_src += row->y_step;
+        dest += 4;
+    }
 }
 
 #endif /*LV_USE_DRAW_SW*/
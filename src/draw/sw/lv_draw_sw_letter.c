@@ -17,11 +17,22 @@
 #include "../../font/lv_font.h"
 #include "../../core/lv_refr.h"
 #include "../../stdlib/lv_string.h"
+#include "../../core/lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
 
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE
+#define ATLAS_SIZE      LV_DRAW_SW_GLYPH_ATLAS_SIZE
+
+/*Assume 8x8 pixels per glyph in average*/
+#define ATLAS_GLYPH_CNT_EST     LV_MAX((ATLAS_SIZE * ATLAS_SIZE) / 64, 48)
+
+#define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+#define atlas_generation (LV_GLOBAL_DEFAULT()->sw_glyph_atlas_generation)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -33,6 +44,17 @@
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_cb(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_draw_dsc,
                                                        lv_draw_fill_dsc_t * fill_draw_dsc, const lv_area_t * fill_area);
 
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE
+static lv_draw_buf_t * glyph_bitmap_cb(lv_draw_unit_t * draw_unit, lv_font_glyph_dsc_t * g, uint32_t letter);
+static void atlas_reset(lv_draw_sw_glyph_atlas_t * atlas);
+static lv_draw_sw_glyph_atlas_entry_t * atlas_find(lv_draw_sw_glyph_atlas_t * atlas, const lv_font_t * font,
+                                                   uint32_t letter);
+static bool atlas_alloc(lv_draw_sw_glyph_atlas_t * atlas, int32_t w, int32_t h, int32_t * x, int32_t * y);
+static bool run_add(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_draw_dsc);
+static void run_flush(lv_draw_unit_t * draw_unit);
+static inline uint32_t next_pow2(uint32_t v);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -54,10 +76,43 @@ void lv_draw_sw_label(lv_draw_unit_t * draw_unit, const lv_draw_label_dsc_t * ds
     if(dsc->opa <= LV_OPA_MIN) return;
 
     LV_PROFILER_DRAW_BEGIN;
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE
+    lv_draw_sw_glyph_atlas_t * atlas = &((lv_draw_sw_unit_t *)draw_unit)->glyph_atlas;
+    if(atlas->generation != atlas_generation) {
+        atlas_reset(atlas);
+        atlas->generation = atlas_generation;
+    }
+
+    lv_draw_label_iterate_characters_ex(draw_unit, dsc, coords, draw_letter_cb, glyph_bitmap_cb);
+    run_flush(draw_unit);
+#else
     lv_draw_label_iterate_characters(draw_unit, dsc, coords, draw_letter_cb);
+#endif
     LV_PROFILER_DRAW_END;
 }
 
+void lv_draw_sw_glyph_atlas_drop(void)
+{
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE
+    /*The atlases are used by the render threads, so just mark them as outdated*/
+    atlas_generation++;
+#endif
+}
+
+void _lv_draw_sw_glyph_atlas_deinit(lv_draw_unit_t * draw_unit)
+{
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE
+    lv_draw_sw_glyph_atlas_t * atlas = &((lv_draw_sw_unit_t *)draw_unit)->glyph_atlas;
+    lv_free(atlas->buf);
+    lv_free(atlas->entries);
+    lv_free(atlas->run_buf);
+    if(atlas->staging_buf) lv_draw_buf_destroy_user(font_draw_buf_handlers, atlas->staging_buf);
+    lv_memzero(atlas, sizeof(lv_draw_sw_glyph_atlas_t));
+#else
+    LV_UNUSED(draw_unit);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -65,6 +120,14 @@ void lv_draw_sw_label(lv_draw_unit_t * draw_unit, const lv_draw_label_dsc_t * ds
 static void LV_ATTRIBUTE_FAST_MEM draw_letter_cb(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_draw_dsc,
                                                  lv_draw_fill_dsc_t * fill_draw_dsc, const lv_area_t * fill_area)
 {
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE
+    /*Keep the drawing order: draw the glyphs collected so far before anything else*/
+    if(glyph_draw_dsc == NULL || glyph_draw_dsc->format == LV_FONT_GLYPH_FORMAT_NONE ||
+       glyph_draw_dsc->format == LV_FONT_GLYPH_FORMAT_IMAGE) {
+        run_flush(draw_unit);
+    }
+#endif
+
     if(glyph_draw_dsc) {
         switch(glyph_draw_dsc->format) {
             case LV_FONT_GLYPH_FORMAT_NONE: {
@@ -83,6 +146,9 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_cb(lv_draw_unit_t * draw_unit, lv_
             case LV_FONT_GLYPH_FORMAT_A2:
             case LV_FONT_GLYPH_FORMAT_A4:
             case LV_FONT_GLYPH_FORMAT_A8: {
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE
+                    if(run_add(draw_unit, glyph_draw_dsc)) break;
+#endif
                     lv_area_t mask_area = *glyph_draw_dsc->letter_coords;
                     mask_area.x2 = mask_area.x1 + lv_draw_buf_width_to_stride(lv_area_get_width(&mask_area), LV_COLOR_FORMAT_A8) - 1;
                     lv_draw_sw_blend_dsc_t blend_dsc;
@@ -123,4 +189,246 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_cb(lv_draw_unit_t * draw_unit, lv_
     }
 }
 
+#if LV_DRAW_SW_GLYPH_ATLAS_SIZE
+
+static lv_draw_buf_t * glyph_bitmap_cb(lv_draw_unit_t * draw_unit, lv_font_glyph_dsc_t * g, uint32_t letter)
+{
+    lv_draw_sw_glyph_atlas_t * atlas = &((lv_draw_sw_unit_t *)draw_unit)->glyph_atlas;
+
+    if(g->box_w > ATLAS_SIZE || g->box_h > ATLAS_SIZE) return NULL;
+
+    if(atlas->buf == NULL) {
+        /*Keep the hash table at most 75% full*/
+        atlas->entry_cap = next_pow2(ATLAS_GLYPH_CNT_EST * 4 / 3);
+        atlas->buf = lv_malloc(ATLAS_SIZE * ATLAS_SIZE);
+        atlas->entries = lv_malloc(atlas->entry_cap * sizeof(lv_draw_sw_glyph_atlas_entry_t));
+        if(atlas->buf == NULL || atlas->entries == NULL) {
+            LV_LOG_WARN("couldn't allocate the glyph atlas");
+            lv_free(atlas->buf);
+            lv_free(atlas->entries);
+            atlas->buf = NULL;
+            atlas->entries = NULL;
+            return NULL;
+        }
+        atlas_reset(atlas);
+    }
+
+    lv_draw_sw_glyph_atlas_entry_t * entry = atlas_find(atlas, g->resolved_font, letter);
+    if(entry->font == NULL) {
+        int32_t x;
+        int32_t y;
+        if(atlas->entry_cnt >= atlas->entry_cap / 4 * 3 || !atlas_alloc(atlas, g->box_w, g->box_h, &x, &y)) {
+            /*The atlas is full. Start again with the glyphs in use now.*/
+            atlas_reset(atlas);
+            entry = atlas_find(atlas, g->resolved_font, letter);
+            if(!atlas_alloc(atlas, g->box_w, g->box_h, &x, &y)) return NULL;
+        }
+
+        /*The fonts write the bitmap with their own stride, so get it into a separate buffer first*/
+        lv_draw_buf_t * staging_buf = lv_draw_buf_reshape(atlas->staging_buf, 0, g->box_w, g->box_h, LV_STRIDE_AUTO);
+        if(staging_buf == NULL) {
+            if(atlas->staging_buf) lv_draw_buf_destroy_user(font_draw_buf_handlers, atlas->staging_buf);
+            staging_buf = lv_draw_buf_create_user(font_draw_buf_handlers, g->box_w, g->box_h, LV_COLOR_FORMAT_A8,
+                                                  LV_STRIDE_AUTO);
+            atlas->staging_buf = staging_buf;
+            if(staging_buf == NULL) return NULL;
+        }
+
+        const lv_draw_buf_t * bitmap = lv_font_get_glyph_bitmap(g, letter, staging_buf);
+        if(bitmap == NULL) {
+            lv_font_glyph_release_draw_data(g);
+            return NULL;
+        }
+
+        const uint8_t * src = bitmap->data;
+        uint8_t * dest = atlas->buf + y * ATLAS_SIZE + x;
+        int32_t row;
+        for(row = 0; row < g->box_h; row++) {
+            lv_memcpy(dest, src, g->box_w);
+            src += bitmap->header.stride;
+            dest += ATLAS_SIZE;
+        }
+
+        lv_font_glyph_release_draw_data(g);
+
+        entry->font = g->resolved_font;
+        entry->letter = letter;
+        entry->x = (uint16_t)x;
+        entry->y = (uint16_t)y;
+        atlas->entry_cnt++;
+    }
+
+    lv_draw_buf_t * view = &atlas->view;
+    view->header.magic = LV_IMAGE_HEADER_MAGIC;
+    view->header.cf = LV_COLOR_FORMAT_A8;
+    view->header.w = g->box_w;
+    view->header.h = g->box_h;
+    view->header.stride = ATLAS_SIZE;
+    view->data = atlas->buf + entry->y * ATLAS_SIZE + entry->x;
+    view->data_size = (g->box_h - 1) * ATLAS_SIZE + g->box_w;
+    view->unaligned_data = view->data;
+
+    return view;
+}
+
+static void atlas_reset(lv_draw_sw_glyph_atlas_t * atlas)
+{
+    if(atlas->entries) lv_memzero(atlas->entries, atlas->entry_cap * sizeof(lv_draw_sw_glyph_atlas_entry_t));
+    atlas->entry_cnt = 0;
+    atlas->shelf_x = 0;
+    atlas->shelf_y = 0;
+    atlas->shelf_h = 0;
+}
+
+static lv_draw_sw_glyph_atlas_entry_t * atlas_find(lv_draw_sw_glyph_atlas_t * atlas, const lv_font_t * font,
+                                                   uint32_t letter)
+{
+    uint32_t mask = atlas->entry_cap - 1;
+    uint32_t hash = (((uint32_t)(lv_uintptr_t)font >> 4) ^ letter) * 2654435761u;
+    uint32_t i = hash & mask;
+
+    /*The table is never full, so a free slot is always found*/
+    while(atlas->entries[i].font) {
+        if(atlas->entries[i].font == font && atlas->entries[i].letter == letter) break;
+        i = (i + 1) & mask;
+    }
+
+    return &atlas->entries[i];
+}
+
+static bool atlas_alloc(lv_draw_sw_glyph_atlas_t * atlas, int32_t w, int32_t h, int32_t * x, int32_t * y)
+{
+    if(atlas->shelf_x + w > ATLAS_SIZE) {
+        atlas->shelf_y += atlas->shelf_h;
+        atlas->shelf_x = 0;
+        atlas->shelf_h = 0;
+    }
+
+    if(atlas->shelf_y + h > ATLAS_SIZE) return false;
+
+    *x = atlas->shelf_x;
+    *y = atlas->shelf_y;
+    atlas->shelf_x += w;
+    if(h > atlas->shelf_h) atlas->shelf_h = h;
+
+    return true;
+}
+
+/**
+ * Collect an A8 glyph into the mask of the current text run.
+ * The glyphs are only copied next to each other, so the run is blended
+ * exactly as if the glyphs were drawn one by one.
+ * Layers with alpha channel are not batched as blending the uncovered pixels
+ * between the glyphs would change the color of their fully transparent pixels.
+ * @param draw_unit         pointer to a SW draw unit
+ * @param glyph_draw_dsc    the glyph to add
+ * @return                  true: the glyph is handled; false: draw it directly
+ */
+static bool run_add(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_draw_dsc)
+{
+    lv_draw_sw_glyph_atlas_t * atlas = &((lv_draw_sw_unit_t *)draw_unit)->glyph_atlas;
+    const lv_area_t * letter_coords = glyph_draw_dsc->letter_coords;
+    const lv_area_t * clip_area = draw_unit->clip_area;
+
+    if(lv_color_format_has_alpha(draw_unit->target_layer->color_format)) return false;
+
+    lv_area_t glyph_area;
+    if(!_lv_area_intersect(&glyph_area, letter_coords, clip_area)) return true;
+
+    /*Glyphs overlapping the previous ones, a new color or a new line start a new run*/
+    if(atlas->run_active) {
+        if(glyph_area.x1 <= atlas->run_area.x2 ||
+           glyph_area.y1 < atlas->run_area.y1 || glyph_area.y2 > atlas->run_area.y2 ||
+           glyph_draw_dsc->opa != atlas->run_opa || !lv_color_eq(glyph_draw_dsc->color, atlas->run_color)) {
+            run_flush(draw_unit);
+        }
+    }
+
+    int32_t run_stride = lv_area_get_width(clip_area);
+    if(!atlas->run_active) {
+        lv_area_t run_area;
+        run_area.x1 = glyph_area.x1;
+        run_area.x2 = clip_area->x2;
+        run_area.y1 = LV_MIN(glyph_draw_dsc->bg_coords->y1, letter_coords->y1);
+        run_area.y2 = LV_MAX(glyph_draw_dsc->bg_coords->y2, letter_coords->y2);
+        if(!_lv_area_intersect(&run_area, &run_area, clip_area)) return true;
+
+        uint32_t size = run_stride * lv_area_get_height(&run_area);
+        if(size > atlas->run_buf_size) {
+            uint8_t * run_buf = lv_realloc(atlas->run_buf, size);
+            if(run_buf == NULL) return false;
+            atlas->run_buf = run_buf;
+            atlas->run_buf_size = size;
+        }
+
+        /*Nothing is written yet*/
+        run_area.x2 = run_area.x1 - 1;
+        atlas->run_area = run_area;
+        atlas->run_color = glyph_draw_dsc->color;
+        atlas->run_opa = glyph_draw_dsc->opa;
+        atlas->run_active = true;
+    }
+
+    /*Clear the columns between the previous and this glyph*/
+    const lv_area_t * run_area = &atlas->run_area;
+    int32_t run_h = lv_area_get_height(run_area);
+    int32_t row;
+    uint8_t * run_buf = atlas->run_buf + (run_area->x2 + 1 - run_area->x1);
+    int32_t clear_w = glyph_area.x2 - run_area->x2;
+    for(row = 0; row < run_h; row++) {
+        lv_memzero(run_buf, clear_w);
+        run_buf += run_stride;
+    }
+
+    lv_draw_buf_t * draw_buf = glyph_draw_dsc->glyph_data;
+    uint32_t glyph_stride = draw_buf->header.stride;
+    const uint8_t * glyph_buf = draw_buf->data;
+    glyph_buf += glyph_stride * (glyph_area.y1 - letter_coords->y1) + (glyph_area.x1 - letter_coords->x1);
+    run_buf = atlas->run_buf + run_stride * (glyph_area.y1 - run_area->y1) + (glyph_area.x1 - run_area->x1);
+    int32_t glyph_w = lv_area_get_width(&glyph_area);
+    int32_t glyph_h = lv_area_get_height(&glyph_area);
+    for(row = 0; row < glyph_h; row++) {
+        lv_memcpy(run_buf, glyph_buf, glyph_w);
+        glyph_buf += glyph_stride;
+        run_buf += run_stride;
+    }
+
+    atlas->run_area.x2 = glyph_area.x2;
+
+    return true;
+}
+
+static void run_flush(lv_draw_unit_t * draw_unit)
+{
+    lv_draw_sw_glyph_atlas_t * atlas = &((lv_draw_sw_unit_t *)draw_unit)->glyph_atlas;
+    if(!atlas->run_active) return;
+    atlas->run_active = false;
+
+    if(atlas->run_area.x2 < atlas->run_area.x1) return;
+
+    lv_area_t mask_area = atlas->run_area;
+    mask_area.x2 = mask_area.x1 + lv_area_get_width(draw_unit->clip_area) - 1;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = atlas->run_color;
+    blend_dsc.opa = atlas->run_opa;
+    blend_dsc.mask_buf = atlas->run_buf;
+    blend_dsc.mask_area = &mask_area;
+    blend_dsc.mask_stride = lv_area_get_width(draw_unit->clip_area);
+    blend_dsc.blend_area = &atlas->run_area;
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+
+    lv_draw_sw_blend(draw_unit, &blend_dsc);
+}
+
+static inline uint32_t next_pow2(uint32_t v)
+{
+    uint32_t p = 1;
+    while(p < v) p <<= 1;
+    return p;
+}
+
+#endif /*LV_DRAW_SW_GLYPH_ATLAS_SIZE*/
+
 #endif /*LV_USE_DRAW_SW*/
@@ -95,6 +95,23 @@ void lv_draw_sw_line(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc)
     LV_PROFILER_DRAW_END;
 }
 
+void lv_draw_sw_polyline(lv_draw_unit_t * draw_unit, const lv_draw_polyline_dsc_t * dsc)
+{
+    if(dsc->line.width == 0) return;
+    if(dsc->line.opa <= LV_OPA_MIN) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+    /*Draw the segments one by one. Segments out of the clip area return early in `lv_draw_sw_line`*/
+    lv_draw_line_dsc_t line_dsc = dsc->line;
+    uint32_t i;
+    for(i = 1; i < dsc->point_cnt; i++) {
+        line_dsc.p1 = dsc->points[i - 1];
+        line_dsc.p2 = dsc->points[i];
+        lv_draw_sw_line(draw_unit, &line_dsc);
+    }
+    LV_PROFILER_DRAW_END;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -16,9 +16,17 @@
 #endif
 #include "../../stdlib/lv_string.h"
 
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+    #include <math.h>
+    #include <float.h>
+    #include "../../core/lv_global.h"
+    #define vector_cache LV_GLOBAL_DEFAULT()->sw_vector_cache
+#endif
+
 /*********************
  *      DEFINES
  *********************/
+#define VECTOR_CACHE_NAME "SW_VECTOR_PATH"
 
 /**********************
  *      TYPEDEFS
@@ -37,9 +45,54 @@ typedef struct {
     uint8_t a;
 } _tvg_color;
 
+typedef struct {
+    Tvg_Canvas * canvas;
+    lv_layer_t * layer;
+    lv_area_t target_area;      /**< The area of the layer drawn by ThorVG with absolute coordinates*/
+    bool pending;               /**< Shapes were pushed to the canvas but not drawn yet*/
+} _tvg_draw_ctx;
+
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+/*Everything which affects the coverage of a path. Followed by the ops, the points and the dash pattern*/
+typedef struct {
+    lv_matrix_t matrix;
+    lv_area_t area;
+    float stroke_width;
+    float miter_limit;
+    uint32_t op_cnt;
+    uint32_t point_cnt;
+    uint32_t dash_cnt;
+    uint8_t is_stroke;
+    uint8_t fill_rule;
+    uint8_t cap;
+    uint8_t join;
+} _vector_cache_key_t;
+
+typedef struct {
+    lv_cache_slot_size_t slot;          /**< Must be the first field: used by the size based cache*/
+    uint32_t hash;
+    uint32_t key_size;
+    _vector_cache_key_t * key;
+    lv_area_t area;                     /**< The area of the mask in the coordinates of the layer buffer*/
+    lv_draw_buf_t * mask;               /**< The A8 coverage of the path*/
+
+    /*Used only while the mask is created*/
+    const lv_vector_path_t * path;
+    const lv_vector_draw_dsc_t * dsc;
+} _vector_cache_data_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void _flush_canvas(_tvg_draw_ctx * ctx);
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+    static bool _draw_cached(_tvg_draw_ctx * ctx, const lv_vector_path_t * path, const lv_vector_draw_dsc_t * dsc);
+    static bool _vector_cache_create_cb(_vector_cache_data_t * data, void * user_data);
+    static void _vector_cache_free_cb(_vector_cache_data_t * data, void * user_data);
+    static lv_cache_compare_res_t _vector_cache_compare_cb(const _vector_cache_data_t * lhs,
+                                                           const _vector_cache_data_t * rhs);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -368,7 +421,12 @@ static void _set_paint_blend_mode(Tvg_Paint * obj, lv_vector_blend_t blend)
 
 static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_vector_draw_dsc_t * dsc)
 {
-    Tvg_Canvas * canvas = (Tvg_Canvas *)ctx;
+    _tvg_draw_ctx * draw_ctx = (_tvg_draw_ctx *)ctx;
+    Tvg_Canvas * canvas = draw_ctx->canvas;
+
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+    if(path && _draw_cached(draw_ctx, path, dsc)) return;
+#endif
 
     Tvg_Paint * obj = tvg_shape_new();
 
@@ -401,6 +459,7 @@ static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_ve
     }
 
     tvg_canvas_push(canvas, obj);
+    draw_ctx->pending = true;
 }
 
 /**********************
@@ -433,18 +492,440 @@ void lv_draw_sw_vector(lv_draw_unit_t * draw_unit, const lv_draw_vector_task_dsc
     Tvg_Canvas * canvas = tvg_swcanvas_create();
     tvg_swcanvas_set_target(canvas, buf, stride / 4, width, height, TVG_COLORSPACE_ARGB8888);
 
-    lv_ll_t * task_list = dsc->task_list;
-    _lv_vector_for_each_destroy_tasks(task_list, _task_draw_cb, canvas);
+    _tvg_draw_ctx ctx;
+    ctx.canvas = canvas;
+    ctx.layer = layer;
+    ctx.pending = false;
+    lv_area_set(&ctx.target_area, layer->buf_area.x1, layer->buf_area.y1,
+                layer->buf_area.x1 + width - 1, layer->buf_area.y1 + height - 1);
 
-    if(tvg_canvas_draw(canvas) == TVG_RESULT_SUCCESS) {
-        tvg_canvas_sync(canvas);
-    }
+    lv_ll_t * task_list = dsc->task_list;
+    _lv_vector_for_each_destroy_tasks(task_list, _task_draw_cb, &ctx);
 
+    _flush_canvas(&ctx);
     tvg_canvas_destroy(canvas);
 }
 
+void lv_draw_sw_vector_cache_drop(void)
+{
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+    if(vector_cache) lv_cache_drop_all(vector_cache, NULL);
+#endif
+}
+
+void _lv_draw_sw_vector_init(void)
+{
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)_vector_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)_vector_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)_vector_cache_free_cb,
+    };
+
+    vector_cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(_vector_cache_data_t),
+                                   LV_DRAW_SW_VECTOR_CACHE_SIZE, ops);
+    lv_cache_set_name(vector_cache, VECTOR_CACHE_NAME);
+#endif
+}
+
+void _lv_draw_sw_vector_deinit(void)
+{
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+    if(vector_cache) {
+        lv_cache_destroy(vector_cache, NULL);
+        vector_cache = NULL;
+    }
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Draw the shapes pushed to the canvas so far and remove them from the canvas
+ * @param ctx       the draw context
+ */
+static void _flush_canvas(_tvg_draw_ctx * ctx)
+{
+    if(!ctx->pending) return;
+
+    if(tvg_canvas_draw(ctx->canvas) == TVG_RESULT_SUCCESS) {
+        tvg_canvas_sync(ctx->canvas);
+    }
+    tvg_canvas_clear(ctx->canvas, true);
+    ctx->pending = false;
+}
+
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+
+static bool _is_visible(lv_vector_draw_style_t style, const lv_color32_t * color, lv_opa_t opa)
+{
+    return style != LV_VECTOR_DRAW_STYLE_SOLID || LV_OPA_MIX2(color->alpha, opa) > LV_OPA_TRANSP;
+}
+
+/**
+ * Get the area covered by a path in the coordinates of the layer buffer.
+ * The control points are used, so the area might be larger than needed.
+ * @param area          store the area here
+ * @param path          the path
+ * @param dsc           the draw descriptor of the path
+ * @param is_stroke     true: get the area of the stroke; false: get the area of the fill
+ * @param clip_area     the area drawn by ThorVG in the coordinates of the layer buffer
+ * @return              false if the path is empty, invisible or its mask would be too large to cache
+ */
+static bool _get_path_area(lv_area_t * area, const lv_vector_path_t * path, const lv_vector_draw_dsc_t * dsc,
+                           bool is_stroke, const lv_area_t * clip_area)
+{
+    uint32_t cnt = lv_array_size(&path->points);
+    if(cnt == 0) return false;
+
+    /*Transform the points the same way as ThorVG does*/
+    const lv_matrix_t * m = &dsc->matrix;
+    const lv_fpoint_t * points = lv_array_front(&path->points);
+    float x1 = FLT_MAX;
+    float y1 = FLT_MAX;
+    float x2 = -FLT_MAX;
+    float y2 = -FLT_MAX;
+    for(uint32_t i = 0; i < cnt; i++) {
+        float x = points[i].x * m->m[0][0] + points[i].y * m->m[0][1] + m->m[0][2];
+        float y = points[i].x * m->m[1][0] + points[i].y * m->m[1][1] + m->m[1][2];
+        x1 = LV_MIN(x1, x);
+        y1 = LV_MIN(y1, y);
+        x2 = LV_MAX(x2, x);
+        y2 = LV_MAX(y2, y);
+    }
+
+    if(is_stroke) {
+        /*The Frobenius norm is an upper bound of the scaling of the matrix.
+         *Square caps stick out by sqrt(2) * width / 2, miter joins by miter_limit * width / 2*/
+        float scale = sqrtf(m->m[0][0] * m->m[0][0] + m->m[0][1] * m->m[0][1] +
+                            m->m[1][0] * m->m[1][0] + m->m[1][1] * m->m[1][1]);
+        float ext = dsc->stroke_dsc.width / 2 * scale * 1.5f;
+        if(dsc->stroke_dsc.join == LV_VECTOR_STROKE_JOIN_MITER && dsc->stroke_dsc.miter_limit > 1) {
+            ext *= dsc->stroke_dsc.miter_limit;
+        }
+        x1 -= ext;
+        y1 -= ext;
+        x2 += ext;
+        y2 += ext;
+    }
+
+    /*Also rejects NaN*/
+    if(!(x1 > LV_COORD_MIN && y1 > LV_COORD_MIN && x2 < LV_COORD_MAX && y2 < LV_COORD_MAX)) return false;
+
+    /*Keep 1 px for anti-aliasing*/
+    area->x1 = (int32_t)floorf(x1) - 1;
+    area->y1 = (int32_t)floorf(y1) - 1;
+    area->x2 = (int32_t)ceilf(x2) + 1;
+    area->y2 = (int32_t)ceilf(y2) + 1;
+
+    /*ThorVG calculates the coverage differently where the path is clipped,
+     *so render the mask clipped to the same edges*/
+    if(!_lv_area_intersect(area, area, clip_area)) return false;
+    if(lv_area_get_size(area) > LV_DRAW_SW_VECTOR_CACHE_SIZE / 2) return false;
+
+    return true;
+}
+
+/**
+ * Collect everything which affects the coverage of the fill or the stroke of a path
+ * @param search        set the key, its size and hash here. Its area has to be set already.
+ * @param path          the path
+ * @param dsc           the draw descriptor of the path
+ * @param is_stroke     true: the key of the stroke; false: the key of the fill
+ * @return              false if out of memory
+ */
+static bool _make_key(_vector_cache_data_t * search, const lv_vector_path_t * path, const lv_vector_draw_dsc_t * dsc,
+                      bool is_stroke)
+{
+    uint32_t op_cnt = lv_array_size(&path->ops);
+    uint32_t point_cnt = lv_array_size(&path->points);
+    uint32_t dash_cnt = is_stroke ? lv_array_size(&dsc->stroke_dsc.dash_pattern) : 0;
+    uint32_t key_size = sizeof(_vector_cache_key_t) + op_cnt * sizeof(lv_vector_path_op_t) +
+                        point_cnt * sizeof(lv_fpoint_t) + dash_cnt * sizeof(float);
+
+    _vector_cache_key_t * key = lv_malloc_zeroed(key_size);
+    if(key == NULL) return false;
+
+    lv_memcpy(&key->matrix, &dsc->matrix, sizeof(lv_matrix_t));
+    key->area = search->area;
+    key->op_cnt = op_cnt;
+    key->point_cnt = point_cnt;
+    key->dash_cnt = dash_cnt;
+    key->is_stroke = is_stroke;
+    if(is_stroke) {
+        key->stroke_width = dsc->stroke_dsc.width;
+        key->miter_limit = dsc->stroke_dsc.miter_limit;
+        key->cap = dsc->stroke_dsc.cap;
+        key->join = dsc->stroke_dsc.join;
+    }
+    else {
+        key->fill_rule = dsc->fill_dsc.fill_rule;
+    }
+
+    uint8_t * p = (uint8_t *)(key + 1);
+    if(op_cnt) lv_memcpy(p, lv_array_front(&path->ops), op_cnt * sizeof(lv_vector_path_op_t));
+    p += op_cnt * sizeof(lv_vector_path_op_t);
+    if(point_cnt) lv_memcpy(p, lv_array_front(&path->points), point_cnt * sizeof(lv_fpoint_t));
+    p += point_cnt * sizeof(lv_fpoint_t);
+    if(dash_cnt) lv_memcpy(p, lv_array_front(&dsc->stroke_dsc.dash_pattern), dash_cnt * sizeof(float));
+
+    /*FNV-1a*/
+    uint32_t hash = 2166136261u;
+    const uint8_t * k = (const uint8_t *)key;
+    for(uint32_t i = 0; i < key_size; i++) {
+        hash = (hash ^ k[i]) * 16777619u;
+    }
+
+    search->key = key;
+    search->key_size = key_size;
+    search->hash = hash;
+    return true;
+}
+
+/**
+ * Scale the channels of a premultiplied ARGB8888 color. The same as `ALPHA_BLEND` of ThorVG.
+ */
+static inline uint32_t _alpha_blend(uint32_t c, uint32_t a)
+{
+    return (((((c >> 8) & 0x00ff00ff) * a + 0x00ff00ff) & 0xff00ff00) +
+            ((((c & 0x00ff00ff) * a + 0x00ff00ff) >> 8) & 0x00ff00ff));
+}
+
+/**
+ * Fill a color on the layer through the cached coverage of a path.
+ * The pixels are calculated the same way as ThorVG fills the spans of a solid shape.
+ * @param ctx       the draw context
+ * @param data      the cached coverage
+ * @param color     the color of the fill or stroke
+ * @param opa       the opacity of the fill or stroke
+ * @param aliased   true: fill the partially covered pixels too as if they were fully covered
+ */
+static void _blend_mask(_tvg_draw_ctx * ctx, const _vector_cache_data_t * data, const lv_color32_t * color,
+                        lv_opa_t opa, bool aliased)
+{
+    lv_layer_t * layer = ctx->layer;
+    lv_area_t mask_area = data->area;
+    lv_area_move(&mask_area, layer->buf_area.x1, layer->buf_area.y1);
+
+    lv_area_t blend_area;
+    if(!_lv_area_intersect(&blend_area, &mask_area, &ctx->target_area)) return;
+
+    uint32_t a = LV_OPA_MIX2(color->alpha, opa);
+    uint32_t r = color->red;
+    uint32_t g = color->green;
+    uint32_t b = color->blue;
+    if(a < 255) {
+        r = (r * a + 0xff) >> 8;
+        g = (g * a + 0xff) >> 8;
+        b = (b * a + 0xff) >> 8;
+    }
+    uint32_t c = (a << 24) | (r << 16) | (g << 8) | b;
+
+    int32_t w = lv_area_get_width(&blend_area);
+    for(int32_t y = blend_area.y1; y <= blend_area.y2; y++) {
+        const uint8_t * cov = lv_draw_buf_goto_xy(data->mask, blend_area.x1 - mask_area.x1, y - mask_area.y1);
+        uint32_t * dest = lv_draw_buf_goto_xy(layer->draw_buf, blend_area.x1 - layer->buf_area.x1,
+                                              y - layer->buf_area.y1);
+        for(int32_t x = 0; x < w; x++) {
+            if(cov[x] == 0) continue;
+            uint32_t src = (cov[x] == 255 || aliased) ? c : _alpha_blend(c, cov[x]);
+            dest[x] = src + _alpha_blend(dest[x], (~src) >> 24);
+        }
+    }
+}
+
+/**
+ * Get the cached coverage of the fill or the stroke of a path. Create it if it's not cached yet.
+ * @param path          the path
+ * @param dsc           the draw descriptor of the path
+ * @param is_stroke     true: the coverage of the stroke; false: the coverage of the fill
+ * @param clip_area     the area drawn by ThorVG in the coordinates of the layer buffer
+ * @param entry         store the acquired cache entry here. Release it after blending.
+ * @return              the cached coverage or NULL if it can't be cached
+ */
+static _vector_cache_data_t * _get_mask(const lv_vector_path_t * path, const lv_vector_draw_dsc_t * dsc,
+                                        bool is_stroke, const lv_area_t * clip_area, lv_cache_entry_t ** entry)
+{
+    _vector_cache_data_t search;
+    lv_memzero(&search, sizeof(search));
+    if(!_get_path_area(&search.area, path, dsc, is_stroke, clip_area)) return NULL;
+    if(!_make_key(&search, path, dsc, is_stroke)) return NULL;
+
+    int32_t w = lv_area_get_width(&search.area);
+    int32_t h = lv_area_get_height(&search.area);
+    search.slot.size = sizeof(lv_draw_buf_t) + lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8) * h + search.key_size;
+    search.path = path;
+    search.dsc = dsc;
+
+    *entry = lv_cache_acquire_or_create(vector_cache, &search, NULL);
+    lv_free(search.key);
+    if(*entry == NULL) return NULL;
+
+    return lv_cache_entry_get_data(*entry);
+}
+
+/**
+ * Draw a path by blending its color through its cached coverage.
+ * Only solid colors with normal blending are drawn this way.
+ * @param ctx       the draw context
+ * @param path      the path
+ * @param dsc       the draw descriptor of the path
+ * @return          false if the path wasn't drawn and ThorVG should draw it
+ */
+static bool _draw_cached(_tvg_draw_ctx * ctx, const lv_vector_path_t * path, const lv_vector_draw_dsc_t * dsc)
+{
+    if(vector_cache == NULL) return false;
+    if(dsc->blend_mode != LV_VECTOR_BLEND_SRC_OVER) return false;
+
+    const lv_vector_fill_dsc_t * fill_dsc = &dsc->fill_dsc;
+    const lv_vector_stroke_dsc_t * stroke_dsc = &dsc->stroke_dsc;
+    bool has_fill = _is_visible(fill_dsc->style, &fill_dsc->color, fill_dsc->opa);
+    bool has_stroke = _is_visible(stroke_dsc->style, &stroke_dsc->color, stroke_dsc->opa) && stroke_dsc->width > 0;
+    if(has_fill && fill_dsc->style != LV_VECTOR_DRAW_STYLE_SOLID) return false;
+    if(has_stroke && stroke_dsc->style != LV_VECTOR_DRAW_STYLE_SOLID) return false;
+
+    lv_area_t clip_area = ctx->target_area;
+    lv_area_move(&clip_area, -ctx->layer->buf_area.x1, -ctx->layer->buf_area.y1);
+
+    lv_cache_entry_t * fill_entry = NULL;
+    lv_cache_entry_t * stroke_entry = NULL;
+    _vector_cache_data_t * fill_data = NULL;
+    _vector_cache_data_t * stroke_data = NULL;
+
+    if(has_fill) {
+        fill_data = _get_mask(path, dsc, false, &clip_area, &fill_entry);
+        if(fill_data == NULL) return false;
+    }
+
+    if(has_stroke) {
+        stroke_data = _get_mask(path, dsc, true, &clip_area, &stroke_entry);
+        if(stroke_data == NULL) {
+            if(fill_entry) lv_cache_release(vector_cache, fill_entry, NULL);
+            return false;
+        }
+    }
+
+    /*Keep the order of drawing*/
+    _flush_canvas(ctx);
+
+    if(fill_data) {
+        /*Like ThorVG, don't anti-alias the edges of the fill if a wide enough stroke covers them*/
+        const lv_matrix_t * m = &dsc->matrix;
+        bool aliased = has_stroke && lv_array_is_empty(&stroke_dsc->dash_pattern) &&
+                       stroke_dsc->width * sqrtf(m->m[0][0] * m->m[0][0] + m->m[0][1] * m->m[0][1]) >= 2.0f;
+        _blend_mask(ctx, fill_data, &fill_dsc->color, fill_dsc->opa, aliased);
+        lv_cache_release(vector_cache, fill_entry, NULL);
+    }
+
+    if(stroke_data) {
+        _blend_mask(ctx, stroke_data, &stroke_dsc->color, stroke_dsc->opa, false);
+        lv_cache_release(vector_cache, stroke_entry, NULL);
+    }
+
+    return true;
+}
+
+/*-----------------
+ * Cache Callbacks
+ *----------------*/
+
+static bool _vector_cache_create_cb(_vector_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    int32_t w = lv_area_get_width(&data->area);
+    int32_t h = lv_area_get_height(&data->area);
+
+    _vector_cache_key_t * key = lv_malloc(data->key_size);
+    uint32_t * argb = lv_malloc_zeroed(w * h * sizeof(uint32_t));
+    lv_draw_buf_t * mask = lv_draw_buf_create(w, h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    if(key == NULL || argb == NULL || mask == NULL) {
+        LV_LOG_WARN("couldn't allocate the coverage of a %" LV_PRId32 "x%" LV_PRId32 " path", w, h);
+        lv_free(key);
+        lv_free(argb);
+        if(mask) lv_draw_buf_destroy(mask);
+        return false;
+    }
+
+    /*The data is a copy of the search key, so keep the key for the later searches*/
+    lv_memcpy(key, data->key, data->key_size);
+    data->key = key;
+    data->mask = mask;
+
+    /*Render the path with opaque white into the origin of a temporary buffer*/
+    lv_matrix_t matrix;
+    lv_matrix_identity(&matrix);
+    lv_matrix_translate(&matrix, (float) - data->area.x1, (float) - data->area.y1);
+    lv_matrix_multiply(&matrix, &data->dsc->matrix);
+
+    Tvg_Canvas * canvas = tvg_swcanvas_create();
+    tvg_swcanvas_set_target(canvas, argb, w, w, h, TVG_COLORSPACE_ARGB8888);
+
+    Tvg_Paint * obj = tvg_shape_new();
+    Tvg_Matrix mtx;
+    _lv_matrix_to_tvg(&mtx, &matrix);
+    _set_paint_matrix(obj, &mtx);
+    _set_paint_shape(obj, data->path);
+
+    if(key->is_stroke) {
+        tvg_shape_set_fill_color(obj, 0, 0, 0, 0);
+        _set_paint_stroke(obj, &data->dsc->stroke_dsc);
+        /*Not the mixed opacity of the stroke as it would be less than 255*/
+        tvg_shape_set_stroke_color(obj, 0xff, 0xff, 0xff, 0xff);
+    }
+    else {
+        tvg_shape_set_fill_rule(obj, _lv_fill_rule_to_tvg(data->dsc->fill_dsc.fill_rule));
+        tvg_shape_set_fill_color(obj, 0xff, 0xff, 0xff, 0xff);
+    }
+
+    tvg_canvas_push(canvas, obj);
+    if(tvg_canvas_draw(canvas) == TVG_RESULT_SUCCESS) {
+        tvg_canvas_sync(canvas);
+    }
+    tvg_canvas_destroy(canvas);
+
+    /*The alpha channel is the coverage*/
+    for(int32_t y = 0; y < h; y++) {
+        uint8_t * dest = lv_draw_buf_goto_xy(mask, 0, y);
+        const uint32_t * src = &argb[y * w];
+        for(int32_t x = 0; x < w; x++) {
+            dest[x] = src[x] >> 24;
+        }
+    }
+
+    lv_free(argb);
+    data->path = NULL;
+    data->dsc = NULL;
+    return true;
+}
+
+static void _vector_cache_free_cb(_vector_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_draw_buf_destroy(data->mask);
+    lv_free(data->key);
+}
+
+static lv_cache_compare_res_t _vector_cache_compare_cb(const _vector_cache_data_t * lhs,
+                                                       const _vector_cache_data_t * rhs)
+{
+    if(lhs->hash != rhs->hash) {
+        return lhs->hash > rhs->hash ? 1 : -1;
+    }
+    if(lhs->key_size != rhs->key_size) {
+        return lhs->key_size > rhs->key_size ? 1 : -1;
+    }
+
+    int32_t res = lv_memcmp(lhs->key, rhs->key, lhs->key_size);
+    if(res != 0) {
+        return res > 0 ? 1 : -1;
+    }
+    return 0;
+}
+
+#endif /*LV_DRAW_SW_VECTOR_CACHE_SIZE > 0*/
+
 #endif /*LV_USE_DRAW_SW*/
@@ -184,6 +184,9 @@ static void draw_execute(lv_draw_vg_lite_unit_t * u)
         case LV_DRAW_TASK_TYPE_LINE:
             lv_draw_vg_lite_line(draw_unit, t->draw_dsc);
             break;
+        case LV_DRAW_TASK_TYPE_POLYLINE:
+            lv_draw_vg_lite_polyline(draw_unit, t->draw_dsc);
+            break;
         case LV_DRAW_TASK_TYPE_LAYER:
             lv_draw_vg_lite_layer(draw_unit, t->draw_dsc, &t->area);
             break;
@@ -266,6 +269,7 @@ static int32_t draw_evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task)
 #endif
         case LV_DRAW_TASK_TYPE_LAYER:
         case LV_DRAW_TASK_TYPE_LINE:
+        case LV_DRAW_TASK_TYPE_POLYLINE:
         case LV_DRAW_TASK_TYPE_TRIANGLE:
         case LV_DRAW_TASK_TYPE_MASK_RECTANGLE:
 
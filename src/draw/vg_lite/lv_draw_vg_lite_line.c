@@ -30,6 +30,9 @@
  *  STATIC PROTOTYPES
  **********************/
 
+static void path_append_line(lv_vg_lite_path_t * path, const lv_draw_line_dsc_t * dsc,
+                             float p1_x, float p1_y, float p2_x, float p2_y, float w2_dx, float w2_dy);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -94,6 +97,166 @@ void lv_draw_vg_lite_line(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t *
     lv_vg_lite_path_set_quality(path, VG_LITE_MEDIUM);
     lv_vg_lite_path_set_bounding_box_area(path, &rel_clip_area);
 
+    path_append_line(path, dsc, p1_x, p1_y, p2_x, p2_y, w2_dx, w2_dy);
+
+    for(int32_t i = 0; i < ndash; i++) {
+        float start_x = p1_x - w2_dx + dx * (i * dash_l + dash_width) * inv_dl;
+        float start_y = p1_y + w2_dy + dy * (i * dash_l + dash_width) * inv_dl;
+
+        lv_vg_lite_path_move_to(path, start_x, start_y);
+        lv_vg_lite_path_line_to(path,
+                                p1_x + w2_dx + dx * (i * dash_l + dash_width) * inv_dl,
+                                p1_y - w2_dy + dy * (i * dash_l + dash_width) * inv_dl);
+        lv_vg_lite_path_line_to(path,
+                                p1_x + w2_dx + dx * (i + 1) * dash_l * inv_dl,
+                                p1_y - w2_dy + dy * (i + 1) * dash_l * inv_dl);
+        lv_vg_lite_path_line_to(path,
+                                p1_x - w2_dx + dx * (i + 1) * dash_l * inv_dl,
+                                p1_y + w2_dy + dy * (i + 1) * dash_l * inv_dl);
+        lv_vg_lite_path_line_to(path, start_x, start_y);
+    }
+
+    lv_vg_lite_path_end(path);
+
+    vg_lite_matrix_t matrix = u->global_matrix;
+
+    vg_lite_color_t color = lv_vg_lite_color(dsc->color, dsc->opa, true);
+
+    vg_lite_path_t * vg_lite_path = lv_vg_lite_path_get_path(path);
+
+    LV_VG_LITE_ASSERT_DEST_BUFFER(&u->target_buffer);
+    LV_VG_LITE_ASSERT_PATH(vg_lite_path);
+    LV_VG_LITE_ASSERT_MATRIX(&matrix);
+
+    LV_PROFILER_DRAW_BEGIN_TAG("vg_lite_draw");
+    LV_VG_LITE_CHECK_ERROR(vg_lite_draw(
+                               &u->target_buffer,
+                               vg_lite_path,
+                               VG_LITE_FILL_EVEN_ODD,
+                               &matrix,
+                               VG_LITE_BLEND_SRC_OVER,
+                               color));
+    LV_PROFILER_DRAW_END_TAG("vg_lite_draw");
+
+    lv_vg_lite_path_drop(u, path);
+
+    LV_PROFILER_DRAW_END;
+}
+
+void lv_draw_vg_lite_polyline(lv_draw_unit_t * draw_unit, const lv_draw_polyline_dsc_t * dsc)
+{
+    const lv_draw_line_dsc_t * line_dsc = &dsc->line;
+    if(line_dsc->opa <= LV_OPA_MIN)
+        return;
+    if(line_dsc->width == 0)
+        return;
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    uint32_t i;
+
+    /* The dashes are cut out of each segment with the even-odd fill rule, so draw them one by one */
+    if(line_dsc->dash_width) {
+        lv_draw_line_dsc_t seg_dsc = *line_dsc;
+        for(i = 1; i < dsc->point_cnt; i++) {
+            seg_dsc.p1 = dsc->points[i - 1];
+            seg_dsc.p2 = dsc->points[i];
+            lv_draw_vg_lite_line(draw_unit, &seg_dsc);
+        }
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
+    float half_w = line_dsc->width * 0.5f;
+    float min_x = dsc->points[0].x;
+    float max_x = dsc->points[0].x;
+    float min_y = dsc->points[0].y;
+    float max_y = dsc->points[0].y;
+    for(i = 1; i < dsc->point_cnt; i++) {
+        min_x = LV_MIN(min_x, dsc->points[i].x);
+        max_x = LV_MAX(max_x, dsc->points[i].x);
+        min_y = LV_MIN(min_y, dsc->points[i].y);
+        max_y = LV_MAX(max_y, dsc->points[i].y);
+    }
+
+    lv_area_t rel_clip_area;
+    rel_clip_area.x1 = (int32_t)(min_x - half_w);
+    rel_clip_area.x2 = (int32_t)(max_x + half_w);
+    rel_clip_area.y1 = (int32_t)(min_y - half_w);
+    rel_clip_area.y2 = (int32_t)(max_y + half_w);
+
+    if(!_lv_area_intersect(&rel_clip_area, &rel_clip_area, draw_unit->clip_area)) {
+        LV_PROFILER_DRAW_END;
+        return; /*Fully clipped, nothing to do*/
+    }
+
+    lv_draw_vg_lite_unit_t * u = (lv_draw_vg_lite_unit_t *)draw_unit;
+
+    lv_vg_lite_path_t * path = lv_vg_lite_path_get(u, VG_LITE_FP32);
+    lv_vg_lite_path_set_quality(path, VG_LITE_MEDIUM);
+    lv_vg_lite_path_set_bounding_box_area(path, &rel_clip_area);
+
+    /* All the segments are wound in the same direction, so they are merged with the non-zero fill rule */
+    uint32_t seg_cnt = 0;
+    for(i = 1; i < dsc->point_cnt; i++) {
+        float p1_x = dsc->points[i - 1].x;
+        float p1_y = dsc->points[i - 1].y;
+        float p2_x = dsc->points[i].x;
+        float p2_y = dsc->points[i].y;
+
+        if(p1_x == p2_x && p1_y == p2_y)
+            continue;
+
+        float dx = p2_x - p1_x;
+        float dy = p2_y - p1_y;
+        float inv_dl = math_fast_inv_sqrtf(SQ(dx) + SQ(dy));
+        float w2_dx = line_dsc->width * dy * inv_dl / 2;
+        float w2_dy = line_dsc->width * dx * inv_dl / 2;
+
+        path_append_line(path, line_dsc, p1_x, p1_y, p2_x, p2_y, w2_dx, w2_dy);
+        seg_cnt++;
+    }
+
+    if(seg_cnt == 0) {
+        lv_vg_lite_path_drop(u, path);
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
+    lv_vg_lite_path_end(path);
+
+    vg_lite_matrix_t matrix = u->global_matrix;
+
+    vg_lite_color_t color = lv_vg_lite_color(line_dsc->color, line_dsc->opa, true);
+
+    vg_lite_path_t * vg_lite_path = lv_vg_lite_path_get_path(path);
+
+    LV_VG_LITE_ASSERT_DEST_BUFFER(&u->target_buffer);
+    LV_VG_LITE_ASSERT_PATH(vg_lite_path);
+    LV_VG_LITE_ASSERT_MATRIX(&matrix);
+
+    LV_PROFILER_DRAW_BEGIN_TAG("vg_lite_draw");
+    LV_VG_LITE_CHECK_ERROR(vg_lite_draw(
+                               &u->target_buffer,
+                               vg_lite_path,
+                               VG_LITE_FILL_NON_ZERO,
+                               &matrix,
+                               VG_LITE_BLEND_SRC_OVER,
+                               color));
+    LV_PROFILER_DRAW_END_TAG("vg_lite_draw");
+
+    lv_vg_lite_path_drop(u, path);
+
+    LV_PROFILER_DRAW_END;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void path_append_line(lv_vg_lite_path_t * path, const lv_draw_line_dsc_t * dsc,
+                             float p1_x, float p1_y, float p2_x, float p2_y, float w2_dx, float w2_dy)
+{
     /* head point */
     float head_start_x = p1_x + w2_dx;
     float head_start_y = p1_y - w2_dy;
@@ -164,53 +327,6 @@ void lv_draw_vg_lite_line(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t *
 
     /* close draw line body */
     lv_vg_lite_path_line_to(path, head_start_x, head_start_y);
-
-    for(int32_t i = 0; i < ndash; i++) {
-        float start_x = p1_x - w2_dx + dx * (i * dash_l + dash_width) * inv_dl;
-        float start_y = p1_y + w2_dy + dy * (i * dash_l + dash_width) * inv_dl;
-
-        lv_vg_lite_path_move_to(path, start_x, start_y);
-        lv_vg_lite_path_line_to(path,
-                                p1_x + w2_dx + dx * (i * dash_l + dash_width) * inv_dl,
-                                p1_y - w2_dy + dy * (i * dash_l + dash_width) * inv_dl);
-        lv_vg_lite_path_line_to(path,
-                                p1_x + w2_dx + dx * (i + 1) * dash_l * inv_dl,
-                                p1_y - w2_dy + dy * (i + 1) * dash_l * inv_dl);
-        lv_vg_lite_path_line_to(path,
-                                p1_x - w2_dx + dx * (i + 1) * dash_l * inv_dl,
-                                p1_y + w2_dy + dy * (i + 1) * dash_l * inv_dl);
-        lv_vg_lite_path_line_to(path, start_x, start_y);
-    }
-
-    lv_vg_lite_path_end(path);
-
-    vg_lite_matrix_t matrix = u->global_matrix;
-
-    vg_lite_color_t color = lv_vg_lite_color(dsc->color, dsc->opa, true);
-
-    vg_lite_path_t * vg_lite_path = lv_vg_lite_path_get_path(path);
-
-    LV_VG_LITE_ASSERT_DEST_BUFFER(&u->target_buffer);
-    LV_VG_LITE_ASSERT_PATH(vg_lite_path);
-    LV_VG_LITE_ASSERT_MATRIX(&matrix);
-
-    LV_PROFILER_DRAW_BEGIN_TAG("vg_lite_draw");
-    LV_VG_LITE_CHECK_ERROR(vg_lite_draw(
-                               &u->target_buffer,
-                               vg_lite_path,
-                               VG_LITE_FILL_EVEN_ODD,
-                               &matrix,
-                               VG_LITE_BLEND_SRC_OVER,
-                               color));
-    LV_PROFILER_DRAW_END_TAG("vg_lite_draw");
-
-    lv_vg_lite_path_drop(u, path);
-
-    LV_PROFILER_DRAW_END;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-
 #endif /*LV_USE_DRAW_VG_LITE*/
@@ -35,7 +35,7 @@ static uint32_t cpu_freq = 0; /* MHz */
  *  STATIC VARIABLES
  **********************/
 
-static uint32_t tick_get_cb(void);
+static uint64_t tick_get_cb(void);
 static void flush_cb(const char * buf);
 
 /**********************
@@ -67,10 +67,10 @@ void lv_nuttx_profiler_init(void)
  *   STATIC FUNCTIONS
  **********************/
 
-static uint32_t tick_get_cb(void)
+static uint64_t tick_get_cb(void)
 {
     static uint32_t prev_tick = 0;
-    static uint32_t cur_tick_us = 0;
+    static uint64_t cur_tick_us = 0;
     uint32_t act_time = up_perf_gettime();
     uint32_t elaps;
 
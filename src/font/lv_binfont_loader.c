@@ -11,6 +11,7 @@
 #include "../misc/lv_types.h"
 #include "../stdlib/lv_string.h"
 #include "lv_binfont_loader.h"
+#include "../draw/sw/lv_draw_sw.h"
 
 /**********************
  *      TYPEDEFS
@@ -120,6 +121,10 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
     if(dsc == NULL) return;
 
+#if LV_USE_DRAW_SW
+    lv_draw_sw_glyph_atlas_drop();
+#endif
+
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
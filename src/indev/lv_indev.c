@@ -8,6 +8,7 @@
  ********************/
 #include "lv_indev_private.h"
 #include "lv_indev_scroll.h"
+#include "lv_indev_hit_index.h"
 #include "../display/lv_display_private.h"
 #include "../core/lv_global.h"
 #include "../core/lv_obj.h"
@@ -1456,17 +1457,17 @@ static void indev_proc_pointer_diff(lv_indev_t * indev)
 
 static lv_obj_t * pointer_search_obj(lv_display_t * disp, lv_point_t * p)
 {
-    indev_obj_act = lv_indev_search_obj(lv_display_get_layer_sys(disp), p);
+    indev_obj_act = _lv_indev_hit_index_search(disp, lv_display_get_layer_sys(disp), p);
     if(indev_obj_act) return indev_obj_act;
 
-    indev_obj_act = lv_indev_search_obj(lv_display_get_layer_top(disp), p);
+    indev_obj_act = _lv_indev_hit_index_search(disp, lv_display_get_layer_top(disp), p);
     if(indev_obj_act) return indev_obj_act;
 
     /* Search the object in the active screen */
-    indev_obj_act = lv_indev_search_obj(lv_display_get_screen_active(disp), p);
+    indev_obj_act = _lv_indev_hit_index_search(disp, lv_display_get_screen_active(disp), p);
     if(indev_obj_act) return indev_obj_act;
 
-    indev_obj_act = lv_indev_search_obj(lv_display_get_layer_bottom(disp), p);
+    indev_obj_act = _lv_indev_hit_index_search(disp, lv_display_get_layer_bottom(disp), p);
     return indev_obj_act;
 }
 
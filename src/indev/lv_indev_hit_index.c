@@ -0,0 +1,374 @@
+/**
+ * @file lv_indev_hit_index.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_indev_hit_index.h"
+#if LV_USE_INDEV_HIT_INDEX
+
+#include "../display/lv_display_private.h"
+#include "../core/lv_global.h"
+#include "../misc/lv_profiler.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CELL_SHIFT      5   /*32x32 px cells*/
+#define ROOT_MAX        4   /*System, top and bottom layer and the active screen*/
+#define MARGIN_MAX      (1 << 16)
+
+#define hit_gen LV_GLOBAL_DEFAULT()->indev_hit_gen
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_obj_t * obj;
+    lv_area_t bbox;         /*Transformed click area in screen coordinates*/
+} hit_item_t;
+
+typedef struct {
+    lv_obj_t * root;
+    uint32_t use_cnt;       /*For replacing the least recently used grid*/
+    uint32_t gen;           /*Generation the grid was built with*/
+    uint32_t seen_gen;      /*Generation seen by the last query*/
+
+    hit_item_t * items;     /*Clickable objects in the order `lv_indev_search_obj` visits them*/
+    uint32_t item_cnt;
+    uint32_t item_cap;
+
+    uint32_t * cell_start;  /*Index of the first item of each cell in `cell_items` (+1 closing element)*/
+    uint32_t cell_cap;
+    uint32_t * cell_items;  /*Item indices per cell, each cell in search order*/
+    uint32_t cell_item_cap;
+    int32_t col_cnt;
+    int32_t row_cnt;
+
+    lv_point_t last_point;
+    lv_obj_t * last_obj;
+    uint32_t last_gen;
+    uint8_t built : 1;
+    uint8_t last_valid : 1;
+} hit_grid_t;
+
+struct _lv_indev_hit_index_t {
+    hit_grid_t grids[ROOT_MAX];
+    uint32_t use_cnt;
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static hit_grid_t * grid_get(lv_display_t * disp, lv_obj_t * root);
+static bool grid_build(hit_grid_t * grid, lv_display_t * disp);
+static bool grid_collect(hit_grid_t * grid, lv_obj_t * obj, int32_t margin, int32_t scale);
+static lv_obj_t * grid_query(hit_grid_t * grid, const lv_point_t * point, bool * cacheable);
+static bool point_reaches_children(lv_obj_t * root, lv_obj_t * obj, lv_point_t * p);
+static bool grid_reserve(void ** arr, uint32_t * cap, uint32_t cnt, size_t elem_size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_indev_hit_index_mark_dirty(void)
+{
+    hit_gen++;
+}
+
+lv_obj_t * _lv_indev_hit_index_search(lv_display_t * disp, lv_obj_t * root, lv_point_t * point)
+{
+    hit_grid_t * grid = root ? grid_get(disp, root) : NULL;
+    if(grid == NULL) return lv_indev_search_obj(root, point);
+
+    uint32_t gen = hit_gen;
+    if(grid->last_valid && grid->last_gen == gen &&
+       grid->last_point.x == point->x && grid->last_point.y == point->y) {
+        return grid->last_obj;
+    }
+    grid->last_valid = 0;
+
+    if(!grid->built || grid->gen != gen) {
+        /*Build the grid only if nothing has changed since the previous query.
+         *While the tree keeps changing (e.g. during an animation) the grid would be
+         *outdated by the next query anyway so the simple search is cheaper.*/
+        if(grid->seen_gen != gen) {
+            grid->seen_gen = gen;
+            grid->built = 0;
+            return lv_indev_search_obj(root, point);
+        }
+
+        if(!grid_build(grid, disp)) return lv_indev_search_obj(root, point);
+        grid->gen = gen;
+    }
+
+    if(point->x < 0 || point->y < 0 ||
+       (point->x >> CELL_SHIFT) >= grid->col_cnt || (point->y >> CELL_SHIFT) >= grid->row_cnt) {
+        return lv_indev_search_obj(root, point);
+    }
+
+    bool cacheable = true;
+    lv_obj_t * found_p = grid_query(grid, point, &cacheable);
+
+    /*An advanced hit test can depend on anything, don't remember its result*/
+    if(cacheable && hit_gen == gen) {
+        grid->last_point = *point;
+        grid->last_obj = found_p;
+        grid->last_gen = gen;
+        grid->last_valid = 1;
+    }
+
+    return found_p;
+}
+
+void _lv_indev_hit_index_delete(lv_display_t * disp)
+{
+    struct _lv_indev_hit_index_t * index = disp->hit_index;
+    if(index == NULL) return;
+
+    uint32_t i;
+    for(i = 0; i < ROOT_MAX; i++) {
+        lv_free(index->grids[i].items);
+        lv_free(index->grids[i].cell_start);
+        lv_free(index->grids[i].cell_items);
+    }
+
+    lv_free(index);
+    disp->hit_index = NULL;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static hit_grid_t * grid_get(lv_display_t * disp, lv_obj_t * root)
+{
+    struct _lv_indev_hit_index_t * index = disp->hit_index;
+    if(index == NULL) {
+        index = lv_malloc_zeroed(sizeof(struct _lv_indev_hit_index_t));
+        if(index == NULL) return NULL;
+        disp->hit_index = index;
+    }
+
+    index->use_cnt++;
+
+    hit_grid_t * grid = NULL;
+    uint32_t i;
+    for(i = 0; i < ROOT_MAX; i++) {
+        if(index->grids[i].root == root) {
+            grid = &index->grids[i];
+            break;
+        }
+        if(grid == NULL || index->grids[i].use_cnt < grid->use_cnt) grid = &index->grids[i];
+    }
+
+    /*Reuse the least recently used grid for a new root*/
+    if(grid->root != root) {
+        grid->root = root;
+        grid->built = 0;
+        grid->last_valid = 0;
+        grid->seen_gen = hit_gen - 1;
+    }
+
+    grid->use_cnt = index->use_cnt;
+    return grid;
+}
+
+static bool grid_build(hit_grid_t * grid, lv_display_t * disp)
+{
+    LV_PROFILER_BEGIN;
+
+    grid->built = 0;
+    grid->item_cnt = 0;
+    if(!grid_collect(grid, grid->root, 0, LV_SCALE_NONE)) {
+        LV_PROFILER_END;
+        return false;
+    }
+
+    int32_t hor_res = lv_display_get_horizontal_resolution(disp);
+    int32_t ver_res = lv_display_get_vertical_resolution(disp);
+    grid->col_cnt = (hor_res + (1 << CELL_SHIFT) - 1) >> CELL_SHIFT;
+    grid->row_cnt = (ver_res + (1 << CELL_SHIFT) - 1) >> CELL_SHIFT;
+    uint32_t cell_cnt = grid->col_cnt * grid->row_cnt;
+    if(!grid_reserve((void **)&grid->cell_start, &grid->cell_cap, cell_cnt + 1, sizeof(uint32_t))) {
+        LV_PROFILER_END;
+        return false;
+    }
+
+    /*Count the items per cell*/
+    lv_memzero(grid->cell_start, (cell_cnt + 1) * sizeof(uint32_t));
+    int32_t col_max = grid->col_cnt - 1;
+    int32_t row_max = grid->row_cnt - 1;
+    uint32_t i;
+    int32_t col;
+    int32_t row;
+    for(i = 0; i < grid->item_cnt; i++) {
+        const lv_area_t * a = &grid->items[i].bbox;
+        if(a->x2 < 0 || a->y2 < 0) continue;
+        int32_t col1 = LV_MAX(a->x1, 0) >> CELL_SHIFT;
+        int32_t row1 = LV_MAX(a->y1, 0) >> CELL_SHIFT;
+        int32_t col2 = LV_MIN(a->x2 >> CELL_SHIFT, col_max);
+        int32_t row2 = LV_MIN(a->y2 >> CELL_SHIFT, row_max);
+        for(row = row1; row <= row2; row++) {
+            for(col = col1; col <= col2; col++) {
+                grid->cell_start[row * grid->col_cnt + col]++;
+            }
+        }
+    }
+
+    /*Convert the counts to the end index of each cell*/
+    uint32_t total = 0;
+    for(i = 0; i < cell_cnt; i++) {
+        total += grid->cell_start[i];
+        grid->cell_start[i] = total;
+    }
+    grid->cell_start[cell_cnt] = total;
+
+    if(!grid_reserve((void **)&grid->cell_items, &grid->cell_item_cap, total, sizeof(uint32_t))) {
+        LV_PROFILER_END;
+        return false;
+    }
+
+    /*Fill the cells backwards. It keeps the search order in each cell and
+     *leaves the start index of each cell in `cell_start`*/
+    i = grid->item_cnt;
+    while(i > 0) {
+        i--;
+        const lv_area_t * a = &grid->items[i].bbox;
+        if(a->x2 < 0 || a->y2 < 0) continue;
+        int32_t col1 = LV_MAX(a->x1, 0) >> CELL_SHIFT;
+        int32_t row1 = LV_MAX(a->y1, 0) >> CELL_SHIFT;
+        int32_t col2 = LV_MIN(a->x2 >> CELL_SHIFT, col_max);
+        int32_t row2 = LV_MIN(a->y2 >> CELL_SHIFT, row_max);
+        for(row = row1; row <= row2; row++) {
+            for(col = col1; col <= col2; col++) {
+                uint32_t c = row * grid->col_cnt + col;
+                grid->cell_start[c]--;
+                grid->cell_items[grid->cell_start[c]] = i;
+            }
+        }
+    }
+
+    grid->built = 1;
+    LV_PROFILER_END;
+    return true;
+}
+
+/**
+ * Add the clickable objects of a subtree in the same order as `lv_indev_search_obj` would check them.
+ * @param grid      pointer to a grid
+ * @param obj       root of the subtree
+ * @param margin    error of the inverse transformations above `obj` in screen pixels
+ * @param scale     the accumulated scale of the ancestors of `obj` (256: no scale)
+ * @return          false on out of memory
+ */
+static bool grid_collect(hit_grid_t * grid, lv_obj_t * obj, int32_t margin, int32_t scale)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return true;
+
+    if(_lv_obj_get_layer_type(obj) == LV_LAYER_TYPE_TRANSFORM) {
+        /*The inverse transformation of the point rounds in the object's own space
+         *and the error is enlarged by the scaling of the ancestors too*/
+        int32_t obj_scale = LV_MAX(lv_obj_get_style_transform_scale_x_safe(obj, 0),
+                                   lv_obj_get_style_transform_scale_y_safe(obj, 0));
+        scale = (int32_t)LV_MIN(((int64_t)scale * LV_MAX(obj_scale, LV_SCALE_NONE)) / LV_SCALE_NONE,
+                                (int64_t)MARGIN_MAX * LV_SCALE_NONE);
+        margin = LV_MIN(margin + 2 * ((scale + LV_SCALE_NONE - 1) / LV_SCALE_NONE), MARGIN_MAX);
+    }
+
+    /*The children are checked first, the last one first*/
+    int32_t i;
+    int32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = child_cnt - 1; i >= 0; i--) {
+        if(!grid_collect(grid, obj->spec_attr->children[i], margin, scale)) return false;
+    }
+
+    if(!lv_obj_has_flag(obj, LV_OBJ_FLAG_CLICKABLE)) return true;
+
+    if(!grid_reserve((void **)&grid->items, &grid->item_cap, grid->item_cnt + 1, sizeof(hit_item_t))) return false;
+
+    hit_item_t * item = &grid->items[grid->item_cnt];
+    item->obj = obj;
+    lv_obj_get_click_area(obj, &item->bbox);
+    lv_obj_get_transformed_area(obj, &item->bbox, LV_OBJ_POINT_TRANSFORM_FLAG_RECURSIVE);
+    lv_area_increase(&item->bbox, margin + 1, margin + 1);
+    grid->item_cnt++;
+
+    return true;
+}
+
+static lv_obj_t * grid_query(hit_grid_t * grid, const lv_point_t * point, bool * cacheable)
+{
+    uint32_t c = (point->y >> CELL_SHIFT) * grid->col_cnt + (point->x >> CELL_SHIFT);
+    uint32_t i;
+    for(i = grid->cell_start[c]; i < grid->cell_start[c + 1]; i++) {
+        hit_item_t * item = &grid->items[grid->cell_items[i]];
+        if(!_lv_area_is_point_on(&item->bbox, point, 0)) continue;
+
+        /*The bounding box is only a hint, check it exactly as `lv_indev_search_obj` does*/
+        lv_obj_t * obj = item->obj;
+        lv_point_t p = *point;
+        if(obj != grid->root && !point_reaches_children(grid->root, lv_obj_get_parent(obj), &p)) continue;
+        if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) continue;
+
+        if(lv_obj_has_flag(obj, LV_OBJ_FLAG_ADV_HITTEST)) *cacheable = false;
+
+        lv_obj_transform_point(obj, &p, LV_OBJ_POINT_TRANSFORM_FLAG_INVERSE);
+        if(lv_obj_hit_test(obj, &p)) return obj;
+    }
+
+    return NULL;
+}
+
+/**
+ * Check if `lv_indev_search_obj` would check the children of an object at all.
+ * @param root      the root of the search
+ * @param obj       an object in the tree of `root`
+ * @param p         the point in screen coordinates, converted to the children's space of `obj`
+ * @return          true: the children of `obj` can be hit by the point
+ */
+static bool point_reaches_children(lv_obj_t * root, lv_obj_t * obj, lv_point_t * p)
+{
+    if(obj == NULL) return false;
+    if(obj != root && !point_reaches_children(root, lv_obj_get_parent(obj), p)) return false;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
+
+    lv_obj_transform_point(obj, p, LV_OBJ_POINT_TRANSFORM_FLAG_INVERSE);
+
+    lv_area_t obj_coords = obj->coords;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        int32_t ext_draw_size = _lv_obj_get_ext_draw_size(obj);
+        lv_area_increase(&obj_coords, ext_draw_size, ext_draw_size);
+    }
+
+    return _lv_area_is_point_on(&obj_coords, p, 0);
+}
+
+static bool grid_reserve(void ** arr, uint32_t * cap, uint32_t cnt, size_t elem_size)
+{
+    if(cnt <= *cap) return true;
+
+    uint32_t new_cap = *cap ? *cap : 16;
+    while(new_cap < cnt) new_cap *= 2;
+
+    void * new_arr = lv_realloc(*arr, new_cap * elem_size);
+    if(new_arr == NULL) return false;
+
+    *arr = new_arr;
+    *cap = new_cap;
+    return true;
+}
+
+#endif /*LV_USE_INDEV_HIT_INDEX*/
@@ -0,0 +1,70 @@
+/**
+ * @file lv_indev_hit_index.h
+ *
+ */
+
+#ifndef LV_INDEV_HIT_INDEX_H
+#define LV_INDEV_HIT_INDEX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../core/lv_obj.h"
+#include "lv_indev.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if LV_USE_INDEV_HIT_INDEX
+
+/**
+ * Tell the hit-test index that the object tree, the coordinates, the flags or the transformation
+ * of an object has changed. Called by LVGL internally.
+ */
+void _lv_indev_hit_index_mark_dirty(void);
+
+/**
+ * Find the top most clickable object under a point using the hit-test index of a display.
+ * The result is always the same as `lv_indev_search_obj(root, point)`'s.
+ * @param disp      the display of `root`
+ * @param root      the object to search on, typically a screen or a layer of `disp`
+ * @param point     the point to search in screen coordinates
+ * @return          the found object or NULL if there was no suitable object
+ */
+lv_obj_t * _lv_indev_hit_index_search(lv_display_t * disp, lv_obj_t * root, lv_point_t * point);
+
+/**
+ * Free the hit-test index of a display
+ * @param disp      pointer to a display
+ */
+void _lv_indev_hit_index_delete(lv_display_t * disp);
+
+#endif /*LV_USE_INDEV_HIT_INDEX*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#if LV_USE_INDEV_HIT_INDEX == 0
+#define _lv_indev_hit_index_mark_dirty()
+#define _lv_indev_hit_index_search(disp, root, point) lv_indev_search_obj(root, point)
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_INDEV_HIT_INDEX_H*/
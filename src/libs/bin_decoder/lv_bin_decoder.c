@@ -40,7 +40,8 @@
 
 typedef struct _lv_image_compressed_t {
     uint32_t method: 4; /*Compression method, see `lv_image_compress_t`*/
-    uint32_t reserved : 28;  /*Reserved to be used later*/
+    uint32_t block_rows: 16; /*0: the image is compressed at once; else every `block_rows` rows are compressed independently*/
+    uint32_t reserved : 12;  /*Reserved to be used later*/
     uint32_t compressed_size;  /*Compressed data size in byte*/
     uint32_t decompressed_size;  /*Decompressed data size in byte*/
     const uint8_t * data; /*Compressed data*/
@@ -55,6 +56,11 @@ typedef struct {
     lv_draw_buf_t * decompressed;       /*Decompressed data could be used directly, thus must also be draw buf*/
     lv_draw_buf_t c_array;              /*An C-array image that need to be converted to a draw buf*/
     lv_draw_buf_t * decoded_partial;    /*A draw buf for decoded image via get_area_cb*/
+    uint32_t * block_offsets;           /*Offsets of the compressed blocks and the end of the last one. NULL if not decoded in bands*/
+    uint32_t blocks_pos;                /*Position of the first compressed block in the file*/
+    uint8_t * block_buf;                /*A compressed block read from the file*/
+    uint32_t block_buf_size;
+    uint8_t * block_decompressed;       /*A decompressed block if the stride of the bands is different*/
 } decoder_data_t;
 
 /**********************
@@ -71,10 +77,19 @@ static lv_result_t decode_alpha_only(lv_image_decoder_t * decoder, lv_image_deco
 static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, int32_t x,
                                        int32_t w_px, const uint8_t * in, lv_color32_t * out);
 static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static bool use_blocks(lv_image_decoder_dsc_t * dsc);
+static lv_result_t load_block_offsets(lv_image_decoder_dsc_t * dsc);
+static lv_result_t decode_block_band(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, lv_draw_buf_t * band,
+                                     int32_t x, int32_t y);
 
 static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff, uint32_t btr, uint32_t * br);
 
 static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed);
+static lv_result_t decompress_blocks(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed,
+                                     uint8_t * output);
+static uint32_t decompress_data(lv_image_compress_t method, const uint8_t * input, uint32_t input_len,
+                                uint8_t * output, uint32_t out_len, uint32_t pixel_byte);
+static uint32_t get_pixel_byte(lv_color_format_t cf);
 
 /**********************
  *  STATIC VARIABLES
@@ -214,7 +229,9 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         lv_color_format_t cf = dsc->header.cf;
 
         if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
-            res = decode_compressed(decoder, dsc);
+            /*Decompress only the blocks to draw in get_area_cb if possible*/
+            if(use_blocks(dsc)) res = load_block_offsets(dsc);
+            else res = decode_compressed(decoder, dsc);
         }
         else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
             if(dsc->args.use_indexed) {
@@ -367,6 +384,8 @@ void lv_bin_decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t *
         decoder_data->decoded_partial = NULL;
     }
 
+    if(decoder_data && decoder_data->block_offsets) lv_image_decoder_release_band(dsc);
+
     free_decoder_data(dsc);
 }
 
@@ -397,6 +416,12 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
         return LV_RESULT_INVALID;
     }
 
+    /*Compressed in blocks, decompress only the blocks covering the area*/
+    if(decoder_data->block_offsets) {
+        return lv_image_decoder_get_band(dsc, full_area, decoded_area, cf, decoder_data->compressed.block_rows, 0,
+                                         decode_block_band);
+    }
+
     lv_fs_file_t * f = decoder_data->f;
     uint32_t bpp = lv_color_format_get_bpp(cf);
     int32_t w_px = lv_area_get_width(full_area);
@@ -542,6 +567,9 @@ static void free_decoder_data(lv_image_decoder_dsc_t * dsc)
     if(decoder_data->decoded) lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, decoder_data->decoded);
     if(decoder_data->decompressed) lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, decoder_data->decompressed);
     lv_free(decoder_data->palette);
+    lv_free(decoder_data->block_offsets);
+    lv_free(decoder_data->block_buf);
+    lv_free(decoder_data->block_decompressed);
     lv_free(decoder_data);
     dsc->user_data = NULL;
 }
@@ -1101,53 +1129,245 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
 
     img_data = decompressed->data;
 
-    if(compressed->method == LV_IMAGE_COMPRESS_RLE) {
-#if LV_USE_RLE
-        /*Compress always happen on byte*/
-        uint32_t pixel_byte;
-        if(dsc->header.cf == LV_COLOR_FORMAT_RGB565A8)
-            pixel_byte = 2;
-        else
-            pixel_byte = (lv_color_format_get_bpp(dsc->header.cf) + 7) >> 3;
-        const uint8_t * input = compressed->data;
-        uint8_t * output = img_data;
-        uint32_t len;
-        len = lv_rle_decompress(input, input_len, output, out_len, pixel_byte);
+    if(compressed->block_rows) {
+        if(decompress_blocks(dsc, compressed, img_data) != LV_RESULT_OK) {
+            lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, decompressed);
+            return LV_RESULT_INVALID;
+        }
+    }
+    else {
+        uint32_t len = decompress_data(compressed->method, compressed->data, input_len, img_data, out_len,
+                                       get_pixel_byte(dsc->header.cf));
         if(len != compressed->decompressed_size) {
-            LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRIu32, out_len, len);
             lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, decompressed);
             return LV_RESULT_INVALID;
         }
+    }
+
+    decoder_data->decompressed = decompressed; /*Free on decoder close*/
+    return LV_RESULT_OK;
+}
+
+/**
+ * Decompress all blocks of an image compressed in blocks. `compressed->data` starts with the block offsets.
+ */
+static lv_result_t decompress_blocks(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed,
+                                     uint8_t * output)
+{
+    lv_color_format_t cf = dsc->header.cf;
+    if(LV_COLOR_FORMAT_IS_INDEXED(cf) || cf == LV_COLOR_FORMAT_RGB565A8) {
+        LV_LOG_WARN("CF: %d can't be compressed in blocks", cf);
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t rows = compressed->block_rows;
+    uint32_t stride = dsc->header.stride;
+    uint32_t block_cnt = (dsc->header.h + rows - 1) / rows;
+    uint32_t offsets_size = (block_cnt + 1) * sizeof(uint32_t);
+    if(offsets_size > compressed->compressed_size ||
+       compressed->decompressed_size < dsc->header.h * stride) {
+        LV_LOG_WARN("Invalid blocks");
+        return LV_RESULT_INVALID;
+    }
+
+    const uint8_t * blocks = compressed->data + offsets_size;
+    uint32_t blocks_size = compressed->compressed_size - offsets_size;
+    uint32_t pixel_byte = get_pixel_byte(cf);
+
+    uint32_t i;
+    for(i = 0; i < block_cnt; i++) {
+        uint32_t start;
+        uint32_t end;
+        lv_memcpy(&start, compressed->data + i * sizeof(uint32_t), sizeof(uint32_t));
+        lv_memcpy(&end, compressed->data + (i + 1) * sizeof(uint32_t), sizeof(uint32_t));
+        if(start > end || end > blocks_size) {
+            LV_LOG_WARN("Invalid block offset");
+            return LV_RESULT_INVALID;
+        }
+
+        uint32_t out_len = LV_MIN(rows, dsc->header.h - i * rows) * stride;
+        uint32_t len = decompress_data(compressed->method, blocks + start, end - start, output + i * rows * stride,
+                                       out_len, pixel_byte);
+        if(len != out_len) return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Decompress some data
+ * @return the length of the decompressed data, 0 on error
+ */
+static uint32_t decompress_data(lv_image_compress_t method, const uint8_t * input, uint32_t input_len,
+                                uint8_t * output, uint32_t out_len, uint32_t pixel_byte)
+{
+    LV_UNUSED(input);
+    LV_UNUSED(input_len);
+    LV_UNUSED(output);
+    LV_UNUSED(pixel_byte);
+
+    if(method == LV_IMAGE_COMPRESS_RLE) {
+#if LV_USE_RLE
+        uint32_t len = lv_rle_decompress(input, input_len, output, out_len, pixel_byte);
+        if(len != out_len) {
+            LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRIu32, out_len, len);
+            return 0;
+        }
+        return len;
 #else
         LV_LOG_WARN("RLE decompress is not enabled");
-        lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, decompressed);
-        return LV_RESULT_INVALID;
+        return 0;
 #endif
     }
-    else if(compressed->method == LV_IMAGE_COMPRESS_LZ4) {
+    else if(method == LV_IMAGE_COMPRESS_LZ4) {
 #if LV_USE_LZ4
-        const char * input = (const char *)compressed->data;
-        char * output = (char *)img_data;
-        int len;
-        len = LZ4_decompress_safe(input, output, input_len, out_len);
-        if(len < 0 || (uint32_t)len != compressed->decompressed_size) {
-            LV_LOG_WARN("Decompress failed: %" LV_PRId32 ", got: %" LV_PRId32, out_len, len);
-            lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, decompressed);
-            return LV_RESULT_INVALID;
+        int len = LZ4_decompress_safe((const char *)input, (char *)output, input_len, out_len);
+        if(len < 0 || (uint32_t)len != out_len) {
+            LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRId32, out_len, (int32_t)len);
+            return 0;
         }
+        return len;
 #else
         LV_LOG_WARN("LZ4 decompress is not enabled");
-        lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, decompressed);
-        return LV_RESULT_INVALID;
+        return 0;
 #endif
     }
-    else {
-        LV_UNUSED(img_data);
-        LV_LOG_WARN("Unknown compression method: %d", compressed->method);
-        lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, decompressed);
+
+    LV_LOG_WARN("Unknown compression method: %d", method);
+    return 0;
+}
+
+static uint32_t get_pixel_byte(lv_color_format_t cf)
+{
+    /*Compress always happen on byte*/
+    if(cf == LV_COLOR_FORMAT_RGB565A8) return 2;
+    else return (lv_color_format_get_bpp(cf) + 7) >> 3;
+}
+
+/**
+ * Check if a compressed file can be decompressed in bands, i.e. it's compressed in blocks
+ * and it's large enough. Reads the compression header to `decoder_data->compressed`.
+ */
+static bool use_blocks(lv_image_decoder_dsc_t * dsc)
+{
+    lv_color_format_t cf = dsc->header.cf;
+    bool supported = cf == LV_COLOR_FORMAT_ARGB8888
+                     || cf == LV_COLOR_FORMAT_XRGB8888
+                     || cf == LV_COLOR_FORMAT_RGB888
+                     || cf == LV_COLOR_FORMAT_RGB565
+                     || cf == LV_COLOR_FORMAT_ARGB8565;
+    if(!supported || !lv_image_decoder_use_bands(dsc, cf)) return false;
+
+    decoder_data_t * decoder_data = dsc->user_data;
+    lv_image_compressed_t * compressed = &decoder_data->compressed;
+    uint32_t rn;
+    lv_fs_res_t res = fs_read_file_at(decoder_data->f, sizeof(lv_image_header_t), compressed, 12, &rn);
+    if(res != LV_FS_RES_OK || rn != 12) return false;
+
+    return compressed->block_rows != 0;
+}
+
+/**
+ * Read the offsets of the compressed blocks to decompress them later in `decode_block_band`
+ */
+static lv_result_t load_block_offsets(lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    const lv_image_compressed_t * compressed = &decoder_data->compressed;
+
+    uint32_t rows = compressed->block_rows;
+    uint32_t block_cnt = (dsc->header.h + rows - 1) / rows;
+    uint32_t offsets_size = (block_cnt + 1) * sizeof(uint32_t);
+    if(offsets_size > compressed->compressed_size ||
+       compressed->decompressed_size < dsc->header.h * dsc->header.stride) {
+        LV_LOG_WARN("Invalid blocks");
         return LV_RESULT_INVALID;
     }
 
-    decoder_data->decompressed = decompressed; /*Free on decoder close*/
+    decoder_data->block_offsets = lv_malloc(offsets_size);
+    LV_ASSERT_MALLOC(decoder_data->block_offsets);
+    if(decoder_data->block_offsets == NULL) return LV_RESULT_INVALID;
+
+    uint32_t pos = sizeof(lv_image_header_t) + 12;
+    uint32_t rn;
+    lv_fs_res_t res = fs_read_file_at(decoder_data->f, pos, decoder_data->block_offsets, offsets_size, &rn);
+    if(res != LV_FS_RES_OK || rn != offsets_size ||
+       decoder_data->block_offsets[block_cnt] > compressed->compressed_size - offsets_size) {
+        LV_LOG_WARN("Read block offsets failed: %d", res);
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->blocks_pos = pos + offsets_size;
+    return LV_RESULT_OK;
+}
+
+static lv_result_t decode_block_band(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, lv_draw_buf_t * band,
+                                     int32_t x, int32_t y)
+{
+    LV_UNUSED(decoder); /*Unused*/
+    LV_UNUSED(x);       /*The bands are not cropped*/
+
+    decoder_data_t * decoder_data = dsc->user_data;
+    const lv_image_compressed_t * compressed = &decoder_data->compressed;
+    uint32_t rows = compressed->block_rows;
+    uint32_t stride = dsc->header.stride;
+    uint32_t pixel_byte = get_pixel_byte(dsc->header.cf);
+
+    /*Decompress into a scratch buffer if the rows of the band are not laid out as in the image*/
+    bool direct = band->header.stride == stride;
+    if(!direct && decoder_data->block_decompressed == NULL) {
+        decoder_data->block_decompressed = lv_malloc(rows * stride);
+        LV_ASSERT_MALLOC(decoder_data->block_decompressed);
+        if(decoder_data->block_decompressed == NULL) return LV_RESULT_INVALID;
+    }
+
+    /*The bands are aligned to the blocks*/
+    uint32_t block;
+    uint32_t block_end = (y + band->header.h + rows - 1) / rows;
+    for(block = y / rows; block < block_end; block++) {
+        uint32_t start = decoder_data->block_offsets[block];
+        uint32_t end = decoder_data->block_offsets[block + 1];
+        if(start > end) {
+            LV_LOG_WARN("Invalid block offset");
+            return LV_RESULT_INVALID;
+        }
+
+        uint32_t size = end - start;
+        if(size > decoder_data->block_buf_size) {
+            uint8_t * buf = lv_realloc(decoder_data->block_buf, size);
+            LV_ASSERT_MALLOC(buf);
+            if(buf == NULL) return LV_RESULT_INVALID;
+            decoder_data->block_buf = buf;
+            decoder_data->block_buf_size = size;
+        }
+
+        uint32_t rn;
+        lv_fs_res_t res = fs_read_file_at(decoder_data->f, decoder_data->blocks_pos + start, decoder_data->block_buf, size,
+                                          &rn);
+        if(res != LV_FS_RES_OK || rn != size) {
+            LV_LOG_WARN("Read block failed: %d", res);
+            return LV_RESULT_INVALID;
+        }
+
+        uint32_t row = block * rows;
+        uint32_t row_cnt = LV_MIN(rows, dsc->header.h - row);
+        uint8_t * band_row = band->data + (row - y) * band->header.stride;
+        uint8_t * out = direct ? band_row : decoder_data->block_decompressed;
+        uint32_t out_len = row_cnt * stride;
+        if(decompress_data(compressed->method, decoder_data->block_buf, size, out, out_len, pixel_byte) != out_len) {
+            return LV_RESULT_INVALID;
+        }
+
+        if(!direct) {
+            uint32_t i;
+            uint32_t row_size = LV_MIN(stride, band->header.stride);
+            for(i = 0; i < row_cnt; i++) {
+                lv_memcpy(band_row + i * band->header.stride, out + i * stride, row_size);
+            }
+        }
+    }
+
+    if(dsc->header.flags & LV_IMAGE_FLAGS_PREMULTIPLIED) lv_draw_buf_set_flag(band, LV_IMAGE_FLAGS_PREMULTIPLIED);
+
     return LV_RESULT_OK;
 }
@@ -9,6 +9,8 @@
 #include "lv_ffmpeg.h"
 #if LV_USE_FFMPEG != 0
 
+#include "../../osal/lv_os.h"
+
 #include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
 #include <libavutil/imgutils.h>
@@ -36,6 +38,14 @@
 
 #define FRAME_DEF_REFR_PERIOD   33  /*[ms]*/
 
+#define FFMPEG_USE_THREAD (LV_FFMPEG_DECODE_ASYNC && LV_USE_OS)
+
+#if FFMPEG_USE_THREAD
+    /*The shown frame and the frames decoded in advance*/
+    #define FRAME_BUF_CNT           3
+    #define DECODE_THREAD_STACKSIZE (128 * 1024)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -54,6 +64,25 @@ struct ffmpeg_context_s {
     enum AVPixelFormat video_dst_pix_fmt;
     bool has_alpha;
     lv_draw_buf_t draw_buf;
+    int64_t frame_pts;                          /*Presentation time of the last decoded frame [ms]*/
+    bool frame_decoded;                         /*A frame was written to `video_dst_data`*/
+#if FFMPEG_USE_THREAD
+    bool async;                                 /*The frames are decoded in `thread`*/
+    lv_thread_t thread;
+    lv_thread_sync_t sync;
+    lv_mutex_t lock;                            /*Protects the fields below*/
+    lv_draw_buf_t * frame_bufs[FRAME_BUF_CNT];
+    int64_t frame_buf_pts[FRAME_BUF_CNT];
+    uint32_t shown_idx;                         /*Index of the shown frame in `frame_bufs`*/
+    uint32_t ready_cnt;                         /*Number of decoded frames after the shown one*/
+    uint32_t seek_id;                           /*Incremented on every seek to drop the frames decoded before it*/
+    bool seek_req;
+    bool eof;
+    bool exit_status;
+    bool sync_clock;                            /*Show the next frame right away and play the rest relative to it*/
+    uint32_t start_tick;                        /*When the frame at `start_pts` was shown*/
+    int64_t start_pts;
+#endif
 };
 
 #pragma pack(1)
@@ -85,6 +114,15 @@ static int ffmpeg_update_next_frame(struct ffmpeg_context_s * ffmpeg_ctx);
 static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx);
 static bool ffmpeg_pix_fmt_has_alpha(enum AVPixelFormat pix_fmt);
 static bool ffmpeg_pix_fmt_is_yuv(enum AVPixelFormat pix_fmt);
+static void ffmpeg_seek_start(struct ffmpeg_context_s * ffmpeg_ctx);
+
+#if FFMPEG_USE_THREAD
+static lv_result_t ffmpeg_async_start(struct ffmpeg_context_s * ffmpeg_ctx);
+static void ffmpeg_async_stop(struct ffmpeg_context_s * ffmpeg_ctx);
+static void ffmpeg_async_resume(struct ffmpeg_context_s * ffmpeg_ctx);
+static bool ffmpeg_async_show_next_frame(lv_ffmpeg_player_t * player, bool * eof);
+static void ffmpeg_decode_thread_cb(void * ptr);
+#endif
 
 static void lv_ffmpeg_player_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_ffmpeg_player_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
@@ -184,6 +222,16 @@ lv_result_t lv_ffmpeg_player_set_src(lv_obj_t * obj, const char * path)
     player->imgdsc.header.stride = width * lv_color_format_get_size(player->imgdsc.header.cf);
     player->imgdsc.data = ffmpeg_get_image_data(player->ffmpeg_ctx);
 
+#if FFMPEG_USE_THREAD
+    if(ffmpeg_async_start(player->ffmpeg_ctx) == LV_RESULT_OK) {
+        struct ffmpeg_context_s * ffmpeg_ctx = player->ffmpeg_ctx;
+        player->imgdsc.data = ffmpeg_ctx->frame_bufs[ffmpeg_ctx->shown_idx]->data;
+    }
+    else {
+        LV_LOG_WARN("Couldn't decode in the background, decoding in the timer");
+    }
+#endif
+
     lv_image_set_src(&player->img.obj, &(player->imgdsc));
 
     int period = ffmpeg_get_frame_refr_period(player->ffmpeg_ctx);
@@ -191,6 +239,10 @@ lv_result_t lv_ffmpeg_player_set_src(lv_obj_t * obj, const char * path)
     if(period > 0) {
         LV_LOG_INFO("frame refresh period = %d ms, rate = %d fps",
                     period, 1000 / period);
+#if FFMPEG_USE_THREAD
+        /*Check the time of the next frame more often to show it with less delay*/
+        if(player->ffmpeg_ctx->async) period = LV_MAX(period / 2, 1);
+#endif
         lv_timer_set_period(player->timer, period);
     }
     else {
@@ -217,14 +269,12 @@ void lv_ffmpeg_player_set_cmd(lv_obj_t * obj, lv_ffmpeg_player_cmd_t cmd)
 
     switch(cmd) {
         case LV_FFMPEG_PLAYER_CMD_START:
-            av_seek_frame(player->ffmpeg_ctx->fmt_ctx,
-                          0, 0, AVSEEK_FLAG_BACKWARD);
+            ffmpeg_seek_start(player->ffmpeg_ctx);
             lv_timer_resume(timer);
             LV_LOG_INFO("ffmpeg player start");
             break;
         case LV_FFMPEG_PLAYER_CMD_STOP:
-            av_seek_frame(player->ffmpeg_ctx->fmt_ctx,
-                          0, 0, AVSEEK_FLAG_BACKWARD);
+            ffmpeg_seek_start(player->ffmpeg_ctx);
             lv_timer_pause(timer);
             LV_LOG_INFO("ffmpeg player stop");
             break;
@@ -233,6 +283,9 @@ void lv_ffmpeg_player_set_cmd(lv_obj_t * obj, lv_ffmpeg_player_cmd_t cmd)
             LV_LOG_INFO("ffmpeg player pause");
             break;
         case LV_FFMPEG_PLAYER_CMD_RESUME:
+#if FFMPEG_USE_THREAD
+            ffmpeg_async_resume(player->ffmpeg_ctx);
+#endif
             lv_timer_resume(timer);
             LV_LOG_INFO("ffmpeg player resume");
             break;
@@ -399,7 +452,20 @@ static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx)
         goto failed;
     }
 
+#if LIBAVCODEC_VERSION_MAJOR < 60
+    /*Deprecated and then removed in FFmpeg 7*/
     LV_LOG_TRACE("video_frame coded_n:%d", frame->coded_picture_number);
+#endif
+
+    if(frame->best_effort_timestamp != AV_NOPTS_VALUE) {
+        AVRational ms_time_base = {1, 1000};
+        ffmpeg_ctx->frame_pts = av_rescale_q(frame->best_effort_timestamp, ffmpeg_ctx->video_stream->time_base,
+                                             ms_time_base);
+    }
+    else {
+        int period = ffmpeg_get_frame_refr_period(ffmpeg_ctx);
+        ffmpeg_ctx->frame_pts += period > 0 ? period : FRAME_DEF_REFR_PERIOD;
+    }
 
     /* copy decoded frame to destination buffer:
      * this is required since rawvideo expects non aligned data
@@ -456,6 +522,8 @@ static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx)
               ffmpeg_ctx->video_dst_data,
               ffmpeg_ctx->video_dst_linesize);
 
+    ffmpeg_ctx->frame_decoded = true;
+
 failed:
     return ret;
 }
@@ -794,6 +862,10 @@ static void ffmpeg_close(struct ffmpeg_context_s * ffmpeg_ctx)
         return;
     }
 
+#if FFMPEG_USE_THREAD
+    if(ffmpeg_ctx->async) ffmpeg_async_stop(ffmpeg_ctx);
+#endif
+
     sws_freeContext(ffmpeg_ctx->sws_ctx);
     ffmpeg_close_src_ctx(ffmpeg_ctx);
     ffmpeg_close_dst_ctx(ffmpeg_ctx);
@@ -811,6 +883,23 @@ static void lv_ffmpeg_player_frame_update_cb(lv_timer_t * timer)
         return;
     }
 
+#if FFMPEG_USE_THREAD
+    if(player->ffmpeg_ctx->async) {
+        bool eof;
+        bool changed = ffmpeg_async_show_next_frame(player, &eof);
+        if(eof) {
+            lv_ffmpeg_player_set_cmd(obj, player->auto_restart ? LV_FFMPEG_PLAYER_CMD_START : LV_FFMPEG_PLAYER_CMD_STOP);
+            return;
+        }
+
+        if(changed) {
+            lv_image_cache_drop(lv_image_get_src(obj));
+            lv_obj_invalidate(obj);
+        }
+        return;
+    }
+#endif
+
     int has_next = ffmpeg_update_next_frame(player->ffmpeg_ctx);
 
     if(has_next < 0) {
@@ -823,6 +912,223 @@ static void lv_ffmpeg_player_frame_update_cb(lv_timer_t * timer)
     lv_obj_invalidate(obj);
 }
 
+static void ffmpeg_seek_start(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+#if FFMPEG_USE_THREAD
+    if(ffmpeg_ctx->async) {
+        /*The decoder thread owns the format context, let it seek*/
+        lv_mutex_lock(&ffmpeg_ctx->lock);
+        ffmpeg_ctx->seek_req = true;
+        ffmpeg_ctx->seek_id++;
+        ffmpeg_ctx->ready_cnt = 0;
+        ffmpeg_ctx->eof = false;
+        ffmpeg_ctx->sync_clock = true;
+        lv_mutex_unlock(&ffmpeg_ctx->lock);
+        lv_thread_sync_signal(&ffmpeg_ctx->sync);
+        return;
+    }
+#endif
+
+    av_seek_frame(ffmpeg_ctx->fmt_ctx, 0, 0, AVSEEK_FLAG_BACKWARD);
+}
+
+#if FFMPEG_USE_THREAD
+
+/**
+ * Allocate the frame buffers and start decoding the frames in a thread
+ * @param ffmpeg_ctx    pointer to an ffmpeg context with allocated images
+ * @return              LV_RESULT_OK: the thread is started; LV_RESULT_INVALID: decode in the timer
+ */
+static lv_result_t ffmpeg_async_start(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    int width = ffmpeg_ctx->video_dec_ctx->width;
+    int height = ffmpeg_ctx->video_dec_ctx->height;
+    lv_color_format_t cf = ffmpeg_ctx->has_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE;
+
+    /*`sws_scale()` writes the rows without padding*/
+    uint32_t stride = width * lv_color_format_get_size(cf);
+    uint32_t i;
+    for(i = 0; i < FRAME_BUF_CNT; i++) {
+        ffmpeg_ctx->frame_bufs[i] = lv_draw_buf_create(width, height, cf, stride);
+        if(ffmpeg_ctx->frame_bufs[i] == NULL) {
+            LV_LOG_WARN("failed to allocate the frame buffers");
+            goto failed;
+        }
+    }
+
+    /*Nothing is decoded yet*/
+    lv_draw_buf_clear(ffmpeg_ctx->frame_bufs[0], NULL);
+    ffmpeg_ctx->shown_idx = 0;
+    ffmpeg_ctx->ready_cnt = 0;
+    ffmpeg_ctx->sync_clock = true;
+
+    /*The frames are decoded to `frame_bufs`. The thread sets `video_dst_data` to them as soon as it starts,
+     *so detach the image of the timer based decoding before and free it only if the thread is running.*/
+    uint8_t * dst_data = ffmpeg_ctx->video_dst_data[0];
+    int dst_linesize = ffmpeg_ctx->video_dst_linesize[0];
+    ffmpeg_ctx->video_dst_data[0] = NULL;
+    ffmpeg_ctx->async = true;
+
+    lv_mutex_init(&ffmpeg_ctx->lock);
+    lv_thread_sync_init(&ffmpeg_ctx->sync);
+    if(lv_thread_init(&ffmpeg_ctx->thread, LV_THREAD_PRIO_MID, ffmpeg_decode_thread_cb, DECODE_THREAD_STACKSIZE,
+                      ffmpeg_ctx) != LV_RESULT_OK) {
+        LV_LOG_ERROR("failed to create the ffmpeg decoder thread");
+        lv_thread_sync_delete(&ffmpeg_ctx->sync);
+        lv_mutex_delete(&ffmpeg_ctx->lock);
+
+        /*Continue decoding in the timer*/
+        ffmpeg_ctx->async = false;
+        ffmpeg_ctx->video_dst_data[0] = dst_data;
+        ffmpeg_ctx->video_dst_linesize[0] = dst_linesize;
+        goto failed;
+    }
+
+    av_free(dst_data);
+    return LV_RESULT_OK;
+
+failed:
+    for(i = 0; i < FRAME_BUF_CNT; i++) {
+        if(ffmpeg_ctx->frame_bufs[i]) lv_draw_buf_destroy(ffmpeg_ctx->frame_bufs[i]);
+        ffmpeg_ctx->frame_bufs[i] = NULL;
+    }
+    return LV_RESULT_INVALID;
+}
+
+/**
+ * Stop the decoder thread and free the frame buffers
+ * @param ffmpeg_ctx    pointer to an ffmpeg context decoding in a thread
+ */
+static void ffmpeg_async_stop(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    lv_mutex_lock(&ffmpeg_ctx->lock);
+    ffmpeg_ctx->exit_status = true;
+    lv_mutex_unlock(&ffmpeg_ctx->lock);
+    lv_thread_sync_signal(&ffmpeg_ctx->sync);
+    lv_thread_delete(&ffmpeg_ctx->thread);
+    lv_thread_sync_delete(&ffmpeg_ctx->sync);
+    lv_mutex_delete(&ffmpeg_ctx->lock);
+
+    uint32_t i;
+    for(i = 0; i < FRAME_BUF_CNT; i++) {
+        lv_draw_buf_destroy(ffmpeg_ctx->frame_bufs[i]);
+        ffmpeg_ctx->frame_bufs[i] = NULL;
+    }
+
+    ffmpeg_ctx->async = false;
+}
+
+static void ffmpeg_async_resume(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    if(!ffmpeg_ctx->async) return;
+
+    /*Continue from the next frame instead of dropping the frames of the pause*/
+    lv_mutex_lock(&ffmpeg_ctx->lock);
+    ffmpeg_ctx->sync_clock = true;
+    lv_mutex_unlock(&ffmpeg_ctx->lock);
+}
+
+/**
+ * Show the decoded frame whose time has come.
+ * Frames are held until their presentation time and the late ones are dropped.
+ * @param player    pointer to an ffmpeg player decoding in a thread
+ * @param eof       set to true if all the frames were shown
+ * @return          true: an other frame is shown
+ */
+static bool ffmpeg_async_show_next_frame(lv_ffmpeg_player_t * player, bool * eof)
+{
+    struct ffmpeg_context_s * ffmpeg_ctx = player->ffmpeg_ctx;
+    uint32_t dropped_cnt = 0;
+    bool changed = false;
+
+    lv_mutex_lock(&ffmpeg_ctx->lock);
+    while(ffmpeg_ctx->ready_cnt > 0) {
+        uint32_t idx = (ffmpeg_ctx->shown_idx + 1) % FRAME_BUF_CNT;
+        int64_t pts = ffmpeg_ctx->frame_buf_pts[idx];
+        if(ffmpeg_ctx->sync_clock) {
+            ffmpeg_ctx->sync_clock = false;
+            ffmpeg_ctx->start_tick = lv_tick_get();
+            ffmpeg_ctx->start_pts = pts;
+        }
+
+        if(pts - ffmpeg_ctx->start_pts > (int64_t)lv_tick_elaps(ffmpeg_ctx->start_tick)) break;
+
+        if(changed) dropped_cnt++;
+        ffmpeg_ctx->shown_idx = idx;
+        ffmpeg_ctx->ready_cnt--;
+        changed = true;
+    }
+    *eof = ffmpeg_ctx->eof && ffmpeg_ctx->ready_cnt == 0;
+    lv_mutex_unlock(&ffmpeg_ctx->lock);
+
+    if(dropped_cnt > 0) {
+        LV_LOG_TRACE("%" LV_PRIu32 " late frames are dropped", dropped_cnt);
+    }
+
+    if(changed) {
+        /*A buffer became free*/
+        lv_thread_sync_signal(&ffmpeg_ctx->sync);
+        player->imgdsc.data = ffmpeg_ctx->frame_bufs[ffmpeg_ctx->shown_idx]->data;
+    }
+
+    return changed;
+}
+
+static void ffmpeg_decode_thread_cb(void * ptr)
+{
+    struct ffmpeg_context_s * ffmpeg_ctx = ptr;
+
+    lv_mutex_lock(&ffmpeg_ctx->lock);
+    while(!ffmpeg_ctx->exit_status) {
+        if(ffmpeg_ctx->seek_req) {
+            ffmpeg_ctx->seek_req = false;
+            lv_mutex_unlock(&ffmpeg_ctx->lock);
+            av_seek_frame(ffmpeg_ctx->fmt_ctx, 0, 0, AVSEEK_FLAG_BACKWARD);
+            avcodec_flush_buffers(ffmpeg_ctx->video_dec_ctx);
+            lv_mutex_lock(&ffmpeg_ctx->lock);
+            continue;
+        }
+
+        /*Wait until a frame is shown or a seek is requested*/
+        if(ffmpeg_ctx->eof || ffmpeg_ctx->ready_cnt >= FRAME_BUF_CNT - 1) {
+            lv_mutex_unlock(&ffmpeg_ctx->lock);
+            lv_thread_sync_wait(&ffmpeg_ctx->sync);
+            lv_mutex_lock(&ffmpeg_ctx->lock);
+            continue;
+        }
+
+        /*The buffer after the decoded ones is neither shown nor ready*/
+        uint32_t idx = (ffmpeg_ctx->shown_idx + ffmpeg_ctx->ready_cnt + 1) % FRAME_BUF_CNT;
+        uint32_t seek_id = ffmpeg_ctx->seek_id;
+        lv_mutex_unlock(&ffmpeg_ctx->lock);
+
+        LV_PROFILER_BEGIN_TAG("ffmpeg_decode_frame");
+        ffmpeg_ctx->video_dst_data[0] = ffmpeg_ctx->frame_bufs[idx]->data;
+        ffmpeg_ctx->video_dst_linesize[0] = ffmpeg_ctx->frame_bufs[idx]->header.stride;
+        ffmpeg_ctx->frame_decoded = false;
+        int ret = ffmpeg_update_next_frame(ffmpeg_ctx);
+        ffmpeg_ctx->video_dst_data[0] = NULL;
+        LV_PROFILER_END_TAG("ffmpeg_decode_frame");
+
+        lv_mutex_lock(&ffmpeg_ctx->lock);
+
+        /*Seeked meanwhile, the frame is not needed*/
+        if(seek_id != ffmpeg_ctx->seek_id) continue;
+
+        if(ret < 0) {
+            ffmpeg_ctx->eof = true;
+        }
+        else if(ffmpeg_ctx->frame_decoded) {
+            /*The decoder might need more packets to output a frame*/
+            ffmpeg_ctx->frame_buf_pts[idx] = ffmpeg_ctx->frame_pts;
+            ffmpeg_ctx->ready_cnt++;
+        }
+    }
+    lv_mutex_unlock(&ffmpeg_ctx->lock);
+}
+
+#endif /*FFMPEG_USE_THREAD*/
+
 static void lv_ffmpeg_player_constructor(const lv_obj_class_t * class_p,
                                          lv_obj_t * obj)
 {
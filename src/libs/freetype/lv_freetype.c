@@ -12,6 +12,8 @@
 
 #include "lv_freetype_private.h"
 #include "../../core/lv_global.h"
+#include "../../draw/sw/lv_draw_sw.h"
+#include "../../misc/lv_text_private.h"
 
 /*********************
  *      DEFINES
@@ -27,6 +29,10 @@
     #error "LV_FREETYPE_CACHE_FT_GLYPH_CNT must be greater than 0"
 #endif
 
+#if LV_FREETYPE_CACHE_SIZE <= 0
+    #error "LV_FREETYPE_CACHE_SIZE must be greater than 0"
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -44,6 +50,7 @@ static void lv_freetype_cleanup(lv_freetype_context_t * ctx);
 static FTC_FaceID lv_freetype_req_face_id(lv_freetype_context_t * ctx, const char * pathname);
 static void lv_freetype_drop_face_id(lv_freetype_context_t * ctx, FTC_FaceID face_id);
 static bool freetype_on_font_create(lv_freetype_font_dsc_t * dsc, uint32_t max_glyph_cnt);
+static bool freetype_on_init_caches(lv_freetype_context_t * ctx, uint32_t max_glyph_cnt);
 static void freetype_on_font_set_cbs(lv_freetype_font_dsc_t * dsc);
 
 static bool cache_node_cache_create_cb(lv_freetype_cache_node_t * node, void * user_data);
@@ -98,6 +105,11 @@ lv_result_t lv_freetype_init(uint32_t max_glyph_cnt)
     ctx->cache_node_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(lv_freetype_cache_node_t), INT32_MAX, ops);
     lv_cache_set_name(ctx->cache_node_cache, "FREETYPE_CACHE_NODE");
 
+    if(freetype_on_init_caches(ctx, max_glyph_cnt) == false) {
+        lv_freetype_uninit();
+        return LV_RESULT_INVALID;
+    }
+
     return LV_RESULT_OK;
 }
 
@@ -184,6 +196,10 @@ void lv_freetype_font_delete(lv_font_t * font)
     LV_ASSERT_NULL(dsc);
     LV_ASSERT_FREETYPE_FONT_DSC(dsc);
 
+#if LV_USE_DRAW_SW
+    lv_draw_sw_glyph_atlas_drop();
+#endif
+
     lv_cache_release(ctx->cache_node_cache, dsc->cache_node_entry, NULL);
     if(lv_cache_entry_get_ref(dsc->cache_node_entry) == 0) {
         lv_cache_drop(ctx->cache_node_cache, dsc->cache_node, NULL);
@@ -196,6 +212,49 @@ void lv_freetype_font_delete(lv_font_t * font)
     lv_free(dsc);
 }
 
+uint32_t lv_freetype_font_warm_up(const lv_font_t * font, const char * txt)
+{
+    LV_ASSERT_NULL(font);
+    LV_ASSERT_NULL(txt);
+    LV_ASSERT_FREETYPE_FONT_DSC((const lv_freetype_font_dsc_t *)font->dsc);
+    LV_PROFILER_FONT_BEGIN;
+
+    uint32_t cnt = 0;
+    uint32_t i = 0;
+    while(txt[i] != '\0') {
+        uint32_t letter = lv_text_encoded_next(txt, &i);
+
+        /*Only the glyphs of this font are loaded, not the ones of the fallback fonts*/
+        lv_font_glyph_dsc_t g_dsc;
+        lv_memzero(&g_dsc, sizeof(g_dsc));
+        if(font->get_glyph_dsc(font, &g_dsc, letter, '\0') == false || g_dsc.is_placeholder) continue;
+
+        if(g_dsc.box_w == 0 || g_dsc.box_h == 0) {
+            cnt++;
+            continue;
+        }
+
+        g_dsc.resolved_font = font;
+        if(font->get_glyph_bitmap(&g_dsc, letter, NULL)) cnt++;
+        lv_font_glyph_release_draw_data(&g_dsc);
+    }
+
+    LV_PROFILER_FONT_END;
+    return cnt;
+}
+
+lv_cache_t * lv_freetype_get_glyph_cache(void)
+{
+    lv_freetype_context_t * ctx = lv_freetype_get_context();
+    return ctx ? ctx->glyph_cache : NULL;
+}
+
+lv_cache_t * lv_freetype_get_image_cache(void)
+{
+    lv_freetype_context_t * ctx = lv_freetype_get_context();
+    return ctx ? ctx->image_cache : NULL;
+}
+
 lv_freetype_context_t * lv_freetype_get_context(void)
 {
     return LV_GLOBAL_DEFAULT()->ft_context;
@@ -221,31 +280,41 @@ int32_t lv_freetype_italic_transform_on_pos(lv_point_t point)
  *   STATIC FUNCTIONS
  **********************/
 
-static bool freetype_on_font_create(lv_freetype_font_dsc_t * dsc, uint32_t max_glyph_cnt)
+static bool freetype_on_init_caches(lv_freetype_context_t * ctx, uint32_t max_glyph_cnt)
 {
     /*
      * Glyph info uses a small amount of memory, and uses glyph info more frequently,
      * so it plans to use twice the maximum number of caches here to
      * get a better info acquisition performance.*/
-    lv_cache_t * glyph_cache = lv_freetype_create_glyph_cache(max_glyph_cnt * 2);
-    if(glyph_cache == NULL) {
+    ctx->glyph_cache = lv_freetype_create_glyph_cache(max_glyph_cnt * 2);
+    if(ctx->glyph_cache == NULL) {
         LV_LOG_ERROR("glyph cache creating failed");
         return false;
     }
-    dsc->cache_node->glyph_cache = glyph_cache;
 
-    lv_cache_t * draw_data_cache = NULL;
-    if(dsc->render_mode == LV_FREETYPE_FONT_RENDER_MODE_BITMAP) {
-        draw_data_cache = lv_freetype_create_draw_data_image(max_glyph_cnt);
+    /*The bitmaps of all faces and sizes share one memory budget*/
+    ctx->image_cache = lv_freetype_create_draw_data_image(LV_FREETYPE_CACHE_SIZE);
+    if(ctx->image_cache == NULL) {
+        LV_LOG_ERROR("image cache creating failed");
+        return false;
     }
-    else if(dsc->render_mode == LV_FREETYPE_FONT_RENDER_MODE_OUTLINE) {
-        draw_data_cache = lv_freetype_create_draw_data_outline(max_glyph_cnt);
+
+    return true;
+}
+
+static bool freetype_on_font_create(lv_freetype_font_dsc_t * dsc, uint32_t max_glyph_cnt)
+{
+    if(dsc->render_mode == LV_FREETYPE_FONT_RENDER_MODE_BITMAP) {
+        /*The bitmaps are stored in the shared image cache*/
+        return true;
     }
-    else {
+    else if(dsc->render_mode != LV_FREETYPE_FONT_RENDER_MODE_OUTLINE) {
         LV_LOG_ERROR("unknown render mode");
         return false;
     }
 
+    /*The outlines are independent of the font size, so the faces keep their own cache*/
+    lv_cache_t * draw_data_cache = lv_freetype_create_draw_data_outline(max_glyph_cnt);
     if(draw_data_cache == NULL) {
         LV_LOG_ERROR("draw data cache creating failed");
         return false;
@@ -275,6 +344,16 @@ static void lv_freetype_cleanup(lv_freetype_context_t * ctx)
         ctx->cache_node_cache = NULL;
     }
 
+    if(ctx->glyph_cache) {
+        lv_cache_destroy(ctx->glyph_cache, NULL);
+        ctx->glyph_cache = NULL;
+    }
+
+    if(ctx->image_cache) {
+        lv_cache_destroy(ctx->image_cache, NULL);
+        ctx->image_cache = NULL;
+    }
+
     if(ctx->library) {
         FT_Done_FreeType(ctx->library);
         ctx->library = NULL;
@@ -364,6 +443,10 @@ static bool cache_node_cache_create_cb(lv_freetype_cache_node_t * node, void * u
 
     node->ref_size = LV_FREETYPE_OUTLINE_REF_SIZE_DEF;
 
+    /*The IDs aren't reused, so the entries of a deleted face in the shared caches
+     *can't be found by a new face. They are freed when they get old.*/
+    node->id = ++ctx->last_node_id;
+
     if(node->style & LV_FREETYPE_FONT_STYLE_ITALIC) {
         lv_freetype_italic_transform(face);
     }
@@ -376,10 +459,6 @@ static void cache_node_cache_free_cb(lv_freetype_cache_node_t * node, void * use
 {
     FT_Done_Face(node->face);
 
-    if(node->glyph_cache) {
-        lv_cache_destroy(node->glyph_cache, user_data);
-        node->glyph_cache = NULL;
-    }
     if(node->draw_data_cache) {
         lv_cache_destroy(node->draw_data_cache, user_data);
         node->draw_data_cache = NULL;
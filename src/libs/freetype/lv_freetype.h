@@ -15,6 +15,7 @@ extern "C" {
 #include "../../lv_conf_internal.h"
 #include "../../misc/lv_types.h"
 #include "../../misc/lv_event.h"
+#include "../../misc/cache/lv_cache.h"
 #include <stdbool.h>
 
 #if LV_USE_FREETYPE
@@ -105,6 +106,30 @@ lv_font_t * lv_freetype_font_create(const char * pathname, lv_freetype_font_rend
  */
 void lv_freetype_font_delete(lv_font_t * font);
 
+/**
+ * Load the glyphs of a text into the caches in advance, so that they don't need
+ * to be rendered when they are drawn the first time.
+ * The glyphs still can be freed later if the caches become full.
+ * @param font      a freetype font
+ * @param txt       UTF-8 text with the characters to load, e.g. "0123456789:"
+ * @return          the number of glyphs found in the font
+ */
+uint32_t lv_freetype_font_warm_up(const lv_font_t * font, const char * txt);
+
+/**
+ * Get the cache storing the glyph descriptors of all the freetype fonts.
+ * Can be used with `lv_cache_get_size()`, `lv_cache_get_hit_cnt()`, etc. to check its usage.
+ * @return          pointer to the cache or NULL if freetype is not initialized
+ */
+lv_cache_t * lv_freetype_get_glyph_cache(void);
+
+/**
+ * Get the cache storing the rendered glyph bitmaps of all the freetype fonts.
+ * Its size is counted in bytes and limited by `LV_FREETYPE_CACHE_SIZE`.
+ * @return          pointer to the cache or NULL if freetype is not initialized
+ */
+lv_cache_t * lv_freetype_get_image_cache(void);
+
 /**
  * Register a callback function to generate outlines for FreeType fonts.
  *
@@ -22,6 +22,7 @@
  *      TYPEDEFS
  **********************/
 typedef struct _lv_freetype_glyph_cache_data_t {
+    uint32_t node_id;
     uint32_t unicode;
     uint32_t size;
 
@@ -98,11 +99,12 @@ static bool freetype_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_
     LV_ASSERT_FREETYPE_FONT_DSC(dsc);
 
     lv_freetype_glyph_cache_data_t search_key = {
+        .node_id = dsc->cache_node->id,
         .unicode = unicode_letter,
         .size = dsc->size,
     };
 
-    lv_cache_t * glyph_cache = dsc->cache_node->glyph_cache;
+    lv_cache_t * glyph_cache = dsc->context->glyph_cache;
 
     lv_cache_entry_t * entry = lv_cache_acquire_or_create(glyph_cache, &search_key, dsc);
     if(entry == NULL) {
@@ -192,6 +194,9 @@ static void freetype_glyph_free_cb(lv_freetype_glyph_cache_data_t * data, void *
 static lv_cache_compare_res_t freetype_glyph_compare_cb(const lv_freetype_glyph_cache_data_t * lhs,
                                                         const lv_freetype_glyph_cache_data_t * rhs)
 {
+    if(lhs->node_id != rhs->node_id) {
+        return lhs->node_id > rhs->node_id ? 1 : -1;
+    }
     if(lhs->unicode != rhs->unicode) {
         return lhs->unicode > rhs->unicode ? 1 : -1;
     }
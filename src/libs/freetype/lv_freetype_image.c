@@ -27,6 +27,8 @@
  **********************/
 
 typedef struct _lv_freetype_image_cache_data_t {
+    lv_cache_slot_size_t slot;          /**< Must be the first field: used by the size based cache*/
+    uint32_t node_id;
     FT_UInt glyph_index;
     uint32_t size;
 
@@ -58,7 +60,7 @@ static void freetype_image_release_cb(const lv_font_t * font, lv_font_glyph_dsc_
  *   GLOBAL FUNCTIONS
  **********************/
 
-lv_cache_t * lv_freetype_create_draw_data_image(uint32_t cache_size)
+lv_cache_t * lv_freetype_create_draw_data_image(uint32_t cache_bytes)
 {
     lv_cache_ops_t ops = {
         .compare_cb = (lv_cache_compare_cb_t)freetype_image_compare_cb,
@@ -66,8 +68,8 @@ lv_cache_t * lv_freetype_create_draw_data_image(uint32_t cache_size)
         .free_cb = (lv_cache_free_cb_t)freetype_image_free_cb,
     };
 
-    lv_cache_t * draw_data_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(lv_freetype_image_cache_data_t),
-                                                   cache_size, ops);
+    lv_cache_t * draw_data_cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(lv_freetype_image_cache_data_t),
+                                                   cache_bytes, ops);
     lv_cache_set_name(draw_data_cache, CACHE_NAME);
 
     return draw_data_cache;
@@ -98,9 +100,12 @@ static const void * freetype_get_glyph_bitmap_cb(lv_font_glyph_dsc_t * g_dsc,
     FT_Face face = dsc->cache_node->face;
     FT_UInt glyph_index = FT_Get_Char_Index(face, unicode_letter);
 
-    lv_cache_t * cache = dsc->cache_node->draw_data_cache;
+    lv_cache_t * cache = dsc->context->image_cache;
 
+    /*The size has to be known before the entry is created, so calculate it from the glyph dsc.*/
     lv_freetype_image_cache_data_t search_key = {
+        .slot.size = sizeof(lv_draw_buf_t) + lv_draw_buf_width_to_stride(g_dsc->box_w, LV_COLOR_FORMAT_A8) * g_dsc->box_h,
+        .node_id = dsc->cache_node->id,
         .glyph_index = glyph_index,
         .size = dsc->size,
     };
@@ -108,6 +113,12 @@ static const void * freetype_get_glyph_bitmap_cb(lv_font_glyph_dsc_t * g_dsc,
     lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache, &search_key, dsc);
 
     g_dsc->entry = entry;
+    if(entry == NULL) {
+        LV_LOG_WARN("glyph bitmap caching failed for unicode = 0x%" LV_PRIx32, unicode_letter);
+        LV_PROFILER_FONT_END;
+        return NULL;
+    }
+
     lv_freetype_image_cache_data_t * cache_node = lv_cache_entry_get_data(entry);
 
     LV_PROFILER_FONT_END;
@@ -118,7 +129,11 @@ static void freetype_image_release_cb(const lv_font_t * font, lv_font_glyph_dsc_
 {
     LV_ASSERT_NULL(font);
     lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)font->dsc;
-    lv_cache_release(dsc->cache_node->draw_data_cache, g_dsc->entry, NULL);
+
+    if(g_dsc->entry == NULL) {
+        return;
+    }
+    lv_cache_release(dsc->context->image_cache, g_dsc->entry, NULL);
     g_dsc->entry = NULL;
 }
 
@@ -164,6 +179,12 @@ static bool freetype_image_create_cb(lv_freetype_image_cache_data_t * data, void
 
     uint32_t stride = lv_draw_buf_width_to_stride(box_w, LV_COLOR_FORMAT_A8);
     data->draw_buf = lv_draw_buf_create_user(font_draw_buf_handlers, box_w, box_h, LV_COLOR_FORMAT_A8, stride);
+    if(data->draw_buf == NULL) {
+        LV_LOG_ERROR("glyph draw buffer creating failed");
+        FT_Done_Glyph(glyph);
+        LV_PROFILER_FONT_END;
+        return false;
+    }
 
     for(int y = 0; y < box_h; ++y) {
         lv_memcpy((uint8_t *)(data->draw_buf->data) + y * stride, glyph_bitmap->bitmap.buffer + y * box_w,
@@ -182,6 +203,9 @@ static void freetype_image_free_cb(lv_freetype_image_cache_data_t * data, void *
 static lv_cache_compare_res_t freetype_image_compare_cb(const lv_freetype_image_cache_data_t * lhs,
                                                         const lv_freetype_image_cache_data_t * rhs)
 {
+    if(lhs->node_id != rhs->node_id) {
+        return lhs->node_id > rhs->node_id ? 1 : -1;
+    }
     if(lhs->glyph_index != rhs->glyph_index) {
         return lhs->glyph_index > rhs->glyph_index ? 1 : -1;
     }
@@ -64,13 +64,11 @@ struct _lv_freetype_cache_node_t {
     lv_freetype_font_render_mode_t render_mode;
 
     uint32_t ref_size;                  /**< Reference size for calculating outline glyph's real size.*/
+    uint32_t id;                        /**< Unique ID of the node, used in the keys of the shared caches*/
 
     FT_Face face;
 
-    /*glyph cache*/
-    lv_cache_t * glyph_cache;
-
-    /*draw data cache*/
+    /*outline cache, the bitmaps are stored in the shared image cache of the context*/
     lv_cache_t * draw_data_cache;
 };
 
@@ -80,8 +78,13 @@ typedef struct _lv_freetype_context_t {
     lv_event_cb_t event_cb;
 
     uint32_t max_glyph_cnt;
+    uint32_t last_node_id;
 
     lv_cache_t * cache_node_cache;
+
+    /*Glyph descriptors and bitmaps of all the fonts*/
+    lv_cache_t * glyph_cache;
+    lv_cache_t * image_cache;
 } lv_freetype_context_t;
 
 typedef struct _lv_freetype_font_dsc_t {
@@ -113,7 +116,7 @@ int32_t lv_freetype_italic_transform_on_pos(lv_point_t point);
 lv_cache_t * lv_freetype_create_glyph_cache(uint32_t cache_size);
 void lv_freetype_set_cbs_glyph(lv_freetype_font_dsc_t * dsc);
 
-lv_cache_t * lv_freetype_create_draw_data_image(uint32_t cache_size);
+lv_cache_t * lv_freetype_create_draw_data_image(uint32_t cache_bytes);
 void lv_freetype_set_cbs_image_font(lv_freetype_font_dsc_t * dsc);
 
 lv_cache_t * lv_freetype_create_draw_data_outline(uint32_t cache_size);
@@ -13,20 +13,97 @@
 
 #include "lv_gifdec.h"
 #include "gifdec.h"
+#include "../../core/lv_global.h"
+
+#if LV_GIF_CACHE_FRAMES && LV_GIF_CACHE_FRAMES_LZ4
+    #if LV_USE_LZ4_EXTERNAL
+        #include <lz4.h>
+    #endif
+
+    #if LV_USE_LZ4_INTERNAL
+        #include "../../libs/lz4/lz4.h"
+    #endif
+#endif
 
 /*********************
  *      DEFINES
  *********************/
+
+#define GIFDEC_USE_WORKER (LV_GIF_DECODE_ASYNC && LV_USE_OS)
+
+#if GIFDEC_USE_WORKER
+    #define gifdec_worker_p (LV_GLOBAL_DEFAULT()->gifdec_worker)
+#endif
+
+#if LV_GIF_CACHE_FRAMES
+    #define img_cache_p (LV_GLOBAL_DEFAULT()->img_cache)
+    #define image_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers)
+
+    #if LV_GIF_CACHE_FRAMES_LZ4 && !LV_USE_LZ4
+        #error "LV_GIF_CACHE_FRAMES_LZ4 requires LV_USE_LZ4_INTERNAL or LV_USE_LZ4_EXTERNAL"
+    #endif
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if GIFDEC_USE_WORKER
+typedef enum {
+    FRAME_STATE_IDLE,
+    FRAME_STATE_QUEUED,
+    FRAME_STATE_BUSY,
+    FRAME_STATE_READY,
+} frame_state_t;
+
+struct _lv_gifdec_worker_t {
+    lv_thread_t thread;
+    lv_thread_sync_t sync;
+    lv_mutex_t lock;            /*Protects the queue and the state of the frames*/
+    lv_mutex_t decode_lock;     /*Held while a frame is decoded*/
+    lv_ll_t queue_ll;           /*Pointers to the decoders waiting for their next frame*/
+    uint32_t user_cnt;
+    volatile bool exit_status;
+};
+#endif
+
+#if LV_GIF_CACHE_FRAMES
+/* A frame decoded in advance. Its pixels are stored in the image cache
+ * with the address of this descriptor as the key.*/
+typedef struct {
+    lv_area_t area;             /*Area changed compared to the previous frame*/
+    uint16_t delay;
+#if LV_GIF_CACHE_FRAMES_LZ4
+    uint32_t compressed_size;
+#endif
+    lv_cache_entry_t * entry;   /*Keeps the frame in the cache while all frames are added*/
+} gifdec_frame_t;
+#endif
+
 typedef struct {
     gd_GIF * gif;
     lv_image_dsc_t imgdsc;
     lv_timer_t * timer;
     void * obj;
     uint32_t last_call;
+#if GIFDEC_USE_WORKER
+    /* The shown frame is copied to `buf` from the canvas of the gif, so that
+     * the worker can compose the next frame in the canvas meanwhile.*/
+    uint8_t * buf;
+    uint16_t delay;             /*Delay of the shown frame*/
+    uint16_t next_delay;
+    int next_res;               /*Return value of `gd_get_frame()` for the next frame*/
+    lv_area_t next_area;        /*Area of the canvas changed by the next frame*/
+    frame_state_t state;
+    bool full_copy;             /*The canvas has changes not tracked by `next_area`*/
+#endif
+#if LV_GIF_CACHE_FRAMES
+    lv_ll_t frame_ll;           /*`gifdec_frame_t`s of the decoded frames*/
+    gifdec_frame_t * frame_act; /*The shown frame or NULL if the frames are not cached*/
+    lv_cache_entry_t * frame_entry; /*Cache entry of the shown frame*/
+    int32_t loop_count;
+    int32_t loop_left;
+#endif
 } lv_gifdec_t;
 
 /**********************
@@ -34,6 +111,28 @@ typedef struct {
  **********************/
 
 static void lv_gifdec_frame_cb(lv_timer_t * t);
+static int decode_frame(gd_GIF * gif, lv_area_t * area);
+static void frame_changed(lv_gifdec_t * dec_ctx, const lv_area_t * area);
+
+#if LV_GIF_CACHE_FRAMES
+static lv_result_t cache_frames(lv_gifdec_t * dec_ctx);
+static lv_cache_entry_t * cache_frame(lv_gifdec_t * dec_ctx, gifdec_frame_t * frame, char * compressed);
+static lv_result_t show_cached_frame(lv_gifdec_t * dec_ctx, gifdec_frame_t * frame);
+static void frame_cached_cb(lv_gifdec_t * dec_ctx);
+static void cache_frames_fallback(lv_gifdec_t * dec_ctx);
+static void cache_frames_free(lv_gifdec_t * dec_ctx);
+#endif
+
+#if GIFDEC_USE_WORKER
+static void worker_start(lv_gifdec_t * dec_ctx);
+static void frame_async_cb(lv_gifdec_t * dec_ctx);
+static void show_frame(lv_gifdec_t * dec_ctx);
+static struct _lv_gifdec_worker_t * worker_get(void);
+static void worker_release(void);
+static void worker_queue(lv_gifdec_t * dec_ctx);
+static void worker_cancel(lv_gifdec_t * dec_ctx);
+static void worker_thread_cb(void * ptr);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -57,6 +156,10 @@ void * lv_gifdec_open(void * obj)
     lv_timer_pause(dec_ctx->timer);
     dec_ctx->obj = obj;
 
+#if LV_GIF_CACHE_FRAMES
+    _lv_ll_init(&dec_ctx->frame_ll, sizeof(gifdec_frame_t));
+#endif
+
     return dec_ctx;
 }
 
@@ -68,6 +171,17 @@ void lv_gifdec_start(void * ctx, const void * src)
     if(dec_ctx->gif) {
         lv_image_cache_drop(lv_image_get_src(dec_ctx->obj));
 
+#if LV_GIF_CACHE_FRAMES
+        cache_frames_free(dec_ctx);
+#endif
+#if GIFDEC_USE_WORKER
+        if(dec_ctx->buf) {
+            worker_cancel(dec_ctx);
+            worker_release();
+            lv_free(dec_ctx->buf);
+            dec_ctx->buf = NULL;
+        }
+#endif
         gd_close_gif(dec_ctx->gif);
         dec_ctx->gif = NULL;
         dec_ctx->imgdsc.data = NULL;
@@ -86,6 +200,18 @@ void lv_gifdec_start(void * ctx, const void * src)
     }
 
     dec_ctx->imgdsc.data = dec_ctx->gif->canvas;
+
+    bool cached = false;
+#if LV_GIF_CACHE_FRAMES
+    cached = cache_frames(dec_ctx) == LV_RESULT_OK;
+    if(!cached) LV_LOG_INFO("Couldn't cache the frames, decoding them one by one");
+#endif
+
+#if GIFDEC_USE_WORKER
+    if(!cached) worker_start(dec_ctx);
+#endif
+    LV_UNUSED(cached);
+
     dec_ctx->imgdsc.header.cf = LV_COLOR_FORMAT_ARGB8888;
     dec_ctx->imgdsc.header.h = dec_ctx->gif->height;
     dec_ctx->imgdsc.header.w = dec_ctx->gif->width;
@@ -126,6 +252,24 @@ void lv_gifdec_restart(void * ctx)
         return;
     }
 
+#if GIFDEC_USE_WORKER
+    if(dec_ctx->buf) worker_cancel(dec_ctx);
+#endif
+
+#if LV_GIF_CACHE_FRAMES
+    if(dec_ctx->frame_act) {
+        dec_ctx->loop_left = dec_ctx->loop_count;
+        if(show_cached_frame(dec_ctx, _lv_ll_get_head(&dec_ctx->frame_ll)) == LV_RESULT_OK) {
+            dec_ctx->last_call = lv_tick_get();
+            lv_image_cache_drop(lv_image_get_src(dec_ctx->obj));
+            lv_obj_invalidate(dec_ctx->obj);
+        }
+        else {
+            cache_frames_free(dec_ctx);
+        }
+    }
+#endif
+
     gd_rewind(dec_ctx->gif);
     lv_timer_resume(dec_ctx->timer);
     lv_timer_reset(dec_ctx->timer);
@@ -137,6 +281,17 @@ void lv_gifdec_close(void * ctx)
 
     lv_image_cache_drop(lv_image_get_src(dec_ctx->obj));
 
+#if LV_GIF_CACHE_FRAMES
+    cache_frames_free(dec_ctx);
+#endif
+#if GIFDEC_USE_WORKER
+    if(dec_ctx->buf) {
+        worker_cancel(dec_ctx);
+        worker_release();
+        lv_free(dec_ctx->buf);
+    }
+#endif
+
     if(dec_ctx->gif)
         gd_close_gif(dec_ctx->gif);
     lv_timer_delete(dec_ctx->timer);
@@ -151,12 +306,27 @@ static void lv_gifdec_frame_cb(lv_timer_t * t)
 {
     lv_gifdec_t * dec_ctx = (lv_gifdec_t *)t->user_data;
 
+#if LV_GIF_CACHE_FRAMES
+    if(dec_ctx->frame_act) {
+        frame_cached_cb(dec_ctx);
+        return;
+    }
+#endif
+
+#if GIFDEC_USE_WORKER
+    if(dec_ctx->buf) {
+        frame_async_cb(dec_ctx);
+        return;
+    }
+#endif
+
     uint32_t elaps = lv_tick_elaps(dec_ctx->last_call);
     if(elaps < dec_ctx->gif->gce.delay * 10) return;
 
     dec_ctx->last_call = lv_tick_get();
 
-    int has_next = gd_get_frame(dec_ctx->gif);
+    lv_area_t area;
+    int has_next = decode_frame(dec_ctx->gif, &area);
     if(has_next == 0) {
         /*It was the last repeat*/
         lv_result_t res = lv_obj_send_event(dec_ctx->obj, LV_EVENT_READY, NULL);
@@ -164,11 +334,540 @@ static void lv_gifdec_frame_cb(lv_timer_t * t)
         if(res != LV_FS_RES_OK) return;
     }
 
-    gd_render_frame(dec_ctx->gif, (uint8_t *)dec_ctx->imgdsc.data);
+    frame_changed(dec_ctx, &area);
+}
+
+/**
+ * Get the next frame and render it to the canvas of the gif
+ * @param gif       pointer to a gif
+ * @param area      store the area of the canvas changed by the frame here
+ * @return          the return value of `gd_get_frame()`
+ */
+static int decode_frame(gd_GIF * gif, lv_area_t * area)
+{
+    /*Restoring the background clears the previous frame when getting the next one*/
+    lv_area_t disposed_area;
+    lv_area_set(&disposed_area, gif->fx, gif->fy, gif->fx + gif->fw - 1, gif->fy + gif->fh - 1);
+    bool disposed = gif->gce.disposal == 2 && lv_area_get_size(&disposed_area) > 0;
+
+    int res = gd_get_frame(gif);
+    gd_render_frame(gif, gif->canvas);
+
+    lv_area_set(area, gif->fx, gif->fy, gif->fx + gif->fw - 1, gif->fy + gif->fh - 1);
+    if(disposed) {
+        if(lv_area_get_size(area) > 0) _lv_area_join(area, area, &disposed_area);
+        else *area = disposed_area;
+    }
+
+    return res;
+}
+
+static void frame_changed(lv_gifdec_t * dec_ctx, const lv_area_t * area)
+{
+    lv_image_cache_drop(lv_image_get_src(dec_ctx->obj));
+
+    /*Only the rectangle of the frame is updated in the canvas*/
+    lv_area_t canvas_area = {0, 0, dec_ctx->gif->width - 1, dec_ctx->gif->height - 1};
+    lv_area_t changed_area;
+    if(_lv_area_intersect(&changed_area, &canvas_area, area)) {
+        lv_image_invalidate_src_area(dec_ctx->obj, &changed_area);
+    }
+}
+
+#if LV_GIF_CACHE_FRAMES
+
+/**
+ * Decode all frames of the first loop and add them to the image cache.
+ * @param dec_ctx   pointer to a decoder with a just opened gif
+ * @return          LV_RESULT_OK: all frames are cached and the first one is shown;
+ *                  LV_RESULT_INVALID: the frames don't fit into the image cache
+ */
+static lv_result_t cache_frames(lv_gifdec_t * dec_ctx)
+{
+    gd_GIF * gif = dec_ctx->gif;
+
+    if(!lv_image_cache_is_enabled()) return LV_RESULT_INVALID;
+
+    char * compressed = NULL;
+#if LV_GIF_CACHE_FRAMES_LZ4
+    compressed = lv_malloc(LZ4_compressBound(gif->width * gif->height * 4));
+    LV_ASSERT_MALLOC(compressed);
+    if(compressed == NULL) return LV_RESULT_INVALID;
+#endif
+
+    LV_PROFILER_BEGIN;
+
+    lv_result_t res = LV_RESULT_OK;
+    lv_area_t area;
+    int has_next = decode_frame(gif, &area);
+
+    /*The loop count is read with the first frame. Stop at the end of the first loop.*/
+    dec_ctx->loop_count = gif->loop_count;
+    dec_ctx->loop_left = gif->loop_count;
+    gif->loop_count = 1;
+
+    while(has_next > 0) {
+        gifdec_frame_t * frame = _lv_ll_ins_tail(&dec_ctx->frame_ll);
+        LV_ASSERT_MALLOC(frame);
+        if(frame == NULL) {
+            res = LV_RESULT_INVALID;
+            break;
+        }
+
+        frame->area = area;
+        frame->delay = gif->gce.delay;
+        frame->entry = cache_frame(dec_ctx, frame, compressed);
+        if(frame->entry == NULL) {
+            res = LV_RESULT_INVALID;
+            break;
+        }
+
+        has_next = decode_frame(gif, &area);
+    }
+
+    if(has_next < 0) res = LV_RESULT_INVALID;
+
+    /*The frames were kept in the cache to not evict each other. Let the cache manage them from now.*/
+    gifdec_frame_t * frame;
+    _LV_LL_READ(&dec_ctx->frame_ll, frame) {
+        if(frame->entry) {
+            lv_cache_release(img_cache_p, frame->entry, NULL);
+            frame->entry = NULL;
+        }
+    }
+
+    lv_free(compressed);
+    gd_rewind(gif);
+
+    if(res == LV_RESULT_OK) {
+        frame = _lv_ll_get_head(&dec_ctx->frame_ll);
+        res = frame ? show_cached_frame(dec_ctx, frame) : LV_RESULT_INVALID;
+    }
+
+    if(res != LV_RESULT_OK) cache_frames_free(dec_ctx);
+
+    LV_PROFILER_END;
+
+    return res;
+}
+
+/**
+ * Add the content of the canvas to the image cache
+ * @param dec_ctx       pointer to a decoder
+ * @param frame         descriptor of the frame, its address is the key of the entry
+ * @param compressed    buffer for the compressed frame if LZ4 is used
+ * @return              the acquired cache entry or NULL if it doesn't fit into the cache
+ */
+static lv_cache_entry_t * cache_frame(lv_gifdec_t * dec_ctx, gifdec_frame_t * frame, char * compressed)
+{
+    gd_GIF * gif = dec_ctx->gif;
+    uint32_t frame_size = gif->width * gif->height * 4;
+    lv_draw_buf_t * decoded;
+
+#if LV_GIF_CACHE_FRAMES_LZ4
+    int len = LZ4_compress_default((const char *)gif->canvas, compressed, frame_size, LZ4_compressBound(frame_size));
+    if(len <= 0) return NULL;
+
+    /*Store the compressed data in A8 rows to let the image cache account and free it as any image*/
+    frame->compressed_size = len;
+    decoded = lv_draw_buf_create_user(image_cache_draw_buf_handlers, gif->width, (len + gif->width - 1) / gif->width,
+                                      LV_COLOR_FORMAT_A8, gif->width);
+    if(decoded == NULL) return NULL;
+    lv_memcpy(decoded->data, compressed, len);
+#else
+    LV_UNUSED(compressed);
+    decoded = lv_draw_buf_create_user(image_cache_draw_buf_handlers, gif->width, gif->height,
+                                      LV_COLOR_FORMAT_ARGB8888, gif->width * 4);
+    if(decoded == NULL) return NULL;
+    lv_memcpy(decoded->data, gif->canvas, frame_size);
+#endif
+
+    lv_image_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.slot.size = decoded->data_size;
+    search_key.src = frame;
+    search_key.src_type = LV_IMAGE_SRC_VARIABLE;
+
+    lv_cache_entry_t * entry = lv_image_decoder_add_to_cache(NULL, &search_key, decoded, NULL);
+    if(entry == NULL) lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, decoded);
+
+    return entry;
+}
+
+/**
+ * Show a frame from the image cache
+ * @param dec_ctx   pointer to a decoder
+ * @param frame     the frame to show
+ * @return          LV_RESULT_OK: the frame is shown; LV_RESULT_INVALID: it was evicted from the cache
+ */
+static lv_result_t show_cached_frame(lv_gifdec_t * dec_ctx, gifdec_frame_t * frame)
+{
+    lv_image_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.src = frame;
+    search_key.src_type = LV_IMAGE_SRC_VARIABLE;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(img_cache_p, &search_key, NULL);
+    if(entry == NULL) return LV_RESULT_INVALID;
+
+    const lv_image_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+
+#if LV_GIF_CACHE_FRAMES_LZ4
+    gd_GIF * gif = dec_ctx->gif;
+    int32_t frame_size = gif->width * gif->height * 4;
+    int len = LZ4_decompress_safe((const char *)cached_data->decoded->data, (char *)gif->canvas,
+                                  frame->compressed_size, frame_size);
+    lv_cache_release(img_cache_p, entry, NULL);
+    if(len != frame_size) return LV_RESULT_INVALID;
+#else
+    /*Keep the shown frame in the cache*/
+    if(dec_ctx->frame_entry) lv_cache_release(img_cache_p, dec_ctx->frame_entry, NULL);
+    dec_ctx->frame_entry = entry;
+    dec_ctx->imgdsc.data = cached_data->decoded->data;
+#endif
+
+    dec_ctx->frame_act = frame;
+    return LV_RESULT_OK;
+}
+
+static void frame_cached_cb(lv_gifdec_t * dec_ctx)
+{
+    uint32_t elaps = lv_tick_elaps(dec_ctx->last_call);
+    if(elaps < dec_ctx->frame_act->delay * 10) return;
+
+    lv_area_t area;
+    gifdec_frame_t * next = _lv_ll_get_next(&dec_ctx->frame_ll, dec_ctx->frame_act);
+    bool restarted = next == NULL;
+    if(restarted) {
+        /*Follow the loop count as `gd_get_frame()` does*/
+        if(dec_ctx->loop_left == 1 || dec_ctx->loop_left < 0) {
+            /*It was the last repeat*/
+            lv_obj_send_event(dec_ctx->obj, LV_EVENT_READY, NULL);
+            lv_timer_pause(dec_ctx->timer);
+            return;
+        }
+
+        next = _lv_ll_get_head(&dec_ctx->frame_ll);
+        lv_area_set(&area, 0, 0, dec_ctx->gif->width - 1, dec_ctx->gif->height - 1);
+    }
+    else {
+        area = next->area;
+    }
+
+    if(show_cached_frame(dec_ctx, next) != LV_RESULT_OK) {
+        /*Continue by decoding the frames after the shown one*/
+        cache_frames_fallback(dec_ctx);
+        lv_gifdec_frame_cb(dec_ctx->timer);
+        return;
+    }
+
+    if(restarted && dec_ctx->loop_left > 1) dec_ctx->loop_left--;
+
+    dec_ctx->last_call = lv_tick_get();
+    frame_changed(dec_ctx, &area);
+}
+
+/**
+ * Stop using the cached frames because one of them was evicted, and
+ * decode the frames up to the shown one to continue the animation from there.
+ * @param dec_ctx   pointer to a decoder playing the cached frames
+ */
+static void cache_frames_fallback(lv_gifdec_t * dec_ctx)
+{
+    LV_LOG_INFO("A frame was evicted from the image cache, decoding the frames one by one");
+
+    uint32_t frame_idx = 0;
+    gifdec_frame_t * frame;
+    _LV_LL_READ(&dec_ctx->frame_ll, frame) {
+        if(frame == dec_ctx->frame_act) break;
+        frame_idx++;
+    }
+
+    cache_frames_free(dec_ctx);
+
+    gd_GIF * gif = dec_ctx->gif;
+    gd_rewind(gif);
+    lv_area_t area;
+    uint32_t i;
+    for(i = 0; i <= frame_idx; i++) {
+        decode_frame(gif, &area);
+    }
+    gif->loop_count = dec_ctx->loop_left;
 
     lv_image_cache_drop(lv_image_get_src(dec_ctx->obj));
     lv_obj_invalidate(dec_ctx->obj);
 }
 
+static void cache_frames_free(lv_gifdec_t * dec_ctx)
+{
+    /*The image cache might refer to the pixels of the shown frame*/
+    lv_image_cache_drop(lv_image_get_src(dec_ctx->obj));
+
+    if(dec_ctx->frame_entry) {
+        lv_cache_release(img_cache_p, dec_ctx->frame_entry, NULL);
+        dec_ctx->frame_entry = NULL;
+    }
+
+    lv_image_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.src_type = LV_IMAGE_SRC_VARIABLE;
+
+    gifdec_frame_t * frame;
+    _LV_LL_READ(&dec_ctx->frame_ll, frame) {
+        search_key.src = frame;
+        lv_cache_drop(img_cache_p, &search_key, NULL);
+    }
+
+    _lv_ll_clear(&dec_ctx->frame_ll);
+    dec_ctx->frame_act = NULL;
+    if(dec_ctx->gif) dec_ctx->imgdsc.data = dec_ctx->gif->canvas;
+}
+
+#endif /*LV_GIF_CACHE_FRAMES*/
+
+#if GIFDEC_USE_WORKER
+
+/**
+ * Decode the frames in the background from now
+ * @param dec_ctx   pointer to a decoder with a just opened gif
+ */
+static void worker_start(lv_gifdec_t * dec_ctx)
+{
+    /*Fall back to decoding in the timer without the worker*/
+    dec_ctx->buf = lv_malloc(dec_ctx->gif->width * dec_ctx->gif->height * 4);
+    if(dec_ctx->buf && worker_get() == NULL) {
+        lv_free(dec_ctx->buf);
+        dec_ctx->buf = NULL;
+    }
+
+    if(dec_ctx->buf == NULL) {
+        LV_LOG_WARN("Couldn't decode in the background, decoding in the timer");
+        return;
+    }
+
+    /*Decode the first frame right away to show it when the timer runs*/
+    dec_ctx->imgdsc.data = dec_ctx->buf;
+    dec_ctx->delay = 0;
+    dec_ctx->next_res = decode_frame(dec_ctx->gif, &dec_ctx->next_area);
+    dec_ctx->next_delay = dec_ctx->gif->gce.delay;
+    dec_ctx->state = FRAME_STATE_READY;
+    dec_ctx->full_copy = true;
+}
+
+static void frame_async_cb(lv_gifdec_t * dec_ctx)
+{
+    struct _lv_gifdec_worker_t * worker = gifdec_worker_p;
+
+    lv_mutex_lock(&worker->lock);
+    frame_state_t state = dec_ctx->state;
+    lv_mutex_unlock(&worker->lock);
+
+    if(state == FRAME_STATE_IDLE) {
+        worker_queue(dec_ctx);
+        return;
+    }
+
+    /*If the frame is not decoded yet it will be shown late*/
+    if(state != FRAME_STATE_READY) return;
+
+    uint32_t elaps = lv_tick_elaps(dec_ctx->last_call);
+    if(elaps < dec_ctx->delay * 10) return;
+
+    dec_ctx->last_call = lv_tick_get();
+
+    lv_area_t area = dec_ctx->next_area;
+    if(dec_ctx->full_copy) lv_area_set(&area, 0, 0, dec_ctx->gif->width - 1, dec_ctx->gif->height - 1);
+
+    show_frame(dec_ctx);
+
+    if(dec_ctx->next_res == 0) {
+        /*It was the last repeat*/
+        lv_result_t res = lv_obj_send_event(dec_ctx->obj, LV_EVENT_READY, NULL);
+        lv_timer_pause(dec_ctx->timer);
+        if(res != LV_FS_RES_OK) return;
+    }
+    else {
+        worker_queue(dec_ctx);
+    }
+
+    frame_changed(dec_ctx, &area);
+}
+
+/**
+ * Copy the decoded frame from the canvas of the gif to the shown buffer
+ * @param dec_ctx   pointer to a decoder with a ready frame
+ */
+static void show_frame(lv_gifdec_t * dec_ctx)
+{
+    gd_GIF * gif = dec_ctx->gif;
+
+    if(dec_ctx->full_copy) {
+        lv_memcpy(dec_ctx->buf, gif->canvas, gif->width * gif->height * 4);
+    }
+    else {
+        lv_area_t canvas_area = {0, 0, gif->width - 1, gif->height - 1};
+        lv_area_t area;
+        if(_lv_area_intersect(&area, &canvas_area, &dec_ctx->next_area)) {
+            uint32_t stride = gif->width * 4;
+            uint32_t offset = area.y1 * stride + area.x1 * 4;
+            uint32_t len = lv_area_get_width(&area) * 4;
+            int32_t y;
+            for(y = area.y1; y <= area.y2; y++) {
+                lv_memcpy(dec_ctx->buf + offset, gif->canvas + offset, len);
+                offset += stride;
+            }
+        }
+    }
+
+    dec_ctx->delay = dec_ctx->next_delay;
+    dec_ctx->full_copy = false;
+
+    lv_mutex_lock(&gifdec_worker_p->lock);
+    dec_ctx->state = FRAME_STATE_IDLE;
+    lv_mutex_unlock(&gifdec_worker_p->lock);
+}
+
+static struct _lv_gifdec_worker_t * worker_get(void)
+{
+    struct _lv_gifdec_worker_t * worker = gifdec_worker_p;
+    if(worker) {
+        worker->user_cnt++;
+        return worker;
+    }
+
+    worker = lv_malloc_zeroed(sizeof(struct _lv_gifdec_worker_t));
+    LV_ASSERT_MALLOC(worker);
+    if(worker == NULL) return NULL;
+
+    _lv_ll_init(&worker->queue_ll, sizeof(lv_gifdec_t *));
+    lv_mutex_init(&worker->lock);
+    lv_mutex_init(&worker->decode_lock);
+    lv_thread_sync_init(&worker->sync);
+    if(lv_thread_init(&worker->thread, LV_THREAD_PRIO_LOW, worker_thread_cb, LV_DRAW_THREAD_STACKSIZE,
+                      worker) != LV_RESULT_OK) {
+        LV_LOG_ERROR("failed to create the gif decoder thread");
+        lv_thread_sync_delete(&worker->sync);
+        lv_mutex_delete(&worker->decode_lock);
+        lv_mutex_delete(&worker->lock);
+        lv_free(worker);
+        return NULL;
+    }
+
+    worker->user_cnt = 1;
+    gifdec_worker_p = worker;
+    return worker;
+}
+
+/**
+ * Stop the worker if no decoder uses it anymore
+ */
+static void worker_release(void)
+{
+    struct _lv_gifdec_worker_t * worker = gifdec_worker_p;
+    LV_ASSERT_NULL(worker);
+
+    worker->user_cnt--;
+    if(worker->user_cnt > 0) return;
+
+    worker->exit_status = true;
+    lv_thread_sync_signal(&worker->sync);
+    lv_thread_delete(&worker->thread);
+    lv_thread_sync_delete(&worker->sync);
+    lv_mutex_delete(&worker->decode_lock);
+    lv_mutex_delete(&worker->lock);
+    _lv_ll_clear(&worker->queue_ll);
+    lv_free(worker);
+    gifdec_worker_p = NULL;
+}
+
+static void worker_queue(lv_gifdec_t * dec_ctx)
+{
+    struct _lv_gifdec_worker_t * worker = gifdec_worker_p;
+
+    lv_mutex_lock(&worker->lock);
+    lv_gifdec_t ** item = _lv_ll_ins_tail(&worker->queue_ll);
+    LV_ASSERT_MALLOC(item);
+    if(item) {
+        *item = dec_ctx;
+        dec_ctx->state = FRAME_STATE_QUEUED;
+    }
+    lv_mutex_unlock(&worker->lock);
+
+    lv_thread_sync_signal(&worker->sync);
+}
+
+/**
+ * Make sure the worker doesn't use the gif of a decoder.
+ * Waits for the frame being decoded and drops the decoded frame.
+ * @param dec_ctx   pointer to a decoder
+ */
+static void worker_cancel(lv_gifdec_t * dec_ctx)
+{
+    struct _lv_gifdec_worker_t * worker = gifdec_worker_p;
+
+    lv_mutex_lock(&worker->lock);
+    while(dec_ctx->state == FRAME_STATE_BUSY) {
+        lv_mutex_unlock(&worker->lock);
+        lv_mutex_lock(&worker->decode_lock);
+        lv_mutex_unlock(&worker->decode_lock);
+        lv_mutex_lock(&worker->lock);
+    }
+
+    if(dec_ctx->state == FRAME_STATE_QUEUED) {
+        lv_gifdec_t ** item;
+        _LV_LL_READ(&worker->queue_ll, item) {
+            if(*item == dec_ctx) break;
+        }
+        if(item) {
+            _lv_ll_remove(&worker->queue_ll, item);
+            lv_free(item);
+        }
+    }
+    else if(dec_ctx->state == FRAME_STATE_READY) {
+        /*The dropped frame is already in the canvas*/
+        dec_ctx->full_copy = true;
+    }
+
+    dec_ctx->state = FRAME_STATE_IDLE;
+    lv_mutex_unlock(&worker->lock);
+}
+
+static void worker_thread_cb(void * ptr)
+{
+    struct _lv_gifdec_worker_t * worker = ptr;
+
+    while(1) {
+        lv_mutex_lock(&worker->lock);
+        lv_gifdec_t * dec_ctx = NULL;
+        lv_gifdec_t ** item = _lv_ll_get_head(&worker->queue_ll);
+        if(item) {
+            dec_ctx = *item;
+            _lv_ll_remove(&worker->queue_ll, item);
+            lv_free(item);
+            dec_ctx->state = FRAME_STATE_BUSY;
+            lv_mutex_lock(&worker->decode_lock);
+        }
+        lv_mutex_unlock(&worker->lock);
+
+        if(dec_ctx) {
+            LV_PROFILER_BEGIN_TAG("gif_decode_frame");
+            dec_ctx->next_res = decode_frame(dec_ctx->gif, &dec_ctx->next_area);
+            dec_ctx->next_delay = dec_ctx->gif->gce.delay;
+            LV_PROFILER_END_TAG("gif_decode_frame");
+
+            lv_mutex_lock(&worker->lock);
+            dec_ctx->state = FRAME_STATE_READY;
+            lv_mutex_unlock(&worker->lock);
+            lv_mutex_unlock(&worker->decode_lock);
+            continue;
+        }
+
+        if(worker->exit_status) break;
+        lv_thread_sync_wait(&worker->sync);
+    }
+}
+
+#endif /*GIFDEC_USE_WORKER*/
+
 #endif /*#!LV_USE_CUSTOM_GIF*/
 #endif /*LV_USE_GIF*/
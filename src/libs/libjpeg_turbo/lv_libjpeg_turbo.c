@@ -12,7 +12,7 @@
 #include "lv_libjpeg_turbo.h"
 #include <stdio.h>
 #include <jpeglib.h>
-#include <jpegint.h>
+#include <jerror.h>
 #include <setjmp.h>
 
 /*********************
@@ -27,6 +27,18 @@
 #define JPEG_SIGNATURE 0xFFD8FF
 #define IS_JPEG_SIGNATURE(x) (((x) & 0x00FFFFFF) == JPEG_SIGNATURE)
 
+/*Set in the header of images with Exif orientation as they can't be decoded row by row*/
+#define JPEG_FLAG_ROTATED   LV_IMAGE_FLAGS_USER1
+
+/*Bands are aligned to the largest MCU height*/
+#define JPEG_BAND_ALIGN     16
+
+/*The columns of the cropped bands are aligned to the largest MCU width*/
+#define JPEG_CROP_ALIGN     16
+
+/*The size of the buffer the file is read into*/
+#define JPEG_INPUT_BUF_SIZE 4096
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,17 +47,48 @@ typedef struct error_mgr_s {
     jmp_buf jb;
 } error_mgr_t;
 
+/*Reads the compressed data from an `lv_fs` file*/
+typedef struct {
+    struct jpeg_source_mgr pub;
+    lv_fs_file_t * file;
+    JOCTET * buf;
+} fs_source_mgr_t;
+
+/*State of decoding an image in bands*/
+typedef struct {
+    struct jpeg_decompress_struct cinfo;
+    error_mgr_t jerr;
+    lv_fs_file_t file;
+    bool reading;               /*true if rows are being read*/
+    int32_t x;                  /*The first column of the bands being read*/
+    int32_t w;                  /*The width of the bands being read*/
+    JDIMENSION crop_x;          /*The first column of the rows returned by libjpeg-turbo*/
+    JSAMPARRAY row;             /*Scratch row if libjpeg-turbo returns wider rows than the bands. Else NULL.*/
+} jpeg_band_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, lv_image_header_t * header);
 static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area);
 static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
-static lv_draw_buf_t * decode_jpeg_file(const char * filename);
-static uint8_t * read_file(const char * filename, uint32_t * size);
-static bool get_jpeg_head_info(const char * filename, uint32_t * width, uint32_t * height, uint32_t * orientation);
-static bool get_jpeg_size(uint8_t * data, uint32_t data_size, uint32_t * width, uint32_t * height);
-static bool get_jpeg_direction(uint8_t * data, uint32_t data_size, uint32_t * orientation);
+static lv_draw_buf_t * decode_jpeg_file(const lv_image_decoder_args_t * args, const char * filename);
+static lv_result_t decode_band(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, lv_draw_buf_t * band,
+                               int32_t x, int32_t y);
+static lv_result_t band_reader_open(const lv_image_decoder_args_t * args, jpeg_band_t * band_dsc,
+                                    const char * filename, int32_t x, int32_t w);
+static void band_reader_close(jpeg_band_t * band_dsc);
+static void fs_src_set(j_decompress_ptr cinfo, lv_fs_file_t * file);
+static void fs_src_init(j_decompress_ptr cinfo);
+static boolean fs_src_fill(j_decompress_ptr cinfo);
+static void fs_src_skip(j_decompress_ptr cinfo, long num_bytes);
+static void fs_src_term(j_decompress_ptr cinfo);
+static void set_scale(const lv_image_decoder_args_t * args, j_decompress_ptr cinfo, uint32_t orientation);
+static bool get_jpeg_head_info(const lv_image_decoder_args_t * args, lv_fs_file_t * file, uint32_t * width,
+                               uint32_t * height, uint32_t * orientation);
+static bool get_jpeg_direction(j_decompress_ptr cinfo, uint32_t * orientation);
 static void rotate_buffer(lv_draw_buf_t * decoded, uint8_t * buffer, uint32_t line_index, uint32_t angle);
 static void error_exit(j_common_ptr cinfo);
 /**********************
@@ -76,9 +119,11 @@ void lv_libjpeg_turbo_init(void)
     lv_image_decoder_t * dec = lv_image_decoder_create();
     lv_image_decoder_set_info_cb(dec, decoder_info);
     lv_image_decoder_set_open_cb(dec, decoder_open);
+    lv_image_decoder_set_get_area_cb(dec, decoder_get_area);
     lv_image_decoder_set_close_cb(dec, decoder_close);
 
     dec->name = DECODER_NAME;
+    dec->scalable = true;
 }
 
 void lv_libjpeg_turbo_deinit(void)
@@ -134,7 +179,7 @@ static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_d
         uint32_t height;
         uint32_t orientation = 0;
 
-        if(!get_jpeg_head_info(src, &width, &height, &orientation)) {
+        if(!get_jpeg_head_info(&dsc->args, &dsc->file, &width, &height, &orientation)) {
             return LV_RESULT_INVALID;
         }
 
@@ -142,6 +187,7 @@ static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_d
         header->cf = LV_COLOR_FORMAT_RGB888;
         header->w = (orientation % 180) ? height : width;
         header->h = (orientation % 180) ? width : height;
+        if(orientation) header->flags |= JPEG_FLAG_ROTATED;
 
         return LV_RESULT_OK;
     }
@@ -157,12 +203,17 @@ static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_d
  */
 static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
 {
-    LV_UNUSED(decoder); /*Unused*/
-
     /*If it's a JPEG file...*/
     if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        if(!(dsc->header.flags & JPEG_FLAG_ROTATED) && lv_image_decoder_use_bands(dsc, LV_COLOR_FORMAT_ARGB8888)) {
+            /*Decode only the bands to draw in `decoder_get_area`*/
+            dsc->user_data = lv_malloc_zeroed(sizeof(jpeg_band_t));
+            LV_ASSERT_MALLOC(dsc->user_data);
+            return dsc->user_data ? LV_RESULT_OK : LV_RESULT_INVALID;
+        }
+
         const char * fn = dsc->src;
-        lv_draw_buf_t * decoded = decode_jpeg_file(fn);
+        lv_draw_buf_t * decoded = decode_jpeg_file(&dsc->args, fn);
         if(decoded == NULL) {
             LV_LOG_WARN("decode jpeg file failed");
             return LV_RESULT_INVALID;
@@ -179,6 +230,8 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         lv_image_cache_data_t search_key;
         search_key.src_type = dsc->src_type;
         search_key.src = dsc->src;
+        search_key.target_w = dsc->args.target_w;
+        search_key.target_h = dsc->args.target_h;
         search_key.slot.size = decoded->data_size;
 
         lv_cache_entry_t * entry = lv_image_decoder_add_to_cache(decoder, &search_key, decoded, NULL);
@@ -195,72 +248,45 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
 }
 
 /**
- * Free the allocated resources
+ * Decode the bands of a large image which cover an area
+ * @param decoder       pointer to the decoder
+ * @param dsc           pointer to the decoder descriptor
+ * @param full_area     the area to decode, relative to the image
+ * @param decoded_area  the decoded band
+ * @return              LV_RESULT_OK: a band is decoded; LV_RESULT_INVALID: failed or there are no more bands
  */
-static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area)
 {
     LV_UNUSED(decoder); /*Unused*/
 
-    if(dsc->args.no_cache ||
-       !lv_image_cache_is_enabled()) lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, (lv_draw_buf_t *)dsc->decoded);
+    /*The image is decoded entirely*/
+    if(dsc->user_data == NULL) return LV_RESULT_INVALID;
+
+    return lv_image_decoder_get_band(dsc, full_area, decoded_area, LV_COLOR_FORMAT_ARGB8888, JPEG_BAND_ALIGN,
+                                     JPEG_CROP_ALIGN, decode_band);
 }
 
-static uint8_t * read_file(const char * filename, uint32_t * size)
+/**
+ * Free the allocated resources
+ */
+static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
 {
-    uint8_t * data = NULL;
-    lv_fs_file_t f;
-    uint32_t data_size;
-    uint32_t rn;
-    lv_fs_res_t res;
-
-    *size = 0;
-
-    res = lv_fs_open(&f, filename, LV_FS_MODE_RD);
-    if(res != LV_FS_RES_OK) {
-        LV_LOG_WARN("can't open %s", filename);
-        return NULL;
-    }
-
-    res = lv_fs_seek(&f, 0, LV_FS_SEEK_END);
-    if(res != LV_FS_RES_OK) {
-        goto failed;
-    }
-
-    res = lv_fs_tell(&f, &data_size);
-    if(res != LV_FS_RES_OK) {
-        goto failed;
-    }
-
-    res = lv_fs_seek(&f, 0, LV_FS_SEEK_SET);
-    if(res != LV_FS_RES_OK) {
-        goto failed;
-    }
+    LV_UNUSED(decoder); /*Unused*/
 
-    /*Read file to buffer*/
-    data = lv_malloc(data_size);
-    if(data == NULL) {
-        LV_LOG_WARN("malloc failed for data");
-        goto failed;
+    jpeg_band_t * band_dsc = dsc->user_data;
+    if(band_dsc) {
+        band_reader_close(band_dsc);
+        lv_free(band_dsc);
+        lv_image_decoder_release_band(dsc);
+        return;
     }
 
-    res = lv_fs_read(&f, data, data_size, &rn);
-
-    if(res == LV_FS_RES_OK && rn == data_size) {
-        *size = rn;
-    }
-    else {
-        LV_LOG_WARN("read file failed");
-        lv_free(data);
-        data = NULL;
-    }
-
-failed:
-    lv_fs_close(&f);
-
-    return data;
+    if(dsc->args.no_cache ||
+       !lv_image_cache_is_enabled()) lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, (lv_draw_buf_t *)dsc->decoded);
 }
 
-static lv_draw_buf_t * decode_jpeg_file(const char * filename)
+static lv_draw_buf_t * decode_jpeg_file(const lv_image_decoder_args_t * args, const char * filename)
 {
     /* This struct contains the JPEG decompression parameters and pointers to
      * working space (which is allocated as needed by the JPEG library).
@@ -282,14 +308,13 @@ static lv_draw_buf_t * decode_jpeg_file(const char * filename)
 
     /* In this example we want to open the input file before doing anything else,
      * so that the setjmp() error recovery below can assume the file is open.
-     * VERY IMPORTANT: use "b" option to fopen() if you are on a machine that
-     * requires it in order to read binary files.
+     * The file is read in small chunks while decoding.
      */
 
-    uint32_t data_size;
-    uint8_t * data = read_file(filename, &data_size);
-    if(data == NULL) {
-        LV_LOG_WARN("can't load file %s", filename);
+    lv_fs_file_t f;
+    lv_fs_res_t res = lv_fs_open(&f, filename, LV_FS_MODE_RD);
+    if(res != LV_FS_RES_OK) {
+        LV_LOG_WARN("can't open %s", filename);
         return NULL;
     }
 
@@ -311,26 +336,27 @@ static lv_draw_buf_t * decode_jpeg_file(const char * filename)
         * We need to clean up the JPEG object, close the input file, and return.
         */
         jpeg_destroy_decompress(&cinfo);
-        lv_free(data);
+        lv_fs_close(&f);
         return NULL;
     }
 
-    /* Get rotate angle from Exif data */
-    if(!get_jpeg_direction(data, data_size, &image_angle)) {
-        LV_LOG_WARN("read jpeg orientation failed.");
-    }
-
     /* Now we can initialize the JPEG decompression object. */
     jpeg_create_decompress(&cinfo);
 
     /* specify data source (eg, a file or buffer) */
 
-    jpeg_mem_src(&cinfo, data, data_size);
+    fs_src_set(&cinfo, &f);
 
-    /* read file parameters with jpeg_read_header() */
+    /* read file parameters with jpeg_read_header() and keep the Exif data */
 
+    jpeg_save_markers(&cinfo, JPEG_APP0 + 1, 0xFFFF);
     jpeg_read_header(&cinfo, TRUE);
 
+    /* Get rotate angle from Exif data */
+    if(!get_jpeg_direction(&cinfo, &image_angle)) {
+        LV_LOG_WARN("read jpeg orientation failed.");
+    }
+
     /* We can ignore the return value from jpeg_read_header since
      *   (a) suspension is not possible with the stdio data source, and
      *   (b) we passed TRUE to reject a tables-only JPEG file as an error.
@@ -341,9 +367,8 @@ static lv_draw_buf_t * decode_jpeg_file(const char * filename)
 
     cinfo.out_color_space = JCS_EXT_BGRX;
 
-    /* In this example, we don't need to change any of the defaults set by
-     * jpeg_read_header(), so we do nothing here.
-     */
+    /* Let the IDCT scale down the image if it's larger than needed */
+    set_scale(args, &cinfo, image_angle);
 
     /* Start decompressor */
 
@@ -408,7 +433,7 @@ static lv_draw_buf_t * decode_jpeg_file(const char * filename)
     * so as to simplify the setjmp error logic above.  (Actually, I don't
     * think that jpeg_destroy can do an error exit, but why assume anything...)
     */
-    lv_free(data);
+    lv_fs_close(&f);
 
     /* At this point you may want to check to see whether any corrupt-data
     * warnings occurred (test whether jerr.pub.num_warnings is nonzero).
@@ -418,29 +443,8 @@ static lv_draw_buf_t * decode_jpeg_file(const char * filename)
     return decoded;
 }
 
-static bool get_jpeg_head_info(const char * filename, uint32_t * width, uint32_t * height, uint32_t * orientation)
-{
-    uint8_t * data = NULL;
-    uint32_t data_size;
-    data = read_file(filename, &data_size);
-    if(data == NULL) {
-        return false;
-    }
-
-    if(!get_jpeg_size(data, data_size, width, height)) {
-        LV_LOG_WARN("read jpeg size failed.");
-    }
-
-    if(!get_jpeg_direction(data, data_size, orientation)) {
-        LV_LOG_WARN("read jpeg orientation failed.");
-    }
-
-    lv_free(data);
-
-    return JPEG_HEADER_OK;
-}
-
-static bool get_jpeg_size(uint8_t * data, uint32_t data_size, uint32_t * width, uint32_t * height)
+static bool get_jpeg_head_info(const lv_image_decoder_args_t * args, lv_fs_file_t * file, uint32_t * width,
+                               uint32_t * height, uint32_t * orientation)
 {
     struct jpeg_decompress_struct cinfo;
     error_mgr_t jerr;
@@ -456,53 +460,43 @@ static bool get_jpeg_size(uint8_t * data, uint32_t data_size, uint32_t * width,
 
     jpeg_create_decompress(&cinfo);
 
-    jpeg_mem_src(&cinfo, data, data_size);
+    /*Only the markers before the image data are read*/
+    lv_fs_seek(file, 0, LV_FS_SEEK_SET);
+    fs_src_set(&cinfo, file);
 
-    int ret = jpeg_read_header(&cinfo, TRUE);
-
-    if(ret == JPEG_HEADER_OK) {
-        *width = cinfo.image_width;
-        *height = cinfo.image_height;
-    }
-    else {
-        LV_LOG_WARN("read jpeg head failed: %d", ret);
-    }
-
-    jpeg_destroy_decompress(&cinfo);
-
-    return JPEG_HEADER_OK;
-}
-
-static bool get_jpeg_direction(uint8_t * data, uint32_t data_size, uint32_t * orientation)
-{
-    struct jpeg_decompress_struct cinfo;
-    error_mgr_t jerr;
+    jpeg_save_markers(&cinfo, JPEG_APP0 + 1, 0xFFFF);
 
-    cinfo.err = jpeg_std_error(&jerr.pub);
-    jerr.pub.error_exit = error_exit;
+    jpeg_read_header(&cinfo, TRUE);
 
-    if(setjmp(jerr.jb)) {
-        LV_LOG_WARN("read jpeg orientation failed");
-        jpeg_destroy_decompress(&cinfo);
-        return false;
+    if(!get_jpeg_direction(&cinfo, orientation)) {
+        LV_LOG_WARN("read jpeg orientation failed.");
     }
 
-    jpeg_create_decompress(&cinfo);
+    /*Report the size the image will be decoded with*/
+    cinfo.out_color_space = JCS_EXT_BGRX;
+    set_scale(args, &cinfo, *orientation);
+    jpeg_calc_output_dimensions(&cinfo);
 
-    jpeg_mem_src(&cinfo, data, data_size);
+    *width = cinfo.output_width;
+    *height = cinfo.output_height;
 
-    jpeg_save_markers(&cinfo, JPEG_APP0 + 1, 0xFFFF);
+    jpeg_destroy_decompress(&cinfo);
 
-    cinfo.marker->read_markers(&cinfo);
+    return true;
+}
 
-    jpeg_saved_marker_ptr marker = cinfo.marker_list;
+/**
+ * Get the rotation from the Exif data saved by `jpeg_save_markers()` while reading the header
+ */
+static bool get_jpeg_direction(j_decompress_ptr cinfo, uint32_t * orientation)
+{
+    jpeg_saved_marker_ptr marker = cinfo->marker_list;
     while(marker != NULL) {
         if(marker->marker == JPEG_APP0 + 1) {
             JOCTET FAR * app1_data = marker->data;
             if(TRANS_32_VALUE(true, app1_data) == JPEG_EXIF) {
                 uint16_t endian_tag = TRANS_16_VALUE(true, app1_data + 4 + 2);
                 if(!(endian_tag == JPEG_LITTLE_ENDIAN_TAG || endian_tag == JPEG_BIG_ENDIAN_TAG)) {
-                    jpeg_destroy_decompress(&cinfo);
                     return false;
                 }
                 bool is_big_endian = endian_tag == JPEG_BIG_ENDIAN_TAG;
@@ -514,13 +508,11 @@ static bool get_jpeg_direction(uint8_t * data, uint32_t data_size, uint32_t * or
                     /* ifd start: 4bytes(Exif) + 2bytes(0x00) + offset value(2bytes(align) + 2bytes(tag mark) + 4bytes(offset size)) */
                     unsigned int entry_offset = 4 + 2 + offset + 2;
                     if(entry_offset >= marker->data_length) {
-                        jpeg_destroy_decompress(&cinfo);
                         return false;
                     }
                     ifd = app1_data + entry_offset;
                     unsigned short num_entries = TRANS_16_VALUE(is_big_endian, ifd - 2);
                     if(entry_offset + num_entries * 12 >= marker->data_length) {
-                        jpeg_destroy_decompress(&cinfo);
                         return false;
                     }
                     for(int i = 0; i < num_entries; i++) {
@@ -556,9 +548,7 @@ static bool get_jpeg_direction(uint8_t * data, uint32_t data_size, uint32_t * or
         marker = marker->next;
     }
 
-    jpeg_destroy_decompress(&cinfo);
-
-    return JPEG_HEADER_OK;
+    return true;
 }
 
 static void rotate_buffer(lv_draw_buf_t * decoded, uint8_t * buffer, uint32_t line_index, uint32_t angle)
@@ -586,6 +576,191 @@ static void rotate_buffer(lv_draw_buf_t * decoded, uint8_t * buffer, uint32_t li
     }
 }
 
+/**
+ * Set the largest IDCT scaling which still keeps the image at least as large as the target size
+ */
+static void set_scale(const lv_image_decoder_args_t * args, j_decompress_ptr cinfo, uint32_t orientation)
+{
+    cinfo->scale_num = 1;
+    cinfo->scale_denom = 1;
+    if(args->target_w <= 0 && args->target_h <= 0) return;
+
+    /*The target size is in the orientation the image is shown with*/
+    int32_t target_w = (orientation % 180) ? args->target_h : args->target_w;
+    int32_t target_h = (orientation % 180) ? args->target_w : args->target_h;
+
+    uint32_t denom;
+    for(denom = 8; denom > 1; denom /= 2) {
+        int32_t scaled_w = (cinfo->image_width + denom - 1) / denom;
+        int32_t scaled_h = (cinfo->image_height + denom - 1) / denom;
+        if(scaled_w >= target_w && scaled_h >= target_h) break;
+    }
+
+    cinfo->scale_denom = denom;
+}
+
+static lv_result_t decode_band(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, lv_draw_buf_t * band,
+                               int32_t x, int32_t y)
+{
+    LV_UNUSED(decoder); /*Unused*/
+    jpeg_band_t * band_dsc = dsc->user_data;
+    struct jpeg_decompress_struct * cinfo = &band_dsc->cinfo;
+    int32_t w = band->header.w;
+
+    if(setjmp(band_dsc->jerr.jb)) {
+        LV_LOG_WARN("decoding error");
+        band_reader_close(band_dsc);
+        return LV_RESULT_INVALID;
+    }
+
+    /*The rows can be read only forward and with the same cropping, start again if needed*/
+    if(band_dsc->reading && (y < (int32_t)cinfo->output_scanline || x != band_dsc->x || w != band_dsc->w)) {
+        band_reader_close(band_dsc);
+    }
+
+    if(!band_dsc->reading && band_reader_open(&dsc->args, band_dsc, dsc->src, x, w) != LV_RESULT_OK) {
+        return LV_RESULT_INVALID;
+    }
+
+    /*Skip the rows above the band without the color conversion and IDCT*/
+    if((int32_t)cinfo->output_scanline < y) {
+        jpeg_skip_scanlines(cinfo, y - cinfo->output_scanline);
+    }
+
+    int32_t y_end = y + band->header.h;
+    while((int32_t)cinfo->output_scanline < y_end) {
+        JSAMPROW row = band->data + (cinfo->output_scanline - y) * band->header.stride;
+        if(band_dsc->row == NULL) {
+            jpeg_read_scanlines(cinfo, &row, 1);
+        }
+        else {
+            jpeg_read_scanlines(cinfo, band_dsc->row, 1);
+            lv_memcpy(row, band_dsc->row[0] + (x - band_dsc->crop_x) * JPEG_PIXEL_SIZE, w * JPEG_PIXEL_SIZE);
+        }
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Prepare reading the `w` wide rows of an image from column `x`.
+ * The errors of libjpeg-turbo are handled by the `setjmp` of the caller.
+ */
+static lv_result_t band_reader_open(const lv_image_decoder_args_t * args, jpeg_band_t * band_dsc,
+                                    const char * filename, int32_t x, int32_t w)
+{
+    lv_fs_res_t res = lv_fs_open(&band_dsc->file, filename, LV_FS_MODE_RD);
+    if(res != LV_FS_RES_OK) {
+        LV_LOG_WARN("can't open %s", filename);
+        return LV_RESULT_INVALID;
+    }
+
+    struct jpeg_decompress_struct * cinfo = &band_dsc->cinfo;
+    cinfo->err = jpeg_std_error(&band_dsc->jerr.pub);
+    band_dsc->jerr.pub.error_exit = error_exit;
+    jpeg_create_decompress(cinfo);
+    band_dsc->reading = true;
+
+    fs_src_set(cinfo, &band_dsc->file);
+    jpeg_read_header(cinfo, TRUE);
+    cinfo->out_color_space = JCS_EXT_BGRX;
+    set_scale(args, cinfo, 0);
+    jpeg_start_decompress(cinfo);
+
+    /*Skip the IDCT and color conversion of the columns outside of the bands.
+     *libjpeg-turbo extends the columns to whole MCUs.*/
+    JDIMENSION crop_x = x;
+    JDIMENSION crop_w = w;
+    if(crop_w < cinfo->output_width) jpeg_crop_scanline(cinfo, &crop_x, &crop_w);
+
+    band_dsc->x = x;
+    band_dsc->w = w;
+    band_dsc->crop_x = crop_x;
+    band_dsc->row = NULL;
+    if(crop_x != (JDIMENSION)x || crop_w != (JDIMENSION)w) {
+        band_dsc->row = (*cinfo->mem->alloc_sarray)((j_common_ptr)cinfo, JPOOL_IMAGE, crop_w * JPEG_PIXEL_SIZE, 1);
+    }
+
+    return LV_RESULT_OK;
+}
+
+static void band_reader_close(jpeg_band_t * band_dsc)
+{
+    if(!band_dsc->reading) return;
+
+    jpeg_destroy_decompress(&band_dsc->cinfo);
+    lv_fs_close(&band_dsc->file);
+    band_dsc->reading = false;
+}
+
+/**
+ * Read the compressed data from an opened `lv_fs` file instead of loading the whole file into the RAM
+ */
+static void fs_src_set(j_decompress_ptr cinfo, lv_fs_file_t * file)
+{
+    /*Allocate in the permanent pool to free them with the decompression object*/
+    fs_source_mgr_t * src = (*cinfo->mem->alloc_small)((j_common_ptr)cinfo, JPOOL_PERMANENT, sizeof(fs_source_mgr_t));
+    src->buf = (*cinfo->mem->alloc_small)((j_common_ptr)cinfo, JPOOL_PERMANENT, JPEG_INPUT_BUF_SIZE);
+    src->file = file;
+
+    src->pub.init_source = fs_src_init;
+    src->pub.fill_input_buffer = fs_src_fill;
+    src->pub.skip_input_data = fs_src_skip;
+    src->pub.resync_to_restart = jpeg_resync_to_restart;
+    src->pub.term_source = fs_src_term;
+    src->pub.bytes_in_buffer = 0;
+    src->pub.next_input_byte = NULL;
+
+    cinfo->src = &src->pub;
+}
+
+static void fs_src_init(j_decompress_ptr cinfo)
+{
+    LV_UNUSED(cinfo);
+}
+
+static boolean fs_src_fill(j_decompress_ptr cinfo)
+{
+    fs_source_mgr_t * src = (fs_source_mgr_t *)cinfo->src;
+
+    uint32_t rn = 0;
+    lv_fs_res_t res = lv_fs_read(src->file, src->buf, JPEG_INPUT_BUF_SIZE, &rn);
+    if(res != LV_FS_RES_OK || rn == 0) {
+        /*Insert a fake EOI marker to finish truncated files as well as possible*/
+        WARNMS(cinfo, JWRN_JPEG_EOF);
+        src->buf[0] = 0xFF;
+        src->buf[1] = JPEG_EOI;
+        rn = 2;
+    }
+
+    src->pub.next_input_byte = src->buf;
+    src->pub.bytes_in_buffer = rn;
+
+    return TRUE;
+}
+
+static void fs_src_skip(j_decompress_ptr cinfo, long num_bytes)
+{
+    fs_source_mgr_t * src = (fs_source_mgr_t *)cinfo->src;
+    if(num_bytes <= 0) return;
+
+    if((size_t)num_bytes <= src->pub.bytes_in_buffer) {
+        src->pub.next_input_byte += num_bytes;
+        src->pub.bytes_in_buffer -= num_bytes;
+        return;
+    }
+
+    /*Seek over the rest without reading it. At the end of the file `fs_src_fill` inserts an EOI.*/
+    num_bytes -= src->pub.bytes_in_buffer;
+    src->pub.bytes_in_buffer = 0;
+    lv_fs_seek(src->file, num_bytes, LV_FS_SEEK_CUR);
+}
+
+static void fs_src_term(j_decompress_ptr cinfo)
+{
+    LV_UNUSED(cinfo);
+}
+
 static void error_exit(j_common_ptr cinfo)
 {
     error_mgr_t * myerr = (error_mgr_t *)cinfo->err;
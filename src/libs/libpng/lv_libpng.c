@@ -21,17 +21,35 @@
 
 #define image_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers)
 
+/*Set in the header of interlaced images as they can't be decoded row by row*/
+#define PNG_FLAG_INTERLACED     LV_IMAGE_FLAGS_USER1
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*State of decoding an image in bands*/
+typedef struct {
+    lv_fs_file_t file;
+    png_structp png;            /*NULL if no rows are being read*/
+    png_infop info;
+    int32_t next_row;           /*The next row libpng will return*/
+} png_band_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * src, lv_image_header_t * header);
 static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area);
 static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 static lv_draw_buf_t * decode_png_file(lv_image_decoder_dsc_t * dsc, const char * filename);
+static lv_result_t decode_band(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, lv_draw_buf_t * band,
+                               int32_t x, int32_t y);
+static void png_read_cb(png_structp png, png_bytep data, size_t length);
+static lv_result_t band_reader_open(png_band_t * band_dsc, const char * filename);
+static void band_reader_close(png_band_t * band_dsc);
 
 /**********************
  *  STATIC VARIABLES
@@ -53,6 +71,7 @@ void lv_libpng_init(void)
     lv_image_decoder_t * dec = lv_image_decoder_create();
     lv_image_decoder_set_info_cb(dec, decoder_info);
     lv_image_decoder_set_open_cb(dec, decoder_open);
+    lv_image_decoder_set_get_area_cb(dec, decoder_get_area);
     lv_image_decoder_set_close_cb(dec, decoder_close);
 
     dec->name = DECODER_NAME;
@@ -90,8 +109,9 @@ static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_d
         /* Read the width and height from the file. They have a constant location:
          * [16..19]: width
          * [20..23]: height
+         * [28]: interlace method
          */
-        uint8_t buf[24];
+        uint8_t buf[29];
         uint32_t rn;
         lv_fs_read(&dsc->file, buf, sizeof(buf), &rn);
 
@@ -106,6 +126,7 @@ static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_d
         /*The width and height are stored in Big endian format so convert them to little endian*/
         header->w = (int32_t)((size[0] & 0xff000000) >> 24) + ((size[0] & 0x00ff0000) >> 8);
         header->h = (int32_t)((size[1] & 0xff000000) >> 24) + ((size[1] & 0x00ff0000) >> 8);
+        if(buf[28] != 0) header->flags |= PNG_FLAG_INTERLACED;
 
         return LV_RESULT_OK;
     }
@@ -126,6 +147,14 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
 
     /*If it's a PNG file...*/
     if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        if(!(dsc->header.flags & PNG_FLAG_INTERLACED) && lv_image_decoder_use_bands(dsc, LV_COLOR_FORMAT_ARGB8888)) {
+            /*Decode only the bands to draw in `decoder_get_area`*/
+            dsc->user_data = lv_malloc_zeroed(sizeof(png_band_t));
+            LV_ASSERT_MALLOC(dsc->user_data);
+            LV_PROFILER_DECODER_END_TAG("lv_libpng_decoder_open");
+            return dsc->user_data ? LV_RESULT_OK : LV_RESULT_INVALID;
+        }
+
         const char * fn = dsc->src;
         lv_draw_buf_t * decoded = decode_png_file(dsc, fn);
         if(decoded == NULL) {
@@ -182,6 +211,25 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
     return LV_RESULT_INVALID;    /*If not returned earlier then it failed*/
 }
 
+/**
+ * Decode the bands of a large image which cover an area
+ * @param decoder       pointer to the decoder
+ * @param dsc           pointer to the decoder descriptor
+ * @param full_area     the area to decode, relative to the image
+ * @param decoded_area  the decoded band
+ * @return              LV_RESULT_OK: a band is decoded; LV_RESULT_INVALID: failed or there are no more bands
+ */
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area)
+{
+    LV_UNUSED(decoder); /*Unused*/
+
+    /*The image is decoded entirely*/
+    if(dsc->user_data == NULL) return LV_RESULT_INVALID;
+
+    return lv_image_decoder_get_band(dsc, full_area, decoded_area, LV_COLOR_FORMAT_ARGB8888, 1, 0, decode_band);
+}
+
 /**
  * Free the allocated resources
  */
@@ -189,6 +237,14 @@ static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t *
 {
     LV_UNUSED(decoder); /*Unused*/
 
+    png_band_t * band_dsc = dsc->user_data;
+    if(band_dsc) {
+        band_reader_close(band_dsc);
+        lv_free(band_dsc);
+        lv_image_decoder_release_band(dsc);
+        return;
+    }
+
     if(dsc->args.no_cache ||
        !lv_image_cache_is_enabled()) lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, (lv_draw_buf_t *)dsc->decoded);
 }
@@ -308,4 +364,98 @@ static lv_draw_buf_t * decode_png_file(lv_image_decoder_dsc_t * dsc, const char
     return decoded;
 }
 
+static lv_result_t decode_band(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, lv_draw_buf_t * band,
+                               int32_t x, int32_t y)
+{
+    LV_UNUSED(decoder); /*Unused*/
+    LV_UNUSED(x);       /*The bands are not cropped*/
+    LV_PROFILER_DECODER_BEGIN_TAG("lv_libpng_decode_band");
+
+    png_band_t * band_dsc = dsc->user_data;
+
+    /*The rows can be read only forward, start again for the upper bands*/
+    if(band_dsc->png && y < band_dsc->next_row) band_reader_close(band_dsc);
+
+    if(band_dsc->png == NULL && band_reader_open(band_dsc, dsc->src) != LV_RESULT_OK) {
+        LV_PROFILER_DECODER_END_TAG("lv_libpng_decode_band");
+        return LV_RESULT_INVALID;
+    }
+
+    if(setjmp(png_jmpbuf(band_dsc->png))) {
+        LV_LOG_WARN("png decode failed: %s", (const char *)dsc->src);
+        band_reader_close(band_dsc);
+        LV_PROFILER_DECODER_END_TAG("lv_libpng_decode_band");
+        return LV_RESULT_INVALID;
+    }
+
+    /*Skip the rows above the band. The first row of the band is a good scratch buffer.*/
+    while(band_dsc->next_row < y) {
+        png_read_row(band_dsc->png, band->data, NULL);
+        band_dsc->next_row++;
+    }
+
+    uint32_t i;
+    for(i = 0; i < band->header.h; i++) {
+        png_read_row(band_dsc->png, band->data + i * band->header.stride, NULL);
+        band_dsc->next_row++;
+    }
+
+    LV_PROFILER_DECODER_END_TAG("lv_libpng_decode_band");
+    return LV_RESULT_OK;
+}
+
+static void png_read_cb(png_structp png, png_bytep data, size_t length)
+{
+    lv_fs_file_t * f = png_get_io_ptr(png);
+    uint32_t rn = 0;
+    lv_fs_res_t res = lv_fs_read(f, data, length, &rn);
+    if(res != LV_FS_RES_OK || rn != length) png_error(png, "read failed");
+}
+
+static lv_result_t band_reader_open(png_band_t * band_dsc, const char * filename)
+{
+    lv_fs_res_t res = lv_fs_open(&band_dsc->file, filename, LV_FS_MODE_RD);
+    if(res != LV_FS_RES_OK) {
+        LV_LOG_WARN("can't open %s", filename);
+        return LV_RESULT_INVALID;
+    }
+
+    band_dsc->png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    if(band_dsc->png == NULL) {
+        lv_fs_close(&band_dsc->file);
+        return LV_RESULT_INVALID;
+    }
+
+    band_dsc->info = png_create_info_struct(band_dsc->png);
+    if(band_dsc->info == NULL || setjmp(png_jmpbuf(band_dsc->png))) {
+        LV_LOG_WARN("png file: %s read failed", filename);
+        band_reader_close(band_dsc);
+        return LV_RESULT_INVALID;
+    }
+
+    png_set_read_fn(band_dsc->png, &band_dsc->file, png_read_cb);
+    png_read_info(band_dsc->png, band_dsc->info);
+
+    /*Convert everything to 8 bit BGRA, the same as `PNG_FORMAT_BGRA`*/
+    png_set_expand(band_dsc->png);
+    png_set_strip_16(band_dsc->png);
+    png_set_gray_to_rgb(band_dsc->png);
+    png_set_bgr(band_dsc->png);
+    png_set_filler(band_dsc->png, 0xff, PNG_FILLER_AFTER);
+    png_read_update_info(band_dsc->png, band_dsc->info);
+
+    band_dsc->next_row = 0;
+    return LV_RESULT_OK;
+}
+
+static void band_reader_close(png_band_t * band_dsc)
+{
+    if(band_dsc->png == NULL) return;
+
+    png_destroy_read_struct(&band_dsc->png, band_dsc->info ? &band_dsc->info : NULL, NULL);
+    band_dsc->png = NULL;
+    band_dsc->info = NULL;
+    lv_fs_close(&band_dsc->file);
+}
+
 #endif /*LV_USE_LIBPNG*/
@@ -7,6 +7,7 @@
  *********************/
 
 #include "../../stdlib/lv_string.h"
+#include "../../misc/lv_math.h"
 #include "lv_rle.h"
 
 #if LV_USE_RLE
@@ -23,6 +24,8 @@
  *  STATIC PROTOTYPES
  **********************/
 
+static void fill_blocks(uint8_t * output, const uint8_t * block, uint32_t blk_size, uint32_t cnt);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -39,67 +42,36 @@ uint32_t lv_rle_decompress(const uint8_t * input,
                            uint32_t input_buff_len, uint8_t * output,
                            uint32_t output_buff_len, uint8_t blk_size)
 {
-    uint32_t ctrl_byte;
-    uint32_t rd_len = 0;
+    const uint8_t * input_end = input + input_buff_len;
     uint32_t wr_len = 0;
 
-    while(rd_len < input_buff_len) {
-        ctrl_byte = input[0];
-        rd_len++;
-        input++;
-        if(rd_len > input_buff_len)
+    while(input < input_end) {
+        uint32_t ctrl_byte = *input++;
+        bool literal = ctrl_byte & 0x80;
+        uint32_t cnt = ctrl_byte & 0x7f;
+        uint32_t bytes = blk_size * cnt;
+
+        /*A literal run is followed by all of its blocks, a repeated run only by one block*/
+        uint32_t rd_len = literal ? bytes : blk_size;
+        if(rd_len > (uint32_t)(input_end - input))
             return 0;
 
-        if(ctrl_byte & 0x80) {
-            /* copy directly from input to output */
-            uint32_t bytes = blk_size * (ctrl_byte & 0x7f);
-            rd_len += bytes;
-            if(rd_len > input_buff_len)
-                return 0;
-
-            wr_len += bytes;
-            if(wr_len > output_buff_len) {
-                if(wr_len > output_buff_len + blk_size)
-                    return 0; /* Error */
-                lv_memcpy(output, input, output_buff_len - (wr_len - bytes));
-                return output_buff_len;
-            }
-
-            lv_memcpy(output, input, bytes);
-            output += bytes;
-            input += bytes;
-        }
-        else {
-            rd_len += blk_size;
-            if(rd_len > input_buff_len)
-                return 0;
-
-            wr_len += blk_size * ctrl_byte;
-            if(wr_len > output_buff_len) {
-                if(wr_len > output_buff_len + blk_size)
-                    return 0; /* Error happened */
-
-                /* Skip the last pixel, which could overflow output buffer.*/
-                for(uint32_t i = 0; i < ctrl_byte - 1; i++) {
-                    lv_memcpy(output, input, blk_size);
-                    output += blk_size;
-                }
-                return output_buff_len;
-            }
-
-            if(blk_size == 1) {
-                /* optimize the most common case. */
-                lv_memset(output, input[0], ctrl_byte);
-                output += ctrl_byte;
-            }
-            else {
-                for(uint32_t i = 0; i < ctrl_byte; i++) {
-                    lv_memcpy(output, input, blk_size);
-                    output += blk_size;
-                }
-            }
-            input += blk_size;
+        if(wr_len + bytes > output_buff_len) {
+            if(wr_len + bytes > output_buff_len + blk_size)
+                return 0; /* Error happened */
+
+            /* Skip the last pixel, which could overflow output buffer.*/
+            if(literal) lv_memcpy(output, input, output_buff_len - wr_len);
+            else fill_blocks(output, input, blk_size, cnt - 1);
+            return output_buff_len;
         }
+
+        if(literal) lv_memcpy(output, input, bytes);
+        else fill_blocks(output, input, blk_size, cnt);
+
+        input += rd_len;
+        output += bytes;
+        wr_len += bytes;
     }
 
     return wr_len;
@@ -109,4 +81,48 @@ uint32_t lv_rle_decompress(const uint8_t * input,
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Repeat a block of `blk_size` bytes `cnt` times
+ * @param output    write the blocks here
+ * @param block     the block to repeat
+ * @param blk_size  size of the block in bytes
+ * @param cnt       number of blocks to write
+ */
+static void fill_blocks(uint8_t * output, const uint8_t * block, uint32_t blk_size, uint32_t cnt)
+{
+    if(cnt == 0) return;
+
+    if(blk_size == 1) {
+        lv_memset(output, block[0], cnt);
+        return;
+    }
+
+    /*Store whole words if possible, the compilers can vectorize these loops*/
+    if(blk_size == 2 && ((lv_uintptr_t)output & 0x1) == 0) {
+        uint16_t v;
+        lv_memcpy(&v, block, sizeof(v));
+        uint16_t * out16 = (uint16_t *)output;
+        while(cnt--) *out16++ = v;
+        return;
+    }
+
+    if(blk_size == 4 && ((lv_uintptr_t)output & 0x3) == 0) {
+        uint32_t v;
+        lv_memcpy(&v, block, sizeof(v));
+        uint32_t * out32 = (uint32_t *)output;
+        while(cnt--) *out32++ = v;
+        return;
+    }
+
+    /*Write the block once and keep doubling the already written part*/
+    uint32_t len = blk_size * cnt;
+    uint32_t done = blk_size;
+    lv_memcpy(output, block, blk_size);
+    while(done < len) {
+        uint32_t n = LV_MIN(done, len - done);
+        lv_memcpy(output + done, output, n);
+        done += n;
+    }
+}
+
 #endif /*LV_USE_RLE*/
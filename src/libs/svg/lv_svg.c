@@ -15,6 +15,7 @@
 
 #include "lv_svg_token.h"
 #include "lv_svg_parser.h"
+#include "lv_svg_render.h"
 
 /*********************
 *      DEFINES
@@ -117,6 +118,11 @@ void lv_svg_node_delete(lv_svg_node_t * node)
 {
     LV_ASSERT_NULL(node);
     lv_tree_node_delete((lv_tree_node_t *)node);
+
+#if LV_USE_VECTOR_GRAPHIC
+    /*The kept paths belong to a document which doesn't exist or changed*/
+    lv_draw_svg_cache_drop();
+#endif
 }
 
 /**********************
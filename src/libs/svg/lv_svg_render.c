@@ -201,14 +201,32 @@ struct _lv_svg_drawing_builder_state {
     lv_svg_render_obj_t * tail;
 };
 
+/*The recorded vector draw tasks of a document drawn with a transformation*/
+typedef struct {
+    const lv_svg_node_t * doc;
+    lv_matrix_t matrix;
+    lv_ll_t * task_list;
+} _lv_svg_display_list_t;
+
 /**********************
  *  STATIC VARIABLES
  **********************/
 static lv_svg_render_hal_t hal_funcs = {NULL};
+#if LV_SVG_DISPLAY_LIST_CACHE_CNT > 0
+    static lv_cache_t * display_list_cache = NULL;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_SVG_DISPLAY_LIST_CACHE_CNT > 0
+    static lv_cache_entry_t * _display_list_acquire(const lv_svg_node_t * svg_doc, const lv_matrix_t * matrix);
+    static bool _display_list_create_cb(_lv_svg_display_list_t * item, void * user_data);
+    static void _display_list_free_cb(_lv_svg_display_list_t * item, void * user_data);
+    static lv_cache_compare_res_t _display_list_compare_cb(const _lv_svg_display_list_t * lhs,
+                                                           const _lv_svg_display_list_t * rhs);
+#endif
+
 void lv_svg_render_init(const lv_svg_render_hal_t * hal)
 {
     if(hal) {
@@ -2181,12 +2199,37 @@ void lv_draw_svg_render(lv_vector_dsc_t * dsc, const lv_svg_render_obj_t * rende
 }
 
 void lv_draw_svg(lv_layer_t * layer, const lv_svg_node_t * svg_doc)
+{
+    lv_draw_svg_transformed(layer, svg_doc, NULL);
+}
+
+void lv_draw_svg_transformed(lv_layer_t * layer, const lv_svg_node_t * svg_doc, const lv_matrix_t * matrix)
 {
     if(!svg_doc) {
         return;
     }
 
     lv_vector_dsc_t * dsc = lv_vector_dsc_create(layer);
+
+#if LV_SVG_DISPLAY_LIST_CACHE_CNT > 0
+    lv_cache_entry_t * entry = _display_list_acquire(svg_doc, matrix);
+    if(entry) {
+        const _lv_svg_display_list_t * display_list = lv_cache_entry_get_data(entry);
+        if(display_list->task_list) {
+            _lv_vector_dsc_add_tasks(dsc, display_list->task_list);
+        }
+        lv_cache_release(display_list_cache, entry, NULL);
+
+        lv_draw_vector(dsc);
+        lv_vector_dsc_delete(dsc);
+        return;
+    }
+#endif
+
+    if(matrix) {
+        lv_vector_dsc_set_transform(dsc, matrix);
+    }
+
     lv_svg_render_obj_t * list = lv_svg_render_create(svg_doc);
     lv_draw_svg_render(dsc, list);
     lv_draw_vector(dsc);
@@ -2194,7 +2237,104 @@ void lv_draw_svg(lv_layer_t * layer, const lv_svg_node_t * svg_doc)
     lv_vector_dsc_delete(dsc);
 }
 
+void lv_draw_svg_cache_drop(void)
+{
+#if LV_SVG_DISPLAY_LIST_CACHE_CNT > 0
+    if(display_list_cache) {
+        lv_cache_drop_all(display_list_cache, NULL);
+    }
+#endif
+}
+
+void lv_svg_render_deinit(void)
+{
+#if LV_SVG_DISPLAY_LIST_CACHE_CNT > 0
+    if(display_list_cache) {
+        lv_cache_destroy(display_list_cache, NULL);
+        display_list_cache = NULL;
+    }
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+#if LV_SVG_DISPLAY_LIST_CACHE_CNT > 0
+static lv_cache_entry_t * _display_list_acquire(const lv_svg_node_t * svg_doc, const lv_matrix_t * matrix)
+{
+    if(!display_list_cache) {
+        lv_cache_ops_t ops = {
+            .compare_cb = (lv_cache_compare_cb_t)_display_list_compare_cb,
+            .create_cb = (lv_cache_create_cb_t)_display_list_create_cb,
+            .free_cb = (lv_cache_free_cb_t)_display_list_free_cb,
+        };
+
+        display_list_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(_lv_svg_display_list_t),
+                                             LV_SVG_DISPLAY_LIST_CACHE_CNT, ops);
+        if(!display_list_cache) {
+            return NULL;
+        }
+        lv_cache_set_name(display_list_cache, "SVG_DISPLAY_LIST");
+    }
+
+    _lv_svg_display_list_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.doc = svg_doc;
+    if(matrix) {
+        lv_memcpy(&search_key.matrix, matrix, sizeof(lv_matrix_t));
+    }
+    else {
+        lv_matrix_identity(&search_key.matrix);
+    }
+
+    return lv_cache_acquire_or_create(display_list_cache, &search_key, NULL);
+}
+
+static bool _display_list_create_cb(_lv_svg_display_list_t * item, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    /*Record all paths, they are clipped to the real layer each time the list is drawn*/
+    lv_layer_t layer;
+    lv_memzero(&layer, sizeof(layer));
+    lv_area_set(&layer._clip_area, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MAX, LV_COORD_MAX);
+
+    lv_vector_dsc_t * dsc = lv_vector_dsc_create(&layer);
+    lv_vector_dsc_set_transform(dsc, &item->matrix);
+
+    lv_svg_render_obj_t * list = lv_svg_render_create(item->doc);
+    lv_draw_svg_render(dsc, list);
+    lv_svg_render_delete(list);
+
+    item->task_list = dsc->tasks.task_list;
+    dsc->tasks.task_list = NULL;
+    lv_vector_dsc_delete(dsc);
+    return true;
+}
+
+static void _display_list_free_cb(_lv_svg_display_list_t * item, void * user_data)
+{
+    LV_UNUSED(user_data);
+    if(item->task_list) {
+        _lv_vector_for_each_destroy_tasks(item->task_list, NULL, NULL);
+        item->task_list = NULL;
+    }
+}
+
+static lv_cache_compare_res_t _display_list_compare_cb(const _lv_svg_display_list_t * lhs,
+                                                       const _lv_svg_display_list_t * rhs)
+{
+    if(lhs->doc != rhs->doc) {
+        return lhs->doc > rhs->doc ? 1 : -1;
+    }
+
+    int32_t cmp_res = lv_memcmp(&lhs->matrix, &rhs->matrix, sizeof(lv_matrix_t));
+    if(cmp_res != 0) {
+        return cmp_res > 0 ? 1 : -1;
+    }
+
+    return 0;
+}
+#endif /*LV_SVG_DISPLAY_LIST_CACHE_CNT > 0*/
 #endif /*LV_USE_SVG*/
@@ -13,6 +13,7 @@
 
 #if LV_USE_SVG && LV_USE_VECTOR_GRAPHIC
 #include "lv_svg.h"
+#include "../../draw/lv_draw_vector.h"
 
 /*********************
  *      DEFINES
@@ -87,6 +88,27 @@ void lv_draw_svg_render(lv_vector_dsc_t * dsc, const lv_svg_render_obj_t * rende
  */
 void lv_draw_svg(lv_layer_t * layer, const lv_svg_node_t * svg_doc);
 
+/**
+ * @brief Draw an SVG document to a layer with a transformation.
+ *        The paths of the document are kept for each document and transformation
+ *        (see `LV_SVG_DISPLAY_LIST_CACHE_CNT`), so drawing it again doesn't need to build them again.
+ * @param layer pointer to the target layer
+ * @param svg_doc pointer to the SVG document to draw
+ * @param matrix the transformation of the document, NULL to draw it without transformation
+ */
+void lv_draw_svg_transformed(lv_layer_t * layer, const lv_svg_node_t * svg_doc, const lv_matrix_t * matrix);
+
+/**
+ * @brief Drop the kept paths of all SVG documents.
+ *        Needs to be called if a drawn SVG document is modified.
+ */
+void lv_draw_svg_cache_drop(void);
+
+/**
+ * @brief Deinitialize the SVG render and free its cache
+ */
+void lv_svg_render_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
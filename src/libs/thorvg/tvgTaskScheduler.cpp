@@ -23,8 +23,9 @@
 #include "../../lv_conf_internal.h"
 #if LV_USE_THORVG_INTERNAL
 
-#include <vector>
+#include <cstdlib>
 #include <atomic>
+#include "tvgArray.h"
 #include "tvgTaskScheduler.h"
 
 /************************************************************************/
@@ -35,19 +36,134 @@ namespace tvg {
 
 static thread_local bool _async = true;  //toggle async tasking for each thread on/off
 
+#if LV_USE_OS != LV_OS_NONE
+
+struct TaskSchedulerImpl;
+
+struct TaskQueue
+{
+    Array<Task*>       tasks;
+    uint32_t           head = 0;
+    lv_mutex_t         mtx;
+    lv_thread_sync_t   sync;                //signaled when a task is pushed or the worker should exit
+    lv_thread_t        thread;
+    TaskSchedulerImpl* scheduler = nullptr;
+    unsigned           tid = 0;
+    bool               exit = false;
+
+    //the caller must hold the lock
+    Task* pop()
+    {
+        if (head == tasks.count) return nullptr;
+        auto task = tasks.data[head++];
+        if (head == tasks.count) {
+            tasks.clear();
+            head = 0;
+        }
+        return task;
+    }
+};
+
+#endif
 
 struct TaskSchedulerImpl
 {
-    TaskSchedulerImpl(unsigned threadCnt)
+#if LV_USE_OS != LV_OS_NONE
+    TaskQueue* queues = nullptr;
+    atomic<unsigned> idx{0};
+#endif
+    unsigned threadCnt = 0;
+
+    TaskSchedulerImpl(unsigned threads)
     {
+#if LV_USE_OS != LV_OS_NONE
+        if (threads == 0) return;
+
+        queues = new TaskQueue[threads];
+        for (unsigned i = 0; i < threads; ++i) {
+            queues[i].scheduler = this;
+            queues[i].tid = i + 1;    //tid 0 is reserved for the tasks running in the caller's thread
+            lv_mutex_init(&queues[i].mtx);
+            lv_thread_sync_init(&queues[i].sync);
+        }
+        threadCnt = threads;
+
+        for (unsigned i = 0; i < threadCnt; ++i) {
+            lv_thread_init(&queues[i].thread, LV_THREAD_PRIO_HIGH, worker, LV_DRAW_THREAD_STACKSIZE, &queues[i]);
+        }
+#endif
     }
 
     ~TaskSchedulerImpl()
     {
+#if LV_USE_OS != LV_OS_NONE
+        for (unsigned i = 0; i < threadCnt; ++i) {
+            lv_mutex_lock(&queues[i].mtx);
+            queues[i].exit = true;
+            lv_mutex_unlock(&queues[i].mtx);
+            lv_thread_sync_signal(&queues[i].sync);
+        }
+
+        for (unsigned i = 0; i < threadCnt; ++i) {
+            lv_thread_delete(&queues[i].thread);
+            lv_mutex_delete(&queues[i].mtx);
+            lv_thread_sync_delete(&queues[i].sync);
+        }
+
+        delete[] queues;
+#endif
+    }
+
+#if LV_USE_OS != LV_OS_NONE
+    //take a task from the own queue first, then from the queues of the busy workers
+    Task* pop(unsigned i)
+    {
+        for (unsigned n = 0; n < threadCnt; ++n) {
+            auto& queue = queues[(i + n) % threadCnt];
+            lv_mutex_lock(&queue.mtx);
+            auto task = queue.pop();
+            lv_mutex_unlock(&queue.mtx);
+            if (task) return task;
+        }
+        return nullptr;
+    }
+
+    static void worker(void* data)
+    {
+        auto queue = static_cast<TaskQueue*>(data);
+
+        while (true) {
+            auto task = queue->scheduler->pop(queue->tid - 1);
+            if (task) {
+                (*task)(queue->tid);
+                continue;
+            }
+
+            lv_mutex_lock(&queue->mtx);
+            auto exit = queue->exit;
+            lv_mutex_unlock(&queue->mtx);
+            if (exit) break;
+
+            lv_thread_sync_wait(&queue->sync);
+        }
     }
+#endif
 
     void request(Task* task)
     {
+#if LV_USE_OS != LV_OS_NONE
+        //Async
+        if (threadCnt > 0 && _async) {
+            task->prepare();
+            auto& queue = queues[idx++ % threadCnt];
+            lv_mutex_lock(&queue.mtx);
+            queue.tasks.push(task);
+            lv_mutex_unlock(&queue.mtx);
+            lv_thread_sync_signal(&queue.sync);
+            return;
+        }
+#endif
+        //Sync
         task->run(0);
     }
 };
@@ -66,6 +182,13 @@ void TaskScheduler::init(unsigned threads)
     inst = new TaskSchedulerImpl(threads);
 }
 
+void TaskScheduler::term()
+{
+    delete(inst);
+    inst = nullptr;
+}
+
+
 void TaskScheduler::request(Task* task)
 {
     if (inst) inst->request(task);
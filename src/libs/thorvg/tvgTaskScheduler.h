@@ -27,6 +27,7 @@
 #define _TVG_TASK_SCHEDULER_H_
 
 #include "tvgCommon.h"
+#include "../../osal/lv_os.h"
 
 namespace tvg
 {
@@ -36,6 +37,7 @@ struct Task;
 struct TaskScheduler
 {
     static void init(unsigned threads);
+    static void term();
     static void request(Task* task);
     static void async(bool on);
 };
@@ -43,12 +45,27 @@ struct TaskScheduler
 struct Task
 {
 private:
+#if LV_USE_OS != LV_OS_NONE
+    lv_thread_sync_t sync;
+    bool synced = false;
+#endif
+    bool pending = false;
 
 public:
-    virtual ~Task() = default;
+    virtual ~Task()
+    {
+#if LV_USE_OS != LV_OS_NONE
+        if (synced) lv_thread_sync_delete(&sync);
+#endif
+    }
 
     void done()
     {
+        if (!pending) return;
+#if LV_USE_OS != LV_OS_NONE
+        lv_thread_sync_wait(&sync);
+#endif
+        pending = false;
     }
 
 protected:
@@ -58,11 +75,21 @@ private:
     void operator()(unsigned tid)
     {
         run(tid);
-
+#if LV_USE_OS != LV_OS_NONE
+        lv_thread_sync_signal(&sync);
+#endif
     }
 
     void prepare()
     {
+#if LV_USE_OS != LV_OS_NONE
+        //the sync object is created only for the tasks running in a worker thread
+        if (!synced) {
+            lv_thread_sync_init(&sync);
+            synced = true;
+        }
+#endif
+        pending = true;
     }
 
     friend struct TaskSchedulerImpl;
@@ -118,6 +118,10 @@ void lv_tiny_ttf_set_size(lv_font_t * font, int32_t font_size)
     stbtt_GetFontVMetrics(&dsc->info, &dsc->ascent, &dsc->descent, &line_gap);
     font->line_height = (int32_t)(dsc->scale * (dsc->ascent - dsc->descent + line_gap));
     font->base_line = (int32_t)(dsc->scale * (line_gap - dsc->descent));
+
+#if LV_USE_DRAW_SW
+    lv_draw_sw_glyph_atlas_drop();
+#endif
 }
 
 void lv_tiny_ttf_destroy(lv_font_t * font)
@@ -132,6 +136,9 @@ void lv_tiny_ttf_destroy(lv_font_t * font)
         }
 #endif
         lv_cache_drop_all(tiny_ttf_cache, (void *)font->dsc);
+#if LV_USE_DRAW_SW
+        lv_draw_sw_glyph_atlas_drop();
+#endif
         lv_free(ttf);
         font->dsc = NULL;
     }
@@ -401,6 +401,29 @@
         #endif
     #endif
 
+    /* Cache the bitmaps of the recently used glyphs in an A8 atlas of
+     * LV_DRAW_SW_GLYPH_ATLAS_SIZE x LV_DRAW_SW_GLYPH_ATLAS_SIZE pixels per draw unit
+     * and blend the glyphs of a text run in one step.
+     * 0: to disable the atlas */
+    #ifndef LV_DRAW_SW_GLYPH_ATLAS_SIZE
+        #ifdef CONFIG_LV_DRAW_SW_GLYPH_ATLAS_SIZE
+            #define LV_DRAW_SW_GLYPH_ATLAS_SIZE CONFIG_LV_DRAW_SW_GLYPH_ATLAS_SIZE
+        #else
+            #define LV_DRAW_SW_GLYPH_ATLAS_SIZE 0
+        #endif
+    #endif
+
+    /* Cache the coverage masks of the solid filled or stroked vector paths.
+     * Redrawing the same path with other colors or opacity blends only the cached mask.
+     * The size of the cache in bytes. 0: to disable the cache */
+    #ifndef LV_DRAW_SW_VECTOR_CACHE_SIZE
+        #ifdef CONFIG_LV_DRAW_SW_VECTOR_CACHE_SIZE
+            #define LV_DRAW_SW_VECTOR_CACHE_SIZE CONFIG_LV_DRAW_SW_VECTOR_CACHE_SIZE
+        #else
+            #define LV_DRAW_SW_VECTOR_CACHE_SIZE 0
+        #endif
+    #endif
+
     #ifndef LV_USE_DRAW_SW_ASM
         #ifdef CONFIG_LV_USE_DRAW_SW_ASM
             #define LV_USE_DRAW_SW_ASM CONFIG_LV_USE_DRAW_SW_ASM
@@ -917,6 +940,29 @@
     #endif
 #endif
 
+/*Size of the cache of image bands in bytes.
+ *Large PNG and JPEG files which don't fit into this cache are decoded in horizontal bands while drawing,
+ *so only the visible part of the image needs to be decoded and kept in RAM.
+ *Only the bands of not transformed images are used. If 0, the images are always decoded entirely.*/
+#ifndef LV_IMAGE_BAND_CACHE_DEF_SIZE
+    #ifdef CONFIG_LV_IMAGE_BAND_CACHE_DEF_SIZE
+        #define LV_IMAGE_BAND_CACHE_DEF_SIZE CONFIG_LV_IMAGE_BAND_CACHE_DEF_SIZE
+    #else
+        #define LV_IMAGE_BAND_CACHE_DEF_SIZE 0
+    #endif
+#endif
+
+/*Enable `lv_image_decoder_decode_async()` and `lv_image_cache_prefetch()` to decode images in the background.
+ *With an OS a thread is created for it on the first use.
+ *Requires `LV_CACHE_DEF_SIZE > 0`*/
+#ifndef LV_USE_IMAGE_DECODER_ASYNC
+    #ifdef CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+        #define LV_USE_IMAGE_DECODER_ASYNC CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+    #else
+        #define LV_USE_IMAGE_DECODER_ASYNC 0
+    #endif
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -946,6 +992,16 @@
     #endif
 #endif
 
+/* Find the clicked object with a grid of the clickable objects' areas instead of walking the whole object tree.
+ * Useful with many objects. The grid is rebuilt only when the object tree is unchanged between two presses */
+#ifndef LV_USE_INDEV_HIT_INDEX
+    #ifdef CONFIG_LV_USE_INDEV_HIT_INDEX
+        #define LV_USE_INDEV_HIT_INDEX CONFIG_LV_USE_INDEV_HIT_INDEX
+    #else
+        #define LV_USE_INDEV_HIT_INDEX  0
+    #endif
+#endif
+
 /* Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -1501,6 +1557,16 @@
             #define LV_BIDI_BASE_DIR_DEF LV_BASE_DIR_AUTO
         #endif
     #endif
+
+    /*Number of bidi processed lines to cache. The drawn texts are processed only
+     *when they change. 0: disable caching*/
+    #ifndef LV_BIDI_CACHE_CNT
+        #ifdef CONFIG_LV_BIDI_CACHE_CNT
+            #define LV_BIDI_CACHE_CNT CONFIG_LV_BIDI_CACHE_CNT
+        #else
+            #define LV_BIDI_CACHE_CNT 16
+        #endif
+    #endif
 #endif
 
 /*Enable Arabic/Persian processing
@@ -2360,6 +2426,37 @@
     #endif
 #endif
 
+/*Decode the next frame in a background thread while the current one is shown.
+ *Uses an extra buffer of the size of the GIF. Requires LV_USE_OS != LV_OS_NONE*/
+#ifndef LV_GIF_DECODE_ASYNC
+    #ifdef CONFIG_LV_GIF_DECODE_ASYNC
+        #define LV_GIF_DECODE_ASYNC CONFIG_LV_GIF_DECODE_ASYNC
+    #else
+        #define LV_GIF_DECODE_ASYNC 0
+    #endif
+#endif
+
+/*Decode all frames of a GIF in advance and store them in the image cache (LV_CACHE_DEF_SIZE).
+ *Playing the animation only swaps the shown buffer. If the frames don't fit into the cache
+ *they are decoded one by one as normally.*/
+#ifndef LV_GIF_CACHE_FRAMES
+    #ifdef CONFIG_LV_GIF_CACHE_FRAMES
+        #define LV_GIF_CACHE_FRAMES CONFIG_LV_GIF_CACHE_FRAMES
+    #else
+        #define LV_GIF_CACHE_FRAMES 0
+    #endif
+#endif
+#if LV_GIF_CACHE_FRAMES
+    /*Compress the cached frames with LZ4 to fit more of them. Requires LV_USE_LZ4_INTERNAL or LV_USE_LZ4_EXTERNAL*/
+    #ifndef LV_GIF_CACHE_FRAMES_LZ4
+        #ifdef CONFIG_LV_GIF_CACHE_FRAMES_LZ4
+            #define LV_GIF_CACHE_FRAMES_LZ4 CONFIG_LV_GIF_CACHE_FRAMES_LZ4
+        #else
+            #define LV_GIF_CACHE_FRAMES_LZ4 0
+        #endif
+    #endif
+#endif
+
 #ifndef LV_USE_CUSTOM_GIF
     #ifdef CONFIG_LV_USE_CUSTOM_GIF
         #define LV_USE_CUSTOM_GIF CONFIG_LV_USE_CUSTOM_GIF
@@ -2468,6 +2565,17 @@
             #define LV_FREETYPE_CACHE_FT_GLYPH_CNT 256
         #endif
     #endif
+
+    /*Memory used for the rendered glyph bitmaps of all FreeType fonts in bytes.
+     *The bitmaps of every font, size and style share this budget and
+     *the least recently used ones are freed when it's exceeded.*/
+    #ifndef LV_FREETYPE_CACHE_SIZE
+        #ifdef CONFIG_LV_FREETYPE_CACHE_SIZE
+            #define LV_FREETYPE_CACHE_SIZE CONFIG_LV_FREETYPE_CACHE_SIZE
+        #else
+            #define LV_FREETYPE_CACHE_SIZE (64 * 1024)
+        #endif
+    #endif
 #endif
 
 /* Built-in TTF decoder */
@@ -2526,6 +2634,17 @@
     #endif
 #endif
 
+/* Number of worker threads ThorVG prepares and rasterizes the shapes in.
+ * Requires an OS (`LV_USE_OS != LV_OS_NONE`).
+ * 0: prepare the shapes in the thread which draws them */
+#ifndef LV_THORVG_THREAD_CNT
+    #ifdef CONFIG_LV_THORVG_THREAD_CNT
+        #define LV_THORVG_THREAD_CNT CONFIG_LV_THORVG_THREAD_CNT
+    #else
+        #define LV_THORVG_THREAD_CNT 0
+    #endif
+#endif
+
 /*Use lvgl built-in LZ4 lib*/
 #ifndef LV_USE_LZ4_INTERNAL
     #ifdef CONFIG_LV_USE_LZ4_INTERNAL
@@ -2566,6 +2685,17 @@
         #define LV_USE_SVG_DEBUG 0
     #endif
 #endif
+#if LV_USE_SVG
+    /*Number of SVG documents and transformations whose paths are kept by `lv_draw_svg()`
+     *to not parse and build them again on every redraw. 0: disable the cache*/
+    #ifndef LV_SVG_DISPLAY_LIST_CACHE_CNT
+        #ifdef CONFIG_LV_SVG_DISPLAY_LIST_CACHE_CNT
+            #define LV_SVG_DISPLAY_LIST_CACHE_CNT CONFIG_LV_SVG_DISPLAY_LIST_CACHE_CNT
+        #else
+            #define LV_SVG_DISPLAY_LIST_CACHE_CNT 8
+        #endif
+    #endif
+#endif
 
 /*FFmpeg library for image decoding and playing videos
  *Supports all major image formats so do not enable other image decoder with it*/
@@ -2585,6 +2715,16 @@
             #define LV_FFMPEG_DUMP_FORMAT 0
         #endif
     #endif
+
+    /*Decode and convert the frames of the player in a thread into a few buffers.
+     *Requires LV_USE_OS != LV_OS_NONE*/
+    #ifndef LV_FFMPEG_DECODE_ASYNC
+        #ifdef CONFIG_LV_FFMPEG_DECODE_ASYNC
+            #define LV_FFMPEG_DECODE_ASYNC CONFIG_LV_FFMPEG_DECODE_ASYNC
+        #else
+            #define LV_FFMPEG_DECODE_ASYNC 0
+        #endif
+    #endif
 #endif
 
 /*==================
@@ -2745,6 +2885,25 @@
         #endif
     #endif
 
+    /*Profiler counter function, records the value of a counter track*/
+    #if LV_USE_PROFILER_BUILTIN
+        #ifndef LV_PROFILER_COUNTER
+            #ifdef CONFIG_LV_PROFILER_COUNTER
+                #define LV_PROFILER_COUNTER CONFIG_LV_PROFILER_COUNTER
+            #else
+                #define LV_PROFILER_COUNTER   LV_PROFILER_BUILTIN_COUNTER
+            #endif
+        #endif
+    #else
+        #ifndef LV_PROFILER_COUNTER
+            #ifdef CONFIG_LV_PROFILER_COUNTER
+                #define LV_PROFILER_COUNTER CONFIG_LV_PROFILER_COUNTER
+            #else
+                #define LV_PROFILER_COUNTER(name,value) do { LV_UNUSED(name); LV_UNUSED(value); } while(0)
+            #endif
+        #endif
+    #endif
+
     /*Enable layout profiler*/
     #ifndef LV_PROFILER_LAYOUT
         #ifdef CONFIG_LV_PROFILER_LAYOUT
@@ -2834,6 +2993,15 @@
             #define LV_PROFILER_CACHE 0
         #endif
     #endif
+
+    /*Enable sysmon profiler*/
+    #ifndef LV_PROFILER_SYSMON
+        #ifdef CONFIG_LV_PROFILER_SYSMON
+            #define LV_PROFILER_SYSMON CONFIG_LV_PROFILER_SYSMON
+        #else
+            #define LV_PROFILER_SYSMON 0
+        #endif
+    #endif
 #endif
 
 /*1: Enable Monkey test*/
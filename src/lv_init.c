@@ -26,12 +26,14 @@
 #include "libs/tiny_ttf/lv_tiny_ttf.h"
 #include "libs/etc2/lv_etc2.h"
 #include "libs/webp/lv_libwebp.h"
+#include "libs/svg/lv_svg_render.h"
 #include "draw/lv_draw.h"
 #include "misc/lv_async.h"
 #include "widgets/span/lv_span.h"
 #include "themes/simple/lv_theme_simple.h"
 #include "themes/default/lv_theme_default.h"
 #include "misc/lv_fs.h"
+#include "misc/lv_bidi.h"
 #if LV_USE_DRAW_VGLITE
     #include "draw/nxp/vglite/lv_draw_vglite.h"
 #endif
@@ -160,6 +162,10 @@ void lv_init(void)
     lv_span_stack_init();
 #endif
 
+#if LV_USE_BIDI
+    _lv_bidi_init();
+#endif
+
 #if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
     lv_profiler_builtin_config_t profiler_config;
     lv_profiler_builtin_config_init(&profiler_config);
@@ -215,7 +221,7 @@ void lv_init(void)
     _lv_sysmon_builtin_init();
 #endif
 
-    _lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT);
+    _lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT, LV_IMAGE_BAND_CACHE_DEF_SIZE);
     lv_bin_decoder_init();  /*LVGL built-in binary image decoder*/
 
 #if LV_USE_DRAW_VG_LITE
@@ -351,6 +357,10 @@ void lv_deinit(void)
     lv_span_stack_deinit();
 #endif
 
+#if LV_USE_BIDI
+    _lv_bidi_deinit();
+#endif
+
 #if LV_USE_DRAW_SW
     lv_draw_sw_deinit();
 #endif
@@ -359,6 +369,10 @@ void lv_deinit(void)
     lv_freetype_uninit();
 #endif
 
+#if LV_USE_SVG && LV_USE_VECTOR_GRAPHIC
+    lv_svg_render_deinit();
+#endif
+
 #if LV_USE_TINY_TTF
     lv_tiny_ttf_deinit();
 #endif
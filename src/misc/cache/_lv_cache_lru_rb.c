@@ -48,6 +48,7 @@
 #include "../../stdlib/lv_string.h"
 #include "../lv_ll.h"
 #include "../lv_rb.h"
+#include "lv_cache_entry_private.h"
 
 /*********************
  *      DEFINES
@@ -77,6 +78,7 @@ static bool init_size_cb(lv_cache_t * cache);
 static void  destroy_cb(lv_cache_t * cache, void * user_data);
 
 static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data);
+static bool contains_cb(lv_cache_t * cache, const void * key, void * user_data);
 static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data);
 static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data);
 static void drop_cb(lv_cache_t * cache, const void * key, void * user_data);
@@ -100,6 +102,7 @@ const lv_cache_class_t lv_cache_class_lru_rb_count = {
     .destroy_cb = destroy_cb,
 
     .get_cb = get_cb,
+    .contains_cb = contains_cb,
     .add_cb = add_cb,
     .remove_cb = remove_cb,
     .drop_cb = drop_cb,
@@ -114,6 +117,7 @@ const lv_cache_class_t lv_cache_class_lru_rb_size = {
     .destroy_cb = destroy_cb,
 
     .get_cb = get_cb,
+    .contains_cb = contains_cb,
     .add_cb = add_cb,
     .remove_cb = remove_cb,
     .drop_cb = drop_cb,
@@ -288,6 +292,23 @@ static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * us
     return NULL;
 }
 
+static bool contains_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_rb_t_ * lru = (lv_lru_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(key);
+
+    if(lru == NULL || key == NULL) {
+        return false;
+    }
+
+    /*Don't move the node in the LRU list*/
+    return lv_rb_find(&lru->rb, key) != NULL;
+}
+
 static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data)
 {
     LV_UNUSED(user_data);
@@ -392,6 +413,9 @@ static void drop_all_cb(lv_cache_t * cache, void * user_data)
         }
         else {
             LV_LOG_WARN("entry (%p) is still referenced (%" LV_PRId32 ")", (void *)entry, lv_cache_entry_get_ref(entry));
+            /*Keep the entry until it's released, as `lv_cache_drop` does*/
+            lv_cache_entry_set_invalid(entry, true);
+            lv_rb_remove_node(&lru->rb, *node);
             used_cnt++;
         }
     }
@@ -9,6 +9,7 @@
 #include "lv_cache.h"
 #include "../../stdlib/lv_sprintf.h"
 #include "../lv_assert.h"
+#include "../../tick/lv_tick.h"
 #include "lv_cache_entry_private.h"
 
 /*********************
@@ -25,6 +26,7 @@
 static void cache_drop_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
 static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_data);
 static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
+static void cache_update_stat_no_lock(lv_cache_t * cache, bool hit);
 /**********************
  *  GLOBAL VARIABLES
  **********************/
@@ -53,6 +55,11 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
     cache->max_size = max_size;
     cache->size = 0;
     cache->ops = ops;
+    cache->hit_cnt = 0;
+    cache->miss_cnt = 0;
+    cache->stat_tick = lv_tick_get();
+    cache->stat_hit_cnt = 0;
+    cache->stat_miss_cnt = 0;
 
     if(cache->clz->init_cb(cache) == false) {
         LV_LOG_ERROR("Cache init failed");
@@ -86,6 +93,7 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     lv_mutex_lock(&cache->lock);
 
     if(cache->size == 0) {
+        cache_update_stat_no_lock(cache, false);
         lv_mutex_unlock(&cache->lock);
 
         LV_PROFILER_CACHE_END;
@@ -96,11 +104,32 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     if(entry != NULL) {
         lv_cache_entry_acquire_data(entry);
     }
+    cache_update_stat_no_lock(cache, entry != NULL);
     lv_mutex_unlock(&cache->lock);
 
     LV_PROFILER_CACHE_END;
     return entry;
 }
+bool lv_cache_contains(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(key);
+
+    LV_PROFILER_CACHE_BEGIN;
+
+    lv_mutex_lock(&cache->lock);
+
+    bool res;
+    if(cache->size == 0) res = false;
+    /*Custom cache classes might not have a contains callback*/
+    else if(cache->clz->contains_cb) res = cache->clz->contains_cb(cache, key, user_data);
+    else res = cache->clz->get_cb(cache, key, user_data) != NULL;
+
+    lv_mutex_unlock(&cache->lock);
+
+    LV_PROFILER_CACHE_END;
+    return res;
+}
 void lv_cache_release(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data)
 {
     LV_ASSERT_NULL(entry);
@@ -156,6 +185,7 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         entry = cache->clz->get_cb(cache, key, user_data);
         if(entry != NULL) {
             lv_cache_entry_acquire_data(entry);
+            cache_update_stat_no_lock(cache, true);
             lv_mutex_unlock(&cache->lock);
 
             LV_PROFILER_CACHE_END;
@@ -163,6 +193,8 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         }
     }
 
+    cache_update_stat_no_lock(cache, false);
+
     if(cache->max_size == 0) {
         lv_mutex_unlock(&cache->lock);
 
@@ -291,6 +323,16 @@ const char * lv_cache_get_name(lv_cache_t * cache)
 {
     return cache->name;
 }
+uint32_t lv_cache_get_hit_cnt(lv_cache_t * cache)
+{
+    LV_ASSERT_NULL(cache);
+    return cache->hit_cnt;
+}
+uint32_t lv_cache_get_miss_cnt(lv_cache_t * cache)
+{
+    LV_ASSERT_NULL(cache);
+    return cache->miss_cnt;
+}
 
 /**********************
  *   STATIC FUNCTIONS
@@ -346,3 +388,26 @@ static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const v
 
     return entry;
 }
+
+static void cache_update_stat_no_lock(lv_cache_t * cache, bool hit)
+{
+    if(hit) cache->hit_cnt++;
+    else cache->miss_cnt++;
+
+#if LV_USE_PROFILER && LV_PROFILER_CACHE
+    /*Report the hit rate in percent of the last period as a counter track named after the cache.
+     *Reporting every lookup would add an event for each glyph and image.*/
+    if(cache->name == NULL) return;
+    if(lv_tick_elaps(cache->stat_tick) < LV_DEF_REFR_PERIOD) return;
+
+    /*The counters can wrap around, their difference is still correct*/
+    uint32_t hit_cnt = cache->hit_cnt - cache->stat_hit_cnt;
+    uint64_t lookup_cnt = (uint64_t)hit_cnt + (uint32_t)(cache->miss_cnt - cache->stat_miss_cnt);
+    cache->stat_tick = lv_tick_get();
+    cache->stat_hit_cnt = cache->hit_cnt;
+    cache->stat_miss_cnt = cache->miss_cnt;
+    if(lookup_cnt == 0) return;
+
+    LV_PROFILER_CACHE_COUNTER(cache->name, (int32_t)((uint64_t)hit_cnt * 100 / lookup_cnt));
+#endif
+}
@@ -21,6 +21,7 @@ extern "C" {
 
 #include "lv_image_cache.h"
 #include "lv_image_header_cache.h"
+#include "lv_image_band_cache.h"
 /*********************
  *      DEFINES
  *********************/
@@ -66,6 +67,17 @@ void lv_cache_destroy(lv_cache_t * cache, void * user_data);
  */
 lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void * user_data);
 
+/**
+ * Check if an entry with the given key is in the cache.
+ * Unlike @lv_cache_acquire, it doesn't change the priority of the entry, doesn't increment its @lv_entry_t::ref count
+ * and doesn't count as a cache hit or miss.
+ * @param cache         The cache object pointer to search in.
+ * @param key           The key of the entry to search.
+ * @param user_data     A user data pointer that will be passed to the contains callback.
+ * @return              Returns true if the entry is in the cache, false otherwise.
+ */
+bool lv_cache_contains(lv_cache_t * cache, const void * key, void * user_data);
+
 /**
  * Acquire a cache entry with the given key. If the entry is not in the cache, it will create a new entry with the given key.
  * If the entry is found, it's priority will be changed by the cache's policy. And the @lv_entry_t::ref count will be incremented.
@@ -216,6 +228,20 @@ void lv_cache_set_name(lv_cache_t * cache, const char * name);
  */
 const char * lv_cache_get_name(lv_cache_t * cache);
 
+/**
+ * Get the number of lookups which found the entry in the cache.
+ * @param cache         The cache object pointer to get the hit count of.
+ * @return              Returns the hit count since the cache was created.
+ */
+uint32_t lv_cache_get_hit_cnt(lv_cache_t * cache);
+
+/**
+ * Get the number of lookups which didn't find the entry in the cache.
+ * @param cache         The cache object pointer to get the miss count of.
+ * @return              Returns the miss count since the cache was created.
+ */
+uint32_t lv_cache_get_miss_cnt(lv_cache_t * cache);
+
 /*************************
  *    GLOBAL VARIABLES
  *************************/
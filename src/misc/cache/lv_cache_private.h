@@ -72,6 +72,13 @@ typedef void (*lv_cache_destroy_cb_t)(lv_cache_t * cache, void * user_data);
  */
 typedef lv_cache_entry_t * (*lv_cache_get_cb_t)(lv_cache_t * cache, const void * key, void * user_data);
 
+/**
+ * The cache contains function, used by the cache class to check if a cache entry with a given key exists.
+ * Unlike the get function, it must not change the priority of the entry.
+ * @return true if the key is found, false otherwise.
+ */
+typedef bool (*lv_cache_contains_cb_t)(lv_cache_t * cache, const void * key, void * user_data);
+
 /**
  * The cache add function, used by the cache class to add a cache entry with a given key.
  * This function only cares about how to add the entry, it doesn't check if the entry already exists and doesn't care about is it a victim or not.
@@ -134,6 +141,13 @@ struct _lv_cache_t {
     lv_mutex_t lock;                  /**< The cache lock used to protect the cache in multithreading environments */
 
     const char * name;                /**< The name of the cache */
+
+    uint32_t hit_cnt;                 /**< Number of lookups which found the entry */
+    uint32_t miss_cnt;                /**< Number of lookups which didn't find the entry */
+
+    uint32_t stat_tick;               /**< When the hit rate was reported to the profiler */
+    uint32_t stat_hit_cnt;            /**< `hit_cnt` at the last report */
+    uint32_t stat_miss_cnt;           /**< `miss_cnt` at the last report */
 };
 
 /**
@@ -147,6 +161,7 @@ struct _lv_cache_class_t {
     lv_cache_destroy_cb_t destroy_cb;             /**< The destruction function for cache entries */
 
     lv_cache_get_cb_t get_cb;                     /**< The get function for cache entries */
+    lv_cache_contains_cb_t contains_cb;           /**< The contains function for cache entries */
     lv_cache_add_cb_t add_cb;                     /**< The add function for cache entries */
     lv_cache_remove_cb_t remove_cb;               /**< The remove function for cache entries */
     lv_cache_drop_cb_t drop_cb;                   /**< The drop function for cache entries */
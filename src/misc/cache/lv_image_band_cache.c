@@ -0,0 +1,216 @@
+/**
+* @file lv_image_band_cache.c
+*
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lv_assert.h"
+#include "../../core/lv_global.h"
+#include "../../draw/lv_draw_image.h"
+
+#include "lv_image_band_cache.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define CACHE_NAME  "IMAGE_BAND"
+
+#define img_band_cache_p (LV_GLOBAL_DEFAULT()->img_band_cache)
+#define img_band_ll_p (&LV_GLOBAL_DEFAULT()->img_band_ll)
+#define image_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_cache_compare_res_t image_band_cache_compare_cb(const lv_image_band_cache_data_t * lhs,
+                                                          const lv_image_band_cache_data_t * rhs);
+static void image_band_cache_free_cb(lv_image_band_cache_data_t * entry, void * user_data);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_image_band_cache_init(uint32_t size)
+{
+    if(img_band_cache_p != NULL) {
+        return LV_RESULT_OK;
+    }
+
+    img_band_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(lv_image_band_cache_data_t), size, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) image_band_cache_compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t) image_band_cache_free_cb,
+    });
+
+    lv_cache_set_name(img_band_cache_p, CACHE_NAME);
+    _lv_ll_init(img_band_ll_p, sizeof(lv_image_band_cache_data_t *));
+    return img_band_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+void lv_image_band_cache_resize(uint32_t new_size, bool evict_now)
+{
+    lv_cache_set_max_size(img_band_cache_p, new_size, NULL);
+    if(evict_now) {
+        lv_cache_reserve(img_band_cache_p, new_size, NULL);
+    }
+}
+
+uint32_t lv_image_band_cache_get_size(void)
+{
+    return lv_cache_get_max_size(img_band_cache_p, NULL);
+}
+
+lv_cache_entry_t * lv_image_band_cache_add(const void * key)
+{
+    /*Register the band first, so that the caller still owns it if it can't be registered*/
+    lv_mutex_lock(&img_band_cache_p->lock);
+    lv_image_band_cache_data_t ** band = _lv_ll_ins_tail(img_band_ll_p);
+    if(band) *band = NULL;
+    lv_mutex_unlock(&img_band_cache_p->lock);
+    if(band == NULL) return NULL;
+
+    lv_cache_entry_t * entry = lv_cache_add(img_band_cache_p, key, NULL);
+
+    lv_mutex_lock(&img_band_cache_p->lock);
+    if(entry) {
+        *band = lv_cache_entry_get_data(entry);
+    }
+    else {
+        _lv_ll_remove(img_band_ll_p, band);
+        lv_free(band);
+    }
+    lv_mutex_unlock(&img_band_cache_p->lock);
+
+    return entry;
+}
+
+void lv_image_band_cache_drop(const void * src)
+{
+    if(src == NULL) {
+        lv_cache_drop_all(img_band_cache_p, NULL);
+        return;
+    }
+
+    /*Only files are decoded in bands*/
+    if(lv_image_src_get_type(src) != LV_IMAGE_SRC_FILE) return;
+
+    /*Collect the keys of the file's bands first, as dropping a band frees its data*/
+    lv_mutex_lock(&img_band_cache_p->lock);
+    uint32_t cnt = 0;
+    lv_image_band_cache_data_t ** band;
+    _LV_LL_READ(img_band_ll_p, band) {
+        if(*band && lv_strcmp((*band)->src, src) == 0) cnt++;
+    }
+
+    lv_image_band_cache_data_t * keys = cnt ? lv_malloc(cnt * sizeof(lv_image_band_cache_data_t)) : NULL;
+    if(keys) {
+        uint32_t i = 0;
+        _LV_LL_READ(img_band_ll_p, band) {
+            if(*band && lv_strcmp((*band)->src, src) == 0) {
+                keys[i] = **band;
+                keys[i].src = src;
+                i++;
+            }
+        }
+    }
+    lv_mutex_unlock(&img_band_cache_p->lock);
+
+    if(cnt == 0) return;
+
+    if(keys == NULL) {
+        LV_LOG_WARN("out of memory, dropping the bands of all images");
+        lv_cache_drop_all(img_band_cache_p, NULL);
+        return;
+    }
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_cache_drop(img_band_cache_p, &keys[i], NULL);
+    }
+
+    lv_free(keys);
+}
+
+bool lv_image_band_cache_is_enabled(void)
+{
+    return lv_cache_is_enabled(img_band_cache_p);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_cache_compare_res_t image_band_cache_compare_cb(
+    const lv_image_band_cache_data_t * lhs,
+    const lv_image_band_cache_data_t * rhs)
+{
+    if(lhs->y != rhs->y) {
+        return lhs->y > rhs->y ? 1 : -1;
+    }
+
+    if(lhs->x != rhs->x) {
+        return lhs->x > rhs->x ? 1 : -1;
+    }
+
+    if(lhs->w != rhs->w) {
+        return lhs->w > rhs->w ? 1 : -1;
+    }
+
+    if(lhs->target_w != rhs->target_w) {
+        return lhs->target_w > rhs->target_w ? 1 : -1;
+    }
+
+    if(lhs->target_h != rhs->target_h) {
+        return lhs->target_h > rhs->target_h ? 1 : -1;
+    }
+
+    /*Only files are decoded in bands*/
+    int32_t cmp_res = lv_strcmp(lhs->src, rhs->src);
+    if(cmp_res != 0) {
+        return cmp_res > 0 ? 1 : -1;
+    }
+
+    return 0;
+}
+
+static void image_band_cache_free_cb(lv_image_band_cache_data_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    /*Called with the cache locked*/
+    lv_image_band_cache_data_t ** band;
+    _LV_LL_READ(img_band_ll_p, band) {
+        if(*band == entry) {
+            _lv_ll_remove(img_band_ll_p, band);
+            lv_free(band);
+            break;
+        }
+    }
+
+    lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, entry->decoded);
+
+    /*Free the duplicated file name*/
+    lv_free((void *)entry->src);
+}
@@ -0,0 +1,87 @@
+/**
+* @file lv_image_band_cache.h
+*
+ */
+
+#ifndef LV_IMAGE_BAND_CACHE_H
+#define LV_IMAGE_BAND_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../lv_conf_internal.h"
+#include "../lv_types.h"
+#include "lv_cache_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the cache of image bands. Large images are decoded in horizontal bands
+ * via `get_area_cb` if they are larger than this cache.
+ * @param  size size of the cache in bytes. 0: always decode the images entirely.
+ * @return LV_RESULT_OK: initialization succeeded, LV_RESULT_INVALID: failed.
+ */
+lv_result_t lv_image_band_cache_init(uint32_t size);
+
+/**
+ * Resize the cache of image bands.
+ * If set to 0, the images will be decoded entirely again.
+ * @param new_size  new size of the cache in bytes.
+ * @param evict_now true: evict the bands should be removed by the eviction policy, false: wait for the next cache cleanup.
+ */
+void lv_image_band_cache_resize(uint32_t new_size, bool evict_now);
+
+/**
+ * Get the size of the band cache.
+ * @return the size of the cache in bytes
+ */
+uint32_t lv_image_band_cache_get_size(void);
+
+/**
+ * Add a decoded band to the cache. The cache takes the ownership of the band and its `src`.
+ * @param key   pointer to the `lv_image_band_cache_data_t` of the band
+ * @return      the acquired cache entry of the band or NULL on error
+ */
+lv_cache_entry_t * lv_image_band_cache_add(const void * key);
+
+/**
+ * Invalidate the cached bands of an image. Use NULL to invalidate the bands of all images.
+ * It's also automatically called when an image is invalidated.
+ * @param src pointer to an image source.
+ */
+void lv_image_band_cache_drop(const void * src);
+
+/**
+ * Return true if the band cache is enabled.
+ * @return true: enabled, false: disabled.
+ */
+bool lv_image_band_cache_is_enabled(void);
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMAGE_BAND_CACHE_H*/
@@ -12,6 +12,7 @@
 
 #include "lv_image_cache.h"
 #include "lv_image_header_cache.h"
+#include "lv_image_band_cache.h"
 
 /*********************
  *      DEFINES
@@ -82,20 +83,26 @@ uint32_t lv_image_cache_get_size(void)
 
 void lv_image_cache_drop(const void * src)
 {
-    /*If user invalidate image, the header cache should be invalidated too.*/
+    /*If user invalidate image, the header and band caches should be invalidated too.*/
     lv_image_header_cache_drop(src);
+    lv_image_band_cache_drop(src);
 
     if(src == NULL) {
         lv_cache_drop_all(img_cache_p, NULL);
         return;
     }
 
+    /*Drop the image decoded for any target size*/
     lv_image_cache_data_t search_key = {
         .src = src,
         .src_type = lv_image_src_get_type(src),
+        .target_w = -1,
+        .target_h = -1,
     };
 
-    lv_cache_drop(img_cache_p, &search_key, NULL);
+    while(lv_cache_contains(img_cache_p, &search_key, NULL)) {
+        lv_cache_drop(img_cache_p, &search_key, NULL);
+    }
 }
 
 bool lv_image_cache_is_enabled(void)
@@ -103,6 +110,29 @@ bool lv_image_cache_is_enabled(void)
     return lv_cache_is_enabled(img_cache_p);
 }
 
+bool lv_image_cache_is_cached(const void * src)
+{
+    if(src == NULL || !lv_image_cache_is_enabled()) return false;
+
+    lv_image_cache_data_t search_key = {
+        .src = src,
+        .src_type = lv_image_src_get_type(src),
+        .target_w = -1,
+        .target_h = -1,
+    };
+
+    return lv_cache_contains(img_cache_p, &search_key, NULL);
+}
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+lv_result_t lv_image_cache_prefetch(const void * src)
+{
+    if(lv_image_cache_is_cached(src)) return LV_RESULT_OK;
+
+    return lv_image_decoder_decode_async(src, NULL, NULL, NULL);
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -131,7 +161,19 @@ static lv_cache_compare_res_t image_cache_compare_cb(
     const lv_image_cache_data_t * lhs,
     const lv_image_cache_data_t * rhs)
 {
-    return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
+    lv_cache_compare_res_t res = image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
+    if(res != 0) return res;
+
+    /*A negative target size matches all the sizes of the image*/
+    if(lhs->target_w < 0 || rhs->target_w < 0) return 0;
+
+    if(lhs->target_w != rhs->target_w) {
+        return lhs->target_w > rhs->target_w ? 1 : -1;
+    }
+    if(lhs->target_h != rhs->target_h) {
+        return lhs->target_h > rhs->target_h ? 1 : -1;
+    }
+    return 0;
 }
 
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
@@ -62,6 +62,24 @@ void lv_image_cache_drop(const void * src);
  */
 bool lv_image_cache_is_enabled(void);
 
+/**
+ * Check if an image is decoded and stored in the image cache, for any target size.
+ * @param src pointer to an image source.
+ * It neither changes the priority of the cached image nor counts as a cache hit or miss.
+ * @return true: the image can be drawn without decoding it.
+ */
+bool lv_image_cache_is_cached(const void * src);
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+/**
+ * Decode an image in the background and add it to the cache. E.g. call it for the images of
+ * the next screen before loading it, so that they needn't be decoded while rendering.
+ * @param src pointer to an image source.
+ * @return LV_RESULT_OK: the decoding is queued, LV_RESULT_INVALID: failed to queue it.
+ */
+lv_result_t lv_image_cache_prefetch(const void * src);
+#endif
+
 /*************************
  *    GLOBAL VARIABLES
  *************************/
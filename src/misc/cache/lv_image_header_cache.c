@@ -80,12 +80,17 @@ void lv_image_header_cache_drop(const void * src)
         return;
     }
 
+    /*Drop the image decoded for any target size*/
     lv_image_header_cache_data_t search_key = {
         .src = src,
         .src_type = lv_image_src_get_type(src),
+        .target_w = -1,
+        .target_h = -1,
     };
 
-    lv_cache_drop(img_header_cache_p, &search_key, NULL);
+    while(lv_cache_contains(img_header_cache_p, &search_key, NULL)) {
+        lv_cache_drop(img_header_cache_p, &search_key, NULL);
+    }
 }
 
 bool lv_image_header_cache_is_enabled(void)
@@ -121,7 +126,19 @@ static lv_cache_compare_res_t image_header_cache_compare_cb(
     const lv_image_header_cache_data_t * lhs,
     const lv_image_header_cache_data_t * rhs)
 {
-    return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
+    lv_cache_compare_res_t res = image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
+    if(res != 0) return res;
+
+    /*A negative target size matches all the sizes of the image*/
+    if(lhs->target_w < 0 || rhs->target_w < 0) return 0;
+
+    if(lhs->target_w != rhs->target_w) {
+        return lhs->target_w > rhs->target_w ? 1 : -1;
+    }
+    if(lhs->target_h != rhs->target_h) {
+        return lhs->target_h > rhs->target_h ? 1 : -1;
+    }
+    return 0;
 }
 
 static void image_header_cache_free_cb(lv_image_header_cache_data_t * entry, void * user_data)
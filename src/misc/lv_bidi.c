@@ -11,6 +11,7 @@
 #include "lv_types.h"
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_string.h"
+#include "../core/lv_global.h"
 
 #if LV_USE_BIDI
 
@@ -24,6 +25,10 @@
 #define IS_RTL_POS(x) (((x) & 0x8000) != 0)
 #define SET_RTL_POS(x, is_rtl) (GET_POS(x) | ((is_rtl)? 0x8000: 0))
 
+#define CACHE_NAME  "BIDI"
+
+#define bidi_cache_p (LV_GLOBAL_DEFAULT()->bidi_cache)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -58,6 +63,10 @@ static lv_base_dir_t bracket_process(lv_bidi_ctx_t * ctx, const char * txt, uint
                                      lv_base_dir_t base_dir);
 static void fill_pos_conv(uint16_t * out, uint16_t len, uint16_t index);
 static uint32_t get_txt_len(const char * txt, uint32_t max_len);
+static uint32_t get_txt_hash(const char * txt, uint32_t len);
+static lv_cache_compare_res_t paragraph_compare_cb(const lv_bidi_paragraph_t * lhs, const lv_bidi_paragraph_t * rhs);
+static bool paragraph_create_cb(lv_bidi_paragraph_t * par, void * user_data);
+static void paragraph_free_cb(lv_bidi_paragraph_t * par, void * user_data);
 
 /**********************
  *  STATIC VARIABLES
@@ -74,6 +83,26 @@ static const char * custom_neutrals = NULL;
  *   GLOBAL FUNCTIONS
  **********************/
 
+void _lv_bidi_init(void)
+{
+    bidi_cache_p = lv_cache_create(&lv_cache_class_lru_rb_count,
+    sizeof(lv_bidi_paragraph_t), LV_BIDI_CACHE_CNT, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) paragraph_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) paragraph_create_cb,
+        .free_cb = (lv_cache_free_cb_t) paragraph_free_cb,
+    });
+
+    lv_cache_set_name(bidi_cache_p, CACHE_NAME);
+}
+
+void _lv_bidi_deinit(void)
+{
+    if(bidi_cache_p == NULL) return;
+
+    lv_cache_destroy(bidi_cache_p, NULL);
+    bidi_cache_p = NULL;
+}
+
 void _lv_bidi_process(const char * str_in, char * str_out, lv_base_dir_t base_dir)
 {
     if(base_dir == LV_BASE_DIR_AUTO) base_dir = _lv_bidi_detect_base_dir(str_in);
@@ -272,6 +301,72 @@ void _lv_bidi_process_paragraph(const char * str_in, char * str_out, uint32_t le
     }
 }
 
+const lv_bidi_paragraph_t * _lv_bidi_paragraph_acquire(const char * str_in, uint32_t len, lv_base_dir_t base_dir)
+{
+    LV_PROFILER_BEGIN;
+
+    lv_bidi_paragraph_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.txt = str_in;
+    search_key.len = len;
+    search_key.hash = get_txt_hash(str_in, len);
+    search_key.base_dir = base_dir;
+
+    if(bidi_cache_p && lv_cache_is_enabled(bidi_cache_p)) {
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(bidi_cache_p, &search_key, NULL);
+        if(entry) {
+            LV_PROFILER_END;
+            return lv_cache_entry_get_data(entry);
+        }
+    }
+
+    /*The cache is disabled or full of acquired paragraphs: process it only for the caller*/
+    lv_bidi_paragraph_t * par = lv_malloc(sizeof(lv_bidi_paragraph_t));
+    if(par == NULL) {
+        LV_PROFILER_END;
+        return NULL;
+    }
+
+    *par = search_key;
+    if(!paragraph_create_cb(par, NULL)) {
+        lv_free(par);
+        par = NULL;
+    }
+    else {
+        par->cached = false;
+    }
+
+    LV_PROFILER_END;
+    return par;
+}
+
+void _lv_bidi_paragraph_release(const lv_bidi_paragraph_t * par)
+{
+    if(par == NULL) return;
+
+    if(par->cached) {
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry((void *)par, sizeof(lv_bidi_paragraph_t));
+        lv_cache_release(bidi_cache_p, entry, NULL);
+    }
+    else {
+        paragraph_free_cb((lv_bidi_paragraph_t *)par, NULL);
+        lv_free((void *)par);
+    }
+}
+
+uint16_t _lv_bidi_paragraph_get_logical_pos(const lv_bidi_paragraph_t * par, uint32_t visual_pos, bool * is_rtl)
+{
+    if(visual_pos >= par->pos_conv_len) return (uint16_t) -1;
+
+    if(is_rtl) *is_rtl = IS_RTL_POS(par->pos_conv[visual_pos]);
+    return GET_POS(par->pos_conv[visual_pos]);
+}
+
+void lv_bidi_cache_drop_all(void)
+{
+    if(bidi_cache_p) lv_cache_drop_all(bidi_cache_p, NULL);
+}
+
 void lv_bidi_calculate_align(lv_text_align_t * align, lv_base_dir_t * base_dir, const char * txt)
 {
     if(*base_dir == LV_BASE_DIR_AUTO) *base_dir = _lv_bidi_detect_base_dir(txt);
@@ -285,6 +380,9 @@ void lv_bidi_calculate_align(lv_text_align_t * align, lv_base_dir_t * base_dir,
 void lv_bidi_set_custom_neutrals_static(const char * neutrals)
 {
     custom_neutrals = neutrals;
+
+    /*The neutrals affect the result of the processing*/
+    lv_bidi_cache_drop_all();
 }
 
 /**********************
@@ -395,6 +493,79 @@ static uint32_t get_txt_len(const char * txt, uint32_t max_len)
     return len;
 }
 
+/**
+ * Get the FNV-1a hash of a text
+ * @param txt   the text
+ * @param len   length of the text in bytes
+ * @return      the hash
+ */
+static uint32_t get_txt_hash(const char * txt, uint32_t len)
+{
+    uint32_t hash = 2166136261u;
+    uint32_t i;
+    for(i = 0; i < len; i++) {
+        hash ^= (uint8_t)txt[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+static lv_cache_compare_res_t paragraph_compare_cb(const lv_bidi_paragraph_t * lhs, const lv_bidi_paragraph_t * rhs)
+{
+    if(lhs->hash != rhs->hash) return lhs->hash > rhs->hash ? 1 : -1;
+    if(lhs->len != rhs->len) return lhs->len > rhs->len ? 1 : -1;
+    if(lhs->base_dir != rhs->base_dir) return lhs->base_dir > rhs->base_dir ? 1 : -1;
+
+    int32_t cmp_res = lv_memcmp(lhs->txt, rhs->txt, lhs->len);
+    if(cmp_res != 0) return cmp_res > 0 ? 1 : -1;
+
+    return 0;
+}
+
+static bool paragraph_create_cb(lv_bidi_paragraph_t * par, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    /*Store a copy of the text as the original can be changed in place*/
+    uint32_t pos_conv_len = get_txt_len(par->txt, par->len);
+    char * txt = lv_malloc(par->len + 1);
+    char * visual_txt = lv_malloc(par->len + 1);
+    /*Allocate at least one element to have a valid pointer for empty texts too*/
+    uint16_t * pos_conv = lv_malloc((pos_conv_len + 1) * sizeof(uint16_t));
+    if(txt == NULL || visual_txt == NULL || pos_conv == NULL) {
+        lv_free(txt);
+        lv_free(visual_txt);
+        lv_free(pos_conv);
+        return false;
+    }
+
+    lv_memcpy(txt, par->txt, par->len);
+    txt[par->len] = '\0';
+
+    _lv_bidi_process_paragraph(txt, visual_txt, par->len, par->base_dir, pos_conv, (uint16_t)pos_conv_len);
+
+    par->txt = txt;
+    par->visual_txt = visual_txt;
+    par->pos_conv = pos_conv;
+    par->pos_conv_len = pos_conv_len;
+    par->cached = true;
+
+    return true;
+}
+
+static void paragraph_free_cb(lv_bidi_paragraph_t * par, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free((void *)par->txt);
+    lv_free(par->visual_txt);
+    lv_free(par->pos_conv);
+    par->txt = NULL;
+    par->visual_txt = NULL;
+    par->pos_conv = NULL;
+}
+
 static void fill_pos_conv(uint16_t * out, uint16_t len, uint16_t index)
 {
     uint16_t i;
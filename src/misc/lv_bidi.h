@@ -43,11 +43,37 @@ typedef _lv_base_dir_t lv_base_dir_t;
 typedef uint8_t lv_base_dir_t;
 #endif /*DOXYGEN*/
 
+#if LV_USE_BIDI
+/**
+ * A bidi processed paragraph (or line) of text. Returned by `_lv_bidi_paragraph_acquire()`.
+ */
+typedef struct {
+    const char * txt;           /**< Copy of the logical text, used as the key*/
+    char * visual_txt;          /**< The characters in visual order, '\0' terminated*/
+    uint16_t * pos_conv;        /**< The logical position of each visual character*/
+    uint32_t len;               /**< Length of `txt` and `visual_txt` in bytes*/
+    uint32_t pos_conv_len;      /**< Length of `pos_conv` in character count*/
+    uint32_t hash;
+    lv_base_dir_t base_dir;
+    bool cached;                /**< false: it was allocated as the cache is disabled*/
+} lv_bidi_paragraph_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 #if LV_USE_BIDI
 
+/**
+ * Initialize the cache of bidi processed paragraphs. Called internally.
+ */
+void _lv_bidi_init(void);
+
+/**
+ * Deinitialize the cache of bidi processed paragraphs. Called internally.
+ */
+void _lv_bidi_deinit(void);
+
 /**
  * Convert a text to get the characters in the correct visual order according to
  * Unicode Bidirectional Algorithm
@@ -107,6 +133,37 @@ uint16_t _lv_bidi_get_visual_pos(const char * str_in, char ** bidi_txt, uint16_t
 void _lv_bidi_process_paragraph(const char * str_in, char * str_out, uint32_t len, lv_base_dir_t base_dir,
                                 uint16_t * pos_conv_out, uint16_t pos_conv_len);
 
+/**
+ * Get a bidi processed paragraph from the cache or process it and add it to the cache.
+ * The paragraphs are looked up by their content, so a changed text is processed again.
+ * @param str_in    the paragraph (or line) to process
+ * @param len       length of the text in bytes
+ * @param base_dir  base direction of the text
+ * @return          the processed paragraph which needs to be released with `_lv_bidi_paragraph_release()`,
+ *                  or `NULL` on error
+ */
+const lv_bidi_paragraph_t * _lv_bidi_paragraph_acquire(const char * str_in, uint32_t len, lv_base_dir_t base_dir);
+
+/**
+ * Release a paragraph returned by `_lv_bidi_paragraph_acquire()`
+ * @param par       pointer to a processed paragraph
+ */
+void _lv_bidi_paragraph_release(const lv_bidi_paragraph_t * par);
+
+/**
+ * Get the logical position of a character in a processed paragraph
+ * @param par           pointer to a processed paragraph
+ * @param visual_pos    the visual character position
+ * @param is_rtl        tell the char at `visual_pos` is RTL or LTR context. Can be `NULL`.
+ * @return              the logical character position
+ */
+uint16_t _lv_bidi_paragraph_get_logical_pos(const lv_bidi_paragraph_t * par, uint32_t visual_pos, bool * is_rtl);
+
+/**
+ * Drop all bidi processed paragraphs from the cache
+ */
+void lv_bidi_cache_drop_all(void);
+
 /**
  * Get the real text alignment from the a text alignment, base direction and a text.
  * @param align     LV_TEXT_ALIGN_..., write back the calculated align here (LV_TEXT_ALIGN_LEFT/RIGHT/CENTER)
@@ -42,6 +42,7 @@ extern "C" {
 #define LV_PROFILER_END
 #define LV_PROFILER_BEGIN_TAG(tag) LV_UNUSED(tag)
 #define LV_PROFILER_END_TAG(tag)   LV_UNUSED(tag)
+#define LV_PROFILER_COUNTER(name, value) LV_UNUSED(value)
 
 #endif /*LV_USE_PROFILER*/
 
@@ -50,11 +51,13 @@ extern "C" {
 #define LV_PROFILER_LAYOUT_END LV_PROFILER_END
 #define LV_PROFILER_LAYOUT_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
 #define LV_PROFILER_LAYOUT_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_LAYOUT_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
 #else
 #define LV_PROFILER_LAYOUT_BEGIN
 #define LV_PROFILER_LAYOUT_END
 #define LV_PROFILER_LAYOUT_BEGIN_TAG(tag)
 #define LV_PROFILER_LAYOUT_END_TAG(tag)
+#define LV_PROFILER_LAYOUT_COUNTER(name, value) LV_UNUSED(value)
 #endif
 
 #if LV_USE_PROFILER && LV_PROFILER_STYLE
@@ -62,11 +65,13 @@ extern "C" {
 #define LV_PROFILER_STYLE_END LV_PROFILER_END
 #define LV_PROFILER_STYLE_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
 #define LV_PROFILER_STYLE_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_STYLE_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
 #else
 #define LV_PROFILER_STYLE_BEGIN
 #define LV_PROFILER_STYLE_END
 #define LV_PROFILER_STYLE_BEGIN_TAG(tag)
 #define LV_PROFILER_STYLE_END_TAG(tag)
+#define LV_PROFILER_STYLE_COUNTER(name, value) LV_UNUSED(value)
 #endif
 
 #if LV_USE_PROFILER && LV_PROFILER_DRAW
@@ -74,11 +79,13 @@ extern "C" {
 #define LV_PROFILER_DRAW_END LV_PROFILER_END
 #define LV_PROFILER_DRAW_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
 #define LV_PROFILER_DRAW_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_DRAW_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
 #else
 #define LV_PROFILER_DRAW_BEGIN
 #define LV_PROFILER_DRAW_END
 #define LV_PROFILER_DRAW_BEGIN_TAG(tag)
 #define LV_PROFILER_DRAW_END_TAG(tag)
+#define LV_PROFILER_DRAW_COUNTER(name, value) LV_UNUSED(value)
 #endif
 
 #if LV_USE_PROFILER && LV_PROFILER_DECODER
@@ -86,11 +93,13 @@ extern "C" {
 #define LV_PROFILER_DECODER_END LV_PROFILER_END
 #define LV_PROFILER_DECODER_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
 #define LV_PROFILER_DECODER_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_DECODER_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
 #else
 #define LV_PROFILER_DECODER_BEGIN
 #define LV_PROFILER_DECODER_END
 #define LV_PROFILER_DECODER_BEGIN_TAG(tag)
 #define LV_PROFILER_DECODER_END_TAG(tag)
+#define LV_PROFILER_DECODER_COUNTER(name, value) LV_UNUSED(value)
 #endif
 
 #if LV_USE_PROFILER && LV_PROFILER_REFR
@@ -98,11 +107,13 @@ extern "C" {
 #define LV_PROFILER_REFR_END LV_PROFILER_END
 #define LV_PROFILER_REFR_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
 #define LV_PROFILER_REFR_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_REFR_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
 #else
 #define LV_PROFILER_REFR_BEGIN
 #define LV_PROFILER_REFR_END
 #define LV_PROFILER_REFR_BEGIN_TAG(tag)
 #define LV_PROFILER_REFR_END_TAG(tag)
+#define LV_PROFILER_REFR_COUNTER(name, value) LV_UNUSED(value)
 #endif
 
 #if LV_USE_PROFILER && LV_PROFILER_INDEV
@@ -110,11 +121,13 @@ extern "C" {
 #define LV_PROFILER_INDEV_END LV_PROFILER_END
 #define LV_PROFILER_INDEV_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
 #define LV_PROFILER_INDEV_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_INDEV_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
 #else
 #define LV_PROFILER_INDEV_BEGIN
 #define LV_PROFILER_INDEV_END
 #define LV_PROFILER_INDEV_BEGIN_TAG(tag)
 #define LV_PROFILER_INDEV_END_TAG(tag)
+#define LV_PROFILER_INDEV_COUNTER(name, value) LV_UNUSED(value)
 #endif
 
 #if LV_USE_PROFILER && LV_PROFILER_FONT
@@ -122,11 +135,13 @@ extern "C" {
 #define LV_PROFILER_FONT_END LV_PROFILER_END
 #define LV_PROFILER_FONT_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
 #define LV_PROFILER_FONT_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_FONT_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
 #else
 #define LV_PROFILER_FONT_BEGIN
 #define LV_PROFILER_FONT_END
 #define LV_PROFILER_FONT_BEGIN_TAG(tag)
 #define LV_PROFILER_FONT_END_TAG(tag)
+#define LV_PROFILER_FONT_COUNTER(name, value) LV_UNUSED(value)
 #endif
 
 #if LV_USE_PROFILER && LV_PROFILER_CACHE
@@ -134,11 +149,13 @@ extern "C" {
 #define LV_PROFILER_CACHE_END LV_PROFILER_END
 #define LV_PROFILER_CACHE_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
 #define LV_PROFILER_CACHE_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_CACHE_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
 #else
 #define LV_PROFILER_CACHE_BEGIN
 #define LV_PROFILER_CACHE_END
 #define LV_PROFILER_CACHE_BEGIN_TAG(tag)
 #define LV_PROFILER_CACHE_END_TAG(tag)
+#define LV_PROFILER_CACHE_COUNTER(name, value) LV_UNUSED(value)
 #endif
 
 #if LV_USE_PROFILER && LV_PROFILER_FS
@@ -146,11 +163,13 @@ extern "C" {
 #define LV_PROFILER_FS_END LV_PROFILER_END
 #define LV_PROFILER_FS_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
 #define LV_PROFILER_FS_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_FS_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
 #else
 #define LV_PROFILER_FS_BEGIN
 #define LV_PROFILER_FS_END
 #define LV_PROFILER_FS_BEGIN_TAG(tag)
 #define LV_PROFILER_FS_END_TAG(tag)
+#define LV_PROFILER_FS_COUNTER(name, value) LV_UNUSED(value)
 #endif
 
 #if LV_USE_PROFILER && LV_PROFILER_TIMER
@@ -158,11 +177,27 @@ extern "C" {
 #define LV_PROFILER_TIMER_END LV_PROFILER_END
 #define LV_PROFILER_TIMER_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
 #define LV_PROFILER_TIMER_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_TIMER_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
 #else
 #define LV_PROFILER_TIMER_BEGIN
 #define LV_PROFILER_TIMER_END
 #define LV_PROFILER_TIMER_BEGIN_TAG(tag)
 #define LV_PROFILER_TIMER_END_TAG(tag)
+#define LV_PROFILER_TIMER_COUNTER(name, value) LV_UNUSED(value)
+#endif
+
+#if LV_USE_PROFILER && LV_PROFILER_SYSMON
+#define LV_PROFILER_SYSMON_BEGIN LV_PROFILER_BEGIN
+#define LV_PROFILER_SYSMON_END LV_PROFILER_END
+#define LV_PROFILER_SYSMON_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
+#define LV_PROFILER_SYSMON_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_SYSMON_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
+#else
+#define LV_PROFILER_SYSMON_BEGIN
+#define LV_PROFILER_SYSMON_END
+#define LV_PROFILER_SYSMON_BEGIN_TAG(tag)
+#define LV_PROFILER_SYSMON_END_TAG(tag)
+#define LV_PROFILER_SYSMON_COUNTER(name, value) LV_UNUSED(value)
 #endif
 
 #ifdef __cplusplus
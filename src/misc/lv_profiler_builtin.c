@@ -11,6 +11,12 @@
 #include "../lvgl.h"
 #include "../core/lv_global.h"
 
+#if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN && LV_USE_OS && !defined(__GNUC__) && \
+    defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+    #include <stdatomic.h>
+    #define LV_PROFILER_USE_C11_FENCE 1
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -22,6 +28,17 @@
 #define LV_PROFILER_STR_MAX_LEN 128
 #define LV_PROFILER_TICK_PER_SEC_MAX 1000000
 
+#define LV_PROFILER_BIN_BUF_SIZE 256
+#define LV_PROFILER_BIN_ITEM_MAX_LEN 48 /*Tag + 5 varints*/
+#define LV_PROFILER_BIN_VERSION 1
+#define LV_PROFILER_STR_TABLE_INIT_SIZE 64
+
+#if LV_USE_OS
+    #define LV_PROFILER_THREAD_MAX_DEFAULT 8
+#else
+    #define LV_PROFILER_THREAD_MAX_DEFAULT 1
+#endif
+
 #if LV_USE_OS
     #define LV_PROFILER_MULTEX_INIT   lv_mutex_init(&profiler_ctx->mutex)
     #define LV_PROFILER_MULTEX_DEINIT lv_mutex_delete(&profiler_ctx->mutex)
@@ -42,26 +59,56 @@
  * @brief Structure representing a built-in profiler item in LVGL
  */
 typedef struct {
-    char tag;          /**< The tag of the profiler item */
-    uint32_t tick;     /**< The tick value of the profiler item */
-    const char * func; /**< A pointer to the function associated with the profiler item */
+    uint64_t tick;     /**< The tick value of the profiler item */
+    const char * func; /**< A pointer to the function (or counter name) associated with the profiler item */
+    int32_t value;     /**< The value of a counter item */
 #if LV_USE_OS
-    int tid;           /**< The thread ID of the profiler item */
-    int cpu;         /**< The CPU ID of the profiler item */
+    int cpu;           /**< The CPU ID of the profiler item */
 #endif
+    char tag;          /**< The tag of the profiler item */
 } lv_profiler_builtin_item_t;
 
+/**
+ * @brief Single-producer ring buffer owned by one thread.
+ * Only the owner thread writes `head`, only the flush (under the mutex) writes `tail`.
+ * `head` and `tail` are accessed with `load_acquire()` and `store_release()` from the other side
+ * to see the items completely written and read.
+ */
+typedef struct {
+    lv_profiler_builtin_item_t * item_arr; /**< Pointer to an array of profiler items */
+    uint32_t item_num;                     /**< Number of slots in the array, one is always kept empty */
+    volatile uint32_t head;                /**< Index of the next item to write */
+    volatile uint32_t tail;                /**< Index of the oldest item not flushed yet */
+    volatile uint32_t overflow_cnt;        /**< Number of items dropped because the ring was full */
+    int tid;                               /**< The thread ID of the owner thread */
+} lv_profiler_builtin_ring_t;
+
+/**
+ * @brief An interned string of the binary format
+ */
+typedef struct {
+    const char * str; /**< The interned string, compared by address only */
+    uint32_t id;      /**< The ID used in the binary records */
+} lv_profiler_builtin_str_t;
+
 /**
  * @brief Structure representing a context for the LVGL built-in profiler
  */
 typedef struct _lv_profiler_builtin_ctx_t {
-    lv_profiler_builtin_item_t * item_arr; /**< Pointer to an array of profiler items */
-    uint32_t item_num;                     /**< Number of profiler items in the array */
-    uint32_t cur_index;                    /**< Index of the current profiler item */
+    lv_profiler_builtin_ring_t * ring_arr; /**< Per-thread ring buffers, `config.thread_max` entries */
+    volatile uint32_t ring_cnt;            /**< Number of rings already assigned to a thread */
+    uint32_t lost_cnt;                     /**< Items dropped because no ring could be assigned */
+    uint32_t overflow_reported;            /**< Overflow count at the time of the last report */
     lv_profiler_builtin_config_t config;   /**< Configuration for the built-in profiler */
     bool enable;                           /**< Whether the built-in profiler is enabled */
+    lv_profiler_builtin_str_t * str_arr;   /**< Hash table of the strings already sent in the binary format */
+    uint32_t str_cap;                      /**< Size of the hash table, always a power of 2 */
+    uint32_t str_cnt;                      /**< Number of strings in the hash table */
+    uint64_t bin_last_tick;                /**< Tick of the last item sent in the binary format */
+    uint32_t bin_len;                      /**< Number of bytes used in `bin_buf` */
+    uint8_t bin_buf[LV_PROFILER_BIN_BUF_SIZE]; /**< Staging buffer of the binary format */
 #if LV_USE_OS
-    lv_mutex_t mutex;                      /**< Mutex to protect the built-in profiler */
+    lv_mutex_t mutex;                      /**< Mutex to protect the ring assignment and the flush */
 #endif
 } lv_profiler_builtin_ctx_t;
 
@@ -69,10 +116,23 @@ typedef struct _lv_profiler_builtin_ctx_t {
  *  STATIC PROTOTYPES
  **********************/
 
+static uint64_t default_tick_get_cb(void);
 static void default_flush_cb(const char * buf);
 static int default_tid_get_cb(void);
 static int default_cpu_get_cb(void);
 static void flush_no_lock(void);
+static void flush_items(const uint32_t * end, uint32_t ring_cnt);
+static inline uint32_t load_acquire(const volatile uint32_t * p);
+static inline void store_release(volatile uint32_t * p, uint32_t v);
+static void write_item(const char * func, char tag, int32_t value);
+static lv_profiler_builtin_ring_t * ring_get(int tid);
+static void format_text_item(const lv_profiler_builtin_ring_t * ring, const lv_profiler_builtin_item_t * item);
+static void format_bin_item(const lv_profiler_builtin_ring_t * ring, const lv_profiler_builtin_item_t * item);
+static void bin_put_varint(uint64_t v);
+static void bin_put_zigzag(int64_t v);
+static void bin_flush_buf(void);
+static uint32_t str_hash(const char * str);
+static bool bin_get_str_id(const char * str, uint32_t * id);
 
 /**********************
  *  STATIC VARIABLES
@@ -92,10 +152,12 @@ void lv_profiler_builtin_config_init(lv_profiler_builtin_config_t * config)
     lv_memzero(config, sizeof(lv_profiler_builtin_config_t));
     config->buf_size = LV_PROFILER_BUILTIN_BUF_SIZE;
     config->tick_per_sec = 1000;
-    config->tick_get_cb = lv_tick_get;
+    config->tick_get_cb = default_tick_get_cb;
     config->flush_cb = default_flush_cb;
     config->tid_get_cb = default_tid_get_cb;
     config->cpu_get_cb = default_cpu_get_cb;
+    config->thread_max = LV_PROFILER_THREAD_MAX_DEFAULT;
+    config->format = LV_PROFILER_BUILTIN_FORMAT_TEXT;
 }
 
 void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
@@ -109,6 +171,11 @@ void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
         return;
     }
 
+    if(config->thread_max == 0) {
+        LV_LOG_WARN("thread_max must > 0");
+        return;
+    }
+
     if(config->tick_per_sec == 0 || config->tick_per_sec > LV_PROFILER_TICK_PER_SEC_MAX) {
         LV_LOG_WARN("tick_per_sec range must be between 1~%d", LV_PROFILER_TICK_PER_SEC_MAX);
         return;
@@ -122,20 +189,33 @@ void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
     profiler_ctx = lv_malloc_zeroed(sizeof(lv_profiler_builtin_ctx_t));
     LV_ASSERT_MALLOC(profiler_ctx);
 
-    profiler_ctx->item_arr = lv_malloc(num * sizeof(lv_profiler_builtin_item_t));
-    LV_ASSERT_MALLOC(profiler_ctx->item_arr);
-    if(profiler_ctx->item_arr == NULL) {
+    /*The item arrays are allocated lazily when a thread writes its first item*/
+    profiler_ctx->ring_arr = lv_malloc_zeroed(config->thread_max * sizeof(lv_profiler_builtin_ring_t));
+    LV_ASSERT_MALLOC(profiler_ctx->ring_arr);
+    if(profiler_ctx->ring_arr == NULL) {
         lv_free(profiler_ctx);
         profiler_ctx = NULL;
-        LV_LOG_ERROR("malloc failed for item_arr");
+        LV_LOG_ERROR("malloc failed for ring_arr");
         return;
     }
 
     LV_PROFILER_MULTEX_INIT;
-    profiler_ctx->item_num = num;
     profiler_ctx->config = *config;
 
-    if(profiler_ctx->config.flush_cb) {
+    if(profiler_ctx->config.format == LV_PROFILER_BUILTIN_FORMAT_BINARY) {
+        if(profiler_ctx->config.flush_bin_cb) {
+            /* add the stream header */
+            profiler_ctx->bin_buf[0] = 'L';
+            profiler_ctx->bin_buf[1] = 'V';
+            profiler_ctx->bin_buf[2] = 'P';
+            profiler_ctx->bin_buf[3] = 'T';
+            profiler_ctx->bin_buf[4] = LV_PROFILER_BIN_VERSION;
+            profiler_ctx->bin_len = 5;
+            bin_put_varint(profiler_ctx->config.tick_per_sec);
+            bin_flush_buf();
+        }
+    }
+    else if(profiler_ctx->config.flush_cb) {
         /* add profiler header for perfetto */
         profiler_ctx->config.flush_cb("# tracer: nop\n");
         profiler_ctx->config.flush_cb("#\n");
@@ -143,14 +223,19 @@ void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
 
     lv_profiler_builtin_set_enable(true);
 
-    LV_LOG_INFO("init OK, item_num = %d", (int)num);
+    LV_LOG_INFO("init OK, item_num = %d per thread, thread_max = %d", (int)num, (int)config->thread_max);
 }
 
 void lv_profiler_builtin_uninit(void)
 {
     LV_ASSERT_NULL(profiler_ctx);
     LV_PROFILER_MULTEX_DEINIT;
-    lv_free(profiler_ctx->item_arr);
+    uint32_t i;
+    for(i = 0; i < profiler_ctx->ring_cnt; i++) {
+        lv_free(profiler_ctx->ring_arr[i].item_arr);
+    }
+    lv_free(profiler_ctx->ring_arr);
+    lv_free(profiler_ctx->str_arr);
     lv_free(profiler_ctx);
     profiler_ctx = NULL;
 }
@@ -173,6 +258,20 @@ void lv_profiler_builtin_flush(void)
     LV_PROFILER_MULTEX_UNLOCK;
 }
 
+uint32_t lv_profiler_builtin_get_overflow_count(void)
+{
+    LV_ASSERT_NULL(profiler_ctx);
+
+    uint32_t cnt = profiler_ctx->lost_cnt;
+    uint32_t ring_cnt = load_acquire(&profiler_ctx->ring_cnt);
+    uint32_t i;
+    for(i = 0; i < ring_cnt; i++) {
+        cnt += profiler_ctx->ring_arr[i].overflow_cnt;
+    }
+
+    return cnt;
+}
+
 void lv_profiler_builtin_write(const char * func, char tag)
 {
     LV_ASSERT_NULL(profiler_ctx);
@@ -182,31 +281,71 @@ void lv_profiler_builtin_write(const char * func, char tag)
         return;
     }
 
-    LV_PROFILER_MULTEX_LOCK;
+    write_item(func, tag, 0);
+}
+
+void lv_profiler_builtin_write_counter(const char * name, int32_t value)
+{
+    LV_ASSERT_NULL(profiler_ctx);
+    LV_ASSERT_NULL(name);
+
+    if(!profiler_ctx->enable) {
+        return;
+    }
 
-    if(profiler_ctx->cur_index >= profiler_ctx->item_num) {
+    write_item(name, 'C', value);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void write_item(const char * func, char tag, int32_t value)
+{
+#if LV_USE_OS
+    int tid = profiler_ctx->config.tid_get_cb();
+#else
+    int tid = 1;
+#endif
+
+    lv_profiler_builtin_ring_t * ring = ring_get(tid);
+    if(ring == NULL) {
+        return;
+    }
+
+    uint32_t head = ring->head;
+    uint32_t next = head + 1 == ring->item_num ? 0 : head + 1;
+
+    if(next == load_acquire(&ring->tail)) {
+        /*Full: drain all the rings. This is the only place where a writer waits for the lock.*/
+        LV_PROFILER_MULTEX_LOCK;
         flush_no_lock();
-        profiler_ctx->cur_index = 0;
+        LV_PROFILER_MULTEX_UNLOCK;
+
+        if(next == load_acquire(&ring->tail)) {
+            ring->overflow_cnt++;
+            return;
+        }
     }
 
-    lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[profiler_ctx->cur_index];
+    lv_profiler_builtin_item_t * item = &ring->item_arr[head];
     item->func = func;
     item->tag = tag;
+    item->value = value;
     item->tick = profiler_ctx->config.tick_get_cb();
 
 #if LV_USE_OS
-    item->tid = profiler_ctx->config.tid_get_cb();
     item->cpu = profiler_ctx->config.cpu_get_cb();
 #endif
 
-    profiler_ctx->cur_index++;
-
-    LV_PROFILER_MULTEX_UNLOCK;
+    /*Publish the item only after it's completely written*/
+    store_release(&ring->head, next);
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+static uint64_t default_tick_get_cb(void)
+{
+    return lv_tick_get();
+}
 
 static void default_flush_cb(const char * buf)
 {
@@ -223,40 +362,336 @@ static int default_cpu_get_cb(void)
     return 0;
 }
 
+static lv_profiler_builtin_ring_t * ring_get(int tid)
+{
+    /*The rings below `ring_cnt` are completely initialized*/
+    uint32_t ring_cnt = load_acquire(&profiler_ctx->ring_cnt);
+    uint32_t i;
+    for(i = 0; i < ring_cnt; i++) {
+        if(profiler_ctx->ring_arr[i].tid == tid) {
+            return &profiler_ctx->ring_arr[i];
+        }
+    }
+
+    /*First item of this thread: assign a new ring*/
+    lv_profiler_builtin_ring_t * ring = NULL;
+    LV_PROFILER_MULTEX_LOCK;
+
+    /*Another thread might have added rings in the meantime*/
+    for(i = ring_cnt; i < profiler_ctx->ring_cnt; i++) {
+        if(profiler_ctx->ring_arr[i].tid == tid) {
+            ring = &profiler_ctx->ring_arr[i];
+            break;
+        }
+    }
+
+    if(ring == NULL) {
+        ring_cnt = profiler_ctx->ring_cnt;
+        if(ring_cnt < profiler_ctx->config.thread_max) {
+            /*Keep one slot empty to tell apart the full and the empty ring*/
+            uint32_t item_num = profiler_ctx->config.buf_size / sizeof(lv_profiler_builtin_item_t) + 1;
+            lv_profiler_builtin_item_t * item_arr = lv_malloc(item_num * sizeof(lv_profiler_builtin_item_t));
+            LV_ASSERT_MALLOC(item_arr);
+            if(item_arr) {
+                ring = &profiler_ctx->ring_arr[ring_cnt];
+                ring->item_arr = item_arr;
+                ring->item_num = item_num;
+                ring->head = 0;
+                ring->tail = 0;
+                ring->overflow_cnt = 0;
+                ring->tid = tid;
+                store_release(&profiler_ctx->ring_cnt, ring_cnt + 1);
+            }
+            else {
+                LV_LOG_ERROR("malloc failed for item_arr");
+            }
+        }
+
+        if(ring == NULL) {
+            if(profiler_ctx->lost_cnt == 0) {
+                LV_LOG_WARN("no ring buffer for thread %d, thread_max = %d", tid, (int)profiler_ctx->config.thread_max);
+            }
+            profiler_ctx->lost_cnt++;
+        }
+    }
+
+    LV_PROFILER_MULTEX_UNLOCK;
+    return ring;
+}
+
 static void flush_no_lock(void)
 {
-    if(!profiler_ctx->config.flush_cb) {
-        LV_LOG_WARN("flush_cb is not registered");
+    uint32_t ring_cnt = profiler_ctx->ring_cnt;
+    uint32_t end_arr[LV_PROFILER_THREAD_MAX_DEFAULT];
+    uint32_t * end = ring_cnt <= LV_PROFILER_THREAD_MAX_DEFAULT ? end_arr : lv_malloc(ring_cnt * sizeof(uint32_t));
+    uint32_t i;
+
+    if(end == NULL) {
+        LV_LOG_ERROR("malloc failed for end");
         return;
     }
 
-    uint32_t cur = 0;
+    /*Snapshot the heads: items written after this point are left for the next flush*/
+    for(i = 0; i < ring_cnt; i++) {
+        end[i] = load_acquire(&profiler_ctx->ring_arr[i].head);
+    }
+
+    bool binary = profiler_ctx->config.format == LV_PROFILER_BUILTIN_FORMAT_BINARY;
+    if(binary ? profiler_ctx->config.flush_bin_cb != NULL : profiler_ctx->config.flush_cb != NULL) {
+        flush_items(end, ring_cnt);
+    }
+    else {
+        LV_LOG_WARN("flush_cb is not registered");
+        for(i = 0; i < ring_cnt; i++) {
+            store_release(&profiler_ctx->ring_arr[i].tail, end[i]);
+        }
+    }
+
+    uint32_t overflow_cnt = lv_profiler_builtin_get_overflow_count();
+    if(overflow_cnt != profiler_ctx->overflow_reported) {
+        LV_LOG_WARN("%" LV_PRIu32 " items were dropped", overflow_cnt - profiler_ctx->overflow_reported);
+        profiler_ctx->overflow_reported = overflow_cnt;
+    }
+
+    if(end != end_arr) {
+        lv_free(end);
+    }
+}
+
+static void flush_items(const uint32_t * end, uint32_t ring_cnt)
+{
+    uint32_t i;
+    bool binary = profiler_ctx->config.format == LV_PROFILER_BUILTIN_FORMAT_BINARY;
+
+    /*Merge the rings by timestamp*/
+    while(1) {
+        lv_profiler_builtin_ring_t * ring = NULL;
+        lv_profiler_builtin_item_t * item = NULL;
+        for(i = 0; i < ring_cnt; i++) {
+            lv_profiler_builtin_ring_t * r = &profiler_ctx->ring_arr[i];
+            if(r->tail == end[i]) continue;
+
+            lv_profiler_builtin_item_t * it = &r->item_arr[r->tail];
+            if(item == NULL || it->tick < item->tick) {
+                ring = r;
+                item = it;
+            }
+        }
+
+        if(item == NULL) break;
+
+        if(binary) format_bin_item(ring, item);
+        else format_text_item(ring, item);
+
+        /*Release the slot only after the item was formatted*/
+        store_release(&ring->tail, ring->tail + 1 == ring->item_num ? 0 : ring->tail + 1);
+    }
+
+    if(binary) bin_flush_buf();
+}
+
+static inline uint32_t load_acquire(const volatile uint32_t * p)
+{
+#if LV_USE_OS && defined(__GNUC__)
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+#elif defined(LV_PROFILER_USE_C11_FENCE)
+    uint32_t v = *p;
+    atomic_thread_fence(memory_order_acquire);
+    return v;
+#else
+    /*Without an OS there is only one thread*/
+    return *p;
+#endif
+}
+
+static inline void store_release(volatile uint32_t * p, uint32_t v)
+{
+#if LV_USE_OS && defined(__GNUC__)
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+#elif defined(LV_PROFILER_USE_C11_FENCE)
+    atomic_thread_fence(memory_order_release);
+    *p = v;
+#else
+    *p = v;
+#endif
+}
+
+static void format_text_item(const lv_profiler_builtin_ring_t * ring, const lv_profiler_builtin_item_t * item)
+{
     char buf[LV_PROFILER_STR_MAX_LEN];
     uint32_t tick_per_sec = profiler_ctx->config.tick_per_sec;
-    while(cur < profiler_ctx->cur_index) {
-        lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[cur++];
-        uint32_t sec = item->tick / tick_per_sec;
-        uint32_t usec = (item->tick % tick_per_sec) * (LV_PROFILER_TICK_PER_SEC_MAX / tick_per_sec);
+    uint32_t sec = (uint32_t)(item->tick / tick_per_sec);
+    uint32_t usec = (uint32_t)(item->tick % tick_per_sec) * (LV_PROFILER_TICK_PER_SEC_MAX / tick_per_sec);
 
 #if LV_USE_OS
+    int tid = ring->tid;
+    int cpu = item->cpu;
+#else
+    LV_UNUSED(ring);
+    int tid = 1;
+    int cpu = 0;
+#endif
+
+    if(item->tag == 'C') {
         lv_snprintf(buf, sizeof(buf),
-                    "   LVGL-%d [%d] %" LV_PRIu32 ".%06" LV_PRIu32 ": tracing_mark_write: %c|1|%s\n",
-                    item->tid,
-                    item->cpu,
+                    "   LVGL-%d [%d] %" LV_PRIu32 ".%06" LV_PRIu32 ": tracing_mark_write: C|1|%s|%" LV_PRId32 "\n",
+                    tid,
+                    cpu,
                     sec,
                     usec,
-                    item->tag,
-                    item->func);
-#else
+                    item->func,
+                    item->value);
+    }
+    else {
         lv_snprintf(buf, sizeof(buf),
-                    "   LVGL-1 [0] %" LV_PRIu32 ".%06" LV_PRIu32 ": tracing_mark_write: %c|1|%s\n",
+                    "   LVGL-%d [%d] %" LV_PRIu32 ".%06" LV_PRIu32 ": tracing_mark_write: %c|1|%s\n",
+                    tid,
+                    cpu,
                     sec,
                     usec,
                     item->tag,
                     item->func);
+    }
+
+    profiler_ctx->config.flush_cb(buf);
+}
+
+/**
+ * Binary record of an item:
+ * tag (1 byte), zigzag varint tick delta to the previous item, zigzag varint tid, zigzag varint cpu,
+ * varint string ID of the function, and for 'C' items a zigzag varint value.
+ * A string is sent once before its first use as 'S', varint ID, varint length and the characters.
+ */
+static void format_bin_item(const lv_profiler_builtin_ring_t * ring, const lv_profiler_builtin_item_t * item)
+{
+    uint32_t str_id;
+    if(!bin_get_str_id(item->func, &str_id)) {
+        return;
+    }
+
+    if(profiler_ctx->bin_len + LV_PROFILER_BIN_ITEM_MAX_LEN > LV_PROFILER_BIN_BUF_SIZE) {
+        bin_flush_buf();
+    }
+
+#if LV_USE_OS
+    int tid = ring->tid;
+    int cpu = item->cpu;
+#else
+    LV_UNUSED(ring);
+    int tid = 1;
+    int cpu = 0;
 #endif
-        profiler_ctx->config.flush_cb(buf);
+
+    /*Items written before an earlier flush's snapshot might be older, so the delta is signed*/
+    int64_t tick_delta = (int64_t)(item->tick - profiler_ctx->bin_last_tick);
+    profiler_ctx->bin_last_tick = item->tick;
+
+    profiler_ctx->bin_buf[profiler_ctx->bin_len++] = (uint8_t)item->tag;
+    bin_put_zigzag(tick_delta);
+    bin_put_zigzag(tid);
+    bin_put_zigzag(cpu);
+    bin_put_varint(str_id);
+    if(item->tag == 'C') {
+        bin_put_zigzag(item->value);
+    }
+}
+
+static void bin_put_varint(uint64_t v)
+{
+    while(v >= 0x80) {
+        profiler_ctx->bin_buf[profiler_ctx->bin_len++] = (uint8_t)(v | 0x80);
+        v >>= 7;
     }
+    profiler_ctx->bin_buf[profiler_ctx->bin_len++] = (uint8_t)v;
+}
+
+static void bin_put_zigzag(int64_t v)
+{
+    bin_put_varint(((uint64_t)v << 1) ^ (uint64_t)(v >> 63));
+}
+
+static void bin_flush_buf(void)
+{
+    if(profiler_ctx->bin_len == 0) {
+        return;
+    }
+
+    profiler_ctx->config.flush_bin_cb(profiler_ctx->bin_buf, profiler_ctx->bin_len);
+    profiler_ctx->bin_len = 0;
+}
+
+static uint32_t str_hash(const char * str)
+{
+    return (uint32_t)(((lv_uintptr_t)str >> 2) * 2654435761u);
+}
+
+static bool bin_get_str_id(const char * str, uint32_t * id)
+{
+    uint32_t mask = profiler_ctx->str_cap - 1;
+    uint32_t i;
+
+    if(profiler_ctx->str_arr) {
+        for(i = str_hash(str) & mask; profiler_ctx->str_arr[i].str; i = (i + 1) & mask) {
+            if(profiler_ctx->str_arr[i].str == str) {
+                *id = profiler_ctx->str_arr[i].id;
+                return true;
+            }
+        }
+    }
+
+    /*New string: grow the table if it's 3/4 full*/
+    if((profiler_ctx->str_cnt + 1) * 4 > profiler_ctx->str_cap * 3) {
+        uint32_t new_cap = profiler_ctx->str_cap ? profiler_ctx->str_cap * 2 : LV_PROFILER_STR_TABLE_INIT_SIZE;
+        lv_profiler_builtin_str_t * new_arr = lv_malloc_zeroed(new_cap * sizeof(lv_profiler_builtin_str_t));
+        LV_ASSERT_MALLOC(new_arr);
+        if(new_arr == NULL) {
+            LV_LOG_ERROR("malloc failed for str_arr");
+            return false;
+        }
+
+        uint32_t new_mask = new_cap - 1;
+        for(i = 0; i < profiler_ctx->str_cap; i++) {
+            const char * s = profiler_ctx->str_arr[i].str;
+            if(s == NULL) continue;
+
+            uint32_t j = str_hash(s) & new_mask;
+            while(new_arr[j].str) j = (j + 1) & new_mask;
+            new_arr[j] = profiler_ctx->str_arr[i];
+        }
+
+        lv_free(profiler_ctx->str_arr);
+        profiler_ctx->str_arr = new_arr;
+        profiler_ctx->str_cap = new_cap;
+        mask = new_mask;
+    }
+
+    for(i = str_hash(str) & mask; profiler_ctx->str_arr[i].str; i = (i + 1) & mask);
+    profiler_ctx->str_arr[i].str = str;
+    profiler_ctx->str_arr[i].id = profiler_ctx->str_cnt;
+    *id = profiler_ctx->str_cnt;
+    profiler_ctx->str_cnt++;
+
+    /*Send the string before its first use*/
+    uint32_t len = lv_strlen(str);
+    if(profiler_ctx->bin_len + LV_PROFILER_BIN_ITEM_MAX_LEN + len > LV_PROFILER_BIN_BUF_SIZE) {
+        bin_flush_buf();
+    }
+
+    profiler_ctx->bin_buf[profiler_ctx->bin_len++] = 'S';
+    bin_put_varint(*id);
+    bin_put_varint(len);
+
+    if(profiler_ctx->bin_len + len <= LV_PROFILER_BIN_BUF_SIZE) {
+        lv_memcpy(&profiler_ctx->bin_buf[profiler_ctx->bin_len], str, len);
+        profiler_ctx->bin_len += len;
+    }
+    else {
+        /*Too long for the staging buffer, pass it directly*/
+        bin_flush_buf();
+        profiler_ctx->config.flush_bin_cb(str, len);
+    }
+
+    return true;
 }
 
 #endif /*LV_USE_PROFILER_BUILTIN*/
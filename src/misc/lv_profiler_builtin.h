@@ -28,21 +28,34 @@ extern "C" {
 #define LV_PROFILER_BUILTIN_END_TAG(tag)    lv_profiler_builtin_write((tag), 'E')
 #define LV_PROFILER_BUILTIN_BEGIN           LV_PROFILER_BUILTIN_BEGIN_TAG(__func__)
 #define LV_PROFILER_BUILTIN_END             LV_PROFILER_BUILTIN_END_TAG(__func__)
+#define LV_PROFILER_BUILTIN_COUNTER(name, value) lv_profiler_builtin_write_counter((name), (value))
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * @brief Output format of the built-in profiler
+ */
+typedef enum {
+    LV_PROFILER_BUILTIN_FORMAT_TEXT,   /**< systrace text lines passed to `flush_cb` */
+    LV_PROFILER_BUILTIN_FORMAT_BINARY, /**< Compact binary stream passed to `flush_bin_cb`,
+                                        *   convert it with scripts/trace_bin_to_json.py */
+} lv_profiler_builtin_format_t;
+
 /**
  * @brief LVGL profiler built-in configuration structure
  */
 typedef struct {
-    size_t buf_size;                    /**< The size of the buffer used for profiling data */
-    uint32_t tick_per_sec;              /**< The number of ticks per second */
-    uint32_t (*tick_get_cb)(void);      /**< Callback function to get the current tick count */
-    void (*flush_cb)(const char * buf); /**< Callback function to flush the profiling data */
-    int (*tid_get_cb)(void);            /**< Callback function to get the current thread ID */
-    int (*cpu_get_cb)(void);            /**< Callback function to get the current CPU */
+    size_t buf_size;                      /**< The size of the buffer of each thread used for profiling data */
+    uint32_t tick_per_sec;                /**< The number of ticks per second */
+    uint64_t (*tick_get_cb)(void);        /**< Callback function to get the current tick count */
+    void (*flush_cb)(const char * buf);   /**< Callback function to flush the profiling data */
+    int (*tid_get_cb)(void);              /**< Callback function to get the current thread ID */
+    int (*cpu_get_cb)(void);              /**< Callback function to get the current CPU */
+    uint32_t thread_max;                  /**< Maximum number of threads with their own buffer */
+    lv_profiler_builtin_format_t format;  /**< Output format of the profiling data */
+    void (*flush_bin_cb)(const void * buf, uint32_t size); /**< Callback function to flush the binary profiling data */
 } lv_profiler_builtin_config_t;
 
 /**********************
@@ -78,12 +91,27 @@ void lv_profiler_builtin_set_enable(bool enable);
 void lv_profiler_builtin_flush(void);
 
 /**
- * @brief Write the profiling data for a function with the given tag
+ * @brief Get the number of profiling items dropped since the initialization
+ * because the buffer of the thread was full or no buffer was available for the thread
+ * @return the number of dropped items
+ */
+uint32_t lv_profiler_builtin_get_overflow_count(void);
+
+/**
+ * @brief Write the profiling data for a function with the given tag.
+ * Each thread writes into its own buffer without locking, the buffers are merged on flush.
  * @param func Name of the function being profiled
  * @param tag Tag to associate with the profiling data for the function
  */
 void lv_profiler_builtin_write(const char * func, char tag);
 
+/**
+ * @brief Write the value of a counter track, e.g. FPS or memory usage
+ * @param name Name of the counter. Only the address is stored, so it must be a static string.
+ * @param value The current value of the counter
+ */
+void lv_profiler_builtin_write_counter(const char * name, int32_t value);
+
 /**********************
  *      MACROS
  **********************/
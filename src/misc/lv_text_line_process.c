@@ -24,7 +24,7 @@ typedef struct {
 
     lv_text_line_process_line_info_t line_info_prev;
     bool has_prev_line_info;
-    uint32_t max_width;
+    int32_t max_width;
     uint32_t letter_space;
     uint8_t tab_width;
     bool long_break;
@@ -53,7 +53,7 @@ static lv_result_t line_iter_next_cb(void * instance, void * context, void * ele
  **********************/
 
 lv_iter_t * lv_text_line_process_iter_create(const char * txt, const lv_font_t * font,
-                                             uint16_t max_width, uint32_t letter_space, uint8_t tab_width, bool long_break)
+                                             int32_t max_width, uint32_t letter_space, uint8_t tab_width, bool long_break)
 {
     lv_iter_t * iter = lv_iter_create((void *)txt, sizeof(lv_text_line_process_line_info_t), sizeof(lv_text_line_process_t),
                                       line_iter_next_cb);
@@ -188,6 +188,8 @@ static void perf_update_timer_cb(lv_timer_t * t)
                                   1000 / disp_refr_period);   /*Limit due to possible off-by-one error*/
 
     info->calculated.cpu = 100 - LV_SYSMON_GET_IDLE();
+    LV_PROFILER_REFR_COUNTER("fps", (int32_t)info->calculated.fps);
+    LV_PROFILER_REFR_COUNTER("cpu", (int32_t)info->calculated.cpu);
     info->calculated.refr_avg_time = info->measured.refr_cnt ? (info->measured.refr_elaps_sum / info->measured.refr_cnt) :
                                      0;
 
@@ -260,6 +262,7 @@ static void mem_update_timer_cb(lv_timer_t * t)
 
     lv_mem_monitor_t * mem_mon = lv_timer_get_user_data(t);
     lv_mem_monitor(mem_mon);
+    LV_PROFILER_SYSMON_COUNTER("mem_used", (int32_t)(mem_mon->total_size - mem_mon->free_size));
     lv_subject_set_pointer(&sysmon_mem.subject, mem_mon);
 }
 
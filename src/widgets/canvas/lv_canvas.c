@@ -16,11 +16,21 @@
 #include "../../draw/sw/lv_draw_sw.h"
 #include "../../stdlib/lv_string.h"
 #include "../../misc/cache/lv_cache.h"
+#include "../../misc/lv_timer.h"
+#include "../../stdlib/lv_mem.h"
+#include "../../tick/lv_tick.h"
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS (&lv_canvas_class)
 
+/*Period of checking the draw tasks of an asynchronously rendered layer [ms]*/
+#define ASYNC_RENDER_PERIOD         5
+
+/*Without an OS the draw units render during dispatching. Render only for this long
+ *in one step to keep the UI responsive [ms]*/
+#define ASYNC_RENDER_TIME_SLICE     5
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,6 +40,11 @@
  **********************/
 static void lv_canvas_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_canvas_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void refr_start_event_cb(lv_event_t * e);
+static void init_layer(lv_layer_t * layer, lv_draw_buf_t * draw_buf);
+static bool get_drawn_area(lv_layer_t * layer, lv_area_t * drawn_area);
+static void async_timer_cb(lv_timer_t * timer);
+static void async_render_ready(lv_obj_t * obj);
 
 /**********************
  *  STATIC VARIABLES
@@ -99,6 +114,21 @@ void lv_canvas_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf)
     lv_image_cache_drop(draw_buf);
 }
 
+void lv_canvas_set_back_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    if(draw_buf && canvas->draw_buf) {
+        LV_ASSERT_MSG(draw_buf->header.w == canvas->draw_buf->header.w &&
+                      draw_buf->header.h == canvas->draw_buf->header.h &&
+                      draw_buf->header.cf == canvas->draw_buf->header.cf,
+                      "The back buffer must have the same size and color format as the canvas's buffer");
+    }
+
+    canvas->back_buf = draw_buf;
+}
+
 void lv_canvas_set_px(lv_obj_t * obj, int32_t x, int32_t y, lv_color_t color, lv_opa_t opa)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -149,7 +179,62 @@ void lv_canvas_set_px(lv_obj_t * obj, int32_t x, int32_t y, lv_color_t color, lv
         buf->blue = color.blue;
         buf->alpha = opa;
     }
-    lv_obj_invalidate(obj);
+
+    lv_area_t area = {x, y, x, y};
+    lv_canvas_invalidate_buf_area(obj, &area);
+}
+
+void lv_canvas_set_px_span(lv_obj_t * obj, int32_t x, int32_t y, int32_t len, const void * px)
+{
+    lv_area_t area = {x, y, x + len - 1, y};
+    lv_canvas_set_px_rect(obj, &area, px, 0);
+}
+
+void lv_canvas_set_px_rect(lv_obj_t * obj, const lv_area_t * area, const void * px, uint32_t stride)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(area);
+    LV_ASSERT_NULL(px);
+
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    lv_draw_buf_t * draw_buf = canvas->draw_buf;
+    if(draw_buf == NULL) return;
+
+    const uint32_t bpp = lv_color_format_get_bpp(draw_buf->header.cf);
+    if(stride == 0) stride = (lv_area_get_width(area) * bpp + 7) >> 3;
+
+    lv_area_t canvas_area = {0, 0, draw_buf->header.w - 1, draw_buf->header.h - 1};
+    lv_area_t clipped;
+    if(!_lv_area_intersect(&clipped, area, &canvas_area)) return;
+
+    const uint8_t * src = px;
+    src += (clipped.y1 - area->y1) * stride;
+    const uint32_t src_x = clipped.x1 - area->x1;
+    const uint32_t w = lv_area_get_width(&clipped);
+
+    int32_t y;
+    for(y = clipped.y1; y <= clipped.y2; y++) {
+        if(bpp >= 8) {
+            const uint32_t px_size = bpp >> 3;
+            lv_memcpy(lv_draw_buf_goto_xy(draw_buf, clipped.x1, y), src + src_x * px_size, w * px_size);
+        }
+        else {
+            /*Copy the pixels one by one as they might be shifted in the bytes*/
+            uint8_t * dest = lv_draw_buf_goto_xy(draw_buf, 0, y);
+            const uint8_t mask = (1 << bpp) - 1;
+            uint32_t x;
+            for(x = 0; x < w; x++) {
+                uint32_t src_bit = (src_x + x) * bpp;
+                uint32_t dest_bit = (clipped.x1 + x) * bpp;
+                uint8_t v = (src[src_bit >> 3] >> (8 - bpp - (src_bit & 0x7))) & mask;
+                uint32_t shift = 8 - bpp - (dest_bit & 0x7);
+                dest[dest_bit >> 3] = (dest[dest_bit >> 3] & ~(mask << shift)) | (v << shift);
+            }
+        }
+        src += stride;
+    }
+
+    lv_canvas_invalidate_buf_area(obj, &clipped);
 }
 
 void lv_canvas_set_palette(lv_obj_t * obj, uint8_t index, lv_color32_t color)
@@ -239,6 +324,14 @@ const void * lv_canvas_get_buf(lv_obj_t * obj)
     return NULL;
 }
 
+bool lv_canvas_is_rendering(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    return canvas->async_timer != NULL;
+}
+
 /*=====================
  * Other functions
  *====================*/
@@ -311,7 +404,8 @@ void lv_canvas_fill_bg(lv_obj_t * obj, lv_color_t color, lv_opa_t opa)
         }
     }
 
-    lv_obj_invalidate(obj);
+    lv_area_t area = {0, 0, header->w - 1, header->h - 1};
+    lv_canvas_invalidate_buf_area(obj, &area);
 }
 
 void lv_canvas_init_layer(lv_obj_t * obj, lv_layer_t * layer)
@@ -321,25 +415,76 @@ void lv_canvas_init_layer(lv_obj_t * obj, lv_layer_t * layer)
     lv_canvas_t * canvas = (lv_canvas_t *)obj;
     if(canvas->draw_buf == NULL) return;
 
-    lv_image_header_t * header = &canvas->draw_buf->header;
-    lv_area_t canvas_area = {0, 0, header->w - 1,  header->h - 1};
-    lv_memzero(layer, sizeof(*layer));
-#if LV_DRAW_TRANSFORM_USE_MATRIX
-    lv_matrix_identity(&layer->matrix);
-#endif
-    layer->draw_buf = canvas->draw_buf;
-    layer->color_format = header->cf;
-    layer->buf_area = canvas_area;
-    layer->_clip_area = canvas_area;
-    layer->phy_clip_area = canvas_area;
+    init_layer(layer, canvas->draw_buf);
 }
 
 void lv_canvas_finish_layer(lv_obj_t * canvas, lv_layer_t * layer)
 {
+    lv_area_t drawn_area;
+    bool drawn = get_drawn_area(layer, &drawn_area);
+
     while(layer->draw_task_head) {
         lv_draw_dispatch_wait_for_request();
         lv_draw_dispatch_layer(lv_obj_get_display(canvas), layer);
     }
+
+    if(drawn) lv_canvas_invalidate_buf_area(canvas, &drawn_area);
+}
+
+lv_layer_t * lv_canvas_init_layer_async(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    if(canvas->draw_buf == NULL) return NULL;
+
+    if(canvas->async_layer) {
+        LV_LOG_WARN("the previous asynchronous layer is not finished yet");
+        return NULL;
+    }
+
+    canvas->async_layer = lv_malloc(sizeof(lv_layer_t));
+    LV_ASSERT_MALLOC(canvas->async_layer);
+    if(canvas->async_layer == NULL) return NULL;
+
+    init_layer(canvas->async_layer, canvas->back_buf ? canvas->back_buf : canvas->draw_buf);
+    return canvas->async_layer;
+}
+
+void lv_canvas_finish_layer_async(lv_obj_t * obj, lv_layer_t * layer)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(layer);
+
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    LV_ASSERT_MSG(layer == canvas->async_layer, "The layer needs to be created by lv_canvas_init_layer_async");
+    if(layer != canvas->async_layer || canvas->async_timer) return;
+
+    if(!get_drawn_area(layer, &canvas->async_area)) {
+        lv_area_set(&canvas->async_area, 0, 0, -1, -1);
+    }
+
+    canvas->async_timer = lv_timer_create(async_timer_cb, ASYNC_RENDER_PERIOD, obj);
+    lv_timer_ready(canvas->async_timer);
+}
+
+void lv_canvas_invalidate_buf_area(lv_obj_t * obj, const lv_area_t * area)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(area);
+
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+
+    if(lv_area_get_width(&canvas->dirty_area) > 0) {
+        _lv_area_join(&canvas->dirty_area, &canvas->dirty_area, area);
+        return;
+    }
+
+    /*Invalidate the first area now to start a refresh, and the area of all
+     *the changes when the refresh starts*/
+    canvas->dirty_area = *area;
+    lv_image_invalidate_src_area(obj, area);
+    lv_display_add_event_cb(lv_obj_get_display(obj), refr_start_event_cb, LV_EVENT_REFR_START, obj);
 }
 
 /**********************
@@ -349,7 +494,9 @@ void lv_canvas_finish_layer(lv_obj_t * canvas, lv_layer_t * layer)
 static void lv_canvas_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 {
     LV_UNUSED(class_p);
-    LV_UNUSED(obj);
+
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    lv_area_set(&canvas->dirty_area, 0, 0, -1, -1);
 }
 
 static void lv_canvas_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
@@ -358,9 +505,114 @@ static void lv_canvas_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     LV_TRACE_OBJ_CREATE("begin");
 
     lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    if(lv_area_get_width(&canvas->dirty_area) > 0) {
+        lv_display_remove_event_cb_with_user_data(lv_obj_get_display(obj), refr_start_event_cb, obj);
+    }
+
+    if(canvas->async_layer) {
+        /*The draw units might still write the buffer, so finish the rendering*/
+        if(canvas->async_timer) lv_timer_delete(canvas->async_timer);
+        lv_layer_t * layer = canvas->async_layer;
+        while(layer->draw_task_head) {
+            lv_draw_dispatch_layer(lv_obj_get_display(obj), layer);
+            if(layer->draw_task_head) lv_draw_dispatch_wait_for_request();
+        }
+        lv_free(layer);
+    }
+
     if(canvas->draw_buf == NULL) return;
 
     lv_image_cache_drop(&canvas->draw_buf);
 }
 
+static void refr_start_event_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_user_data(e);
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+
+    lv_image_invalidate_src_area(obj, &canvas->dirty_area);
+    lv_area_set(&canvas->dirty_area, 0, 0, -1, -1);
+    lv_display_remove_event_cb_with_user_data(lv_event_get_current_target(e), refr_start_event_cb, obj);
+}
+
+static void init_layer(lv_layer_t * layer, lv_draw_buf_t * draw_buf)
+{
+    lv_image_header_t * header = &draw_buf->header;
+    lv_area_t canvas_area = {0, 0, header->w - 1,  header->h - 1};
+    lv_memzero(layer, sizeof(*layer));
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    lv_matrix_identity(&layer->matrix);
+#endif
+    layer->draw_buf = draw_buf;
+    layer->color_format = header->cf;
+    layer->buf_area = canvas_area;
+    layer->_clip_area = canvas_area;
+    layer->phy_clip_area = canvas_area;
+}
+
+/**
+ * Get the area of the layer's buffer where its draw tasks draw
+ * @param layer         pointer to a layer
+ * @param drawn_area    store the result here
+ * @return              true: something will be drawn; false: the area is empty
+ */
+static bool get_drawn_area(lv_layer_t * layer, lv_area_t * drawn_area)
+{
+    bool drawn = false;
+    lv_draw_task_t * t;
+    for(t = layer->draw_task_head; t; t = t->next) {
+        lv_area_t task_area;
+        if(!_lv_area_intersect(&task_area, &t->_real_area, &t->clip_area)) continue;
+
+        if(drawn) _lv_area_join(drawn_area, drawn_area, &task_area);
+        else *drawn_area = task_area;
+        drawn = true;
+    }
+
+    return drawn && _lv_area_intersect(drawn_area, drawn_area, &layer->buf_area);
+}
+
+static void async_timer_cb(lv_timer_t * timer)
+{
+    lv_obj_t * obj = lv_timer_get_user_data(timer);
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    lv_layer_t * layer = canvas->async_layer;
+    lv_display_t * disp = lv_obj_get_display(obj);
+
+#if LV_USE_OS
+    /*The draw units render in their own threads, just pass them the next tasks*/
+    lv_draw_dispatch_layer(disp, layer);
+#else
+    uint32_t t_start = lv_tick_get();
+    do {
+        lv_draw_dispatch_layer(disp, layer);
+    } while(layer->draw_task_head && lv_tick_elaps(t_start) < ASYNC_RENDER_TIME_SLICE);
+#endif
+
+    if(layer->draw_task_head == NULL) async_render_ready(obj);
+}
+
+static void async_render_ready(lv_obj_t * obj)
+{
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    lv_draw_buf_t * rendered_buf = canvas->async_layer->draw_buf;
+
+    lv_timer_delete(canvas->async_timer);
+    canvas->async_timer = NULL;
+    lv_free(canvas->async_layer);
+    canvas->async_layer = NULL;
+
+    if(rendered_buf != canvas->draw_buf) {
+        /*Show the rendered buffer and render into the shown one the next time*/
+        lv_draw_buf_t * shown_buf = canvas->draw_buf;
+        lv_canvas_set_draw_buf(obj, rendered_buf);
+        canvas->back_buf = shown_buf;
+    }
+    else if(lv_area_get_width(&canvas->async_area) > 0) {
+        lv_canvas_invalidate_buf_area(obj, &canvas->async_area);
+    }
+
+    lv_obj_send_event(obj, LV_EVENT_READY, NULL);
+}
+
 #endif
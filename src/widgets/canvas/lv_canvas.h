@@ -34,6 +34,11 @@ typedef struct {
     lv_image_t img;
     lv_draw_buf_t * draw_buf;
     lv_draw_buf_t static_buf;
+    lv_area_t dirty_area;   /*Modified area of the buffer which will be invalidated before the next refresh*/
+    lv_draw_buf_t * back_buf;   /*Rendered asynchronously while `draw_buf` is shown*/
+    lv_layer_t * async_layer;   /*The layer being rendered asynchronously*/
+    lv_timer_t * async_timer;   /*Dispatches the draw tasks of `async_layer`*/
+    lv_area_t async_area;       /*Area of the buffer covered by the tasks of `async_layer`*/
 } lv_canvas_t;
 
 /**********************
@@ -75,6 +80,15 @@ void lv_canvas_set_buffer(lv_obj_t * obj, void * buf, int32_t w, int32_t h, lv_c
  */
 void lv_canvas_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf);
 
+/**
+ * Set a second draw buffer for asynchronous rendering. `lv_canvas_finish_layer_async` renders
+ * into it while the canvas keeps showing its current buffer, and the two buffers are swapped
+ * when the rendering is ready. It needs to have the same size and color format as the canvas's buffer.
+ * @param obj       pointer to a canvas object
+ * @param draw_buf  pointer to a draw buffer or NULL to render into the shown buffer
+ */
+void lv_canvas_set_back_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf);
+
 /**
  * Set a pixel's color and opacity
  * @param obj   pointer to a canvas
@@ -89,6 +103,25 @@ void lv_canvas_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf);
  */
 void lv_canvas_set_px(lv_obj_t * obj, int32_t x, int32_t y, lv_color_t color, lv_opa_t opa);
 
+/**
+ * Copy a row of pixels to the canvas
+ * @param obj   pointer to a canvas
+ * @param x     X coordinate of the first pixel
+ * @param y     Y coordinate of the row
+ * @param len   number of pixels
+ * @param px    the pixels in the color format of the canvas
+ */
+void lv_canvas_set_px_span(lv_obj_t * obj, int32_t x, int32_t y, int32_t len, const void * px);
+
+/**
+ * Copy a rectangle of pixels to the canvas
+ * @param obj       pointer to a canvas
+ * @param area      the area to write on the canvas. It's clipped to the canvas.
+ * @param px        the pixels of the whole area in the color format of the canvas
+ * @param stride    number of bytes in a row of `px`. 0: the rows of `px` are not padded
+ */
+void lv_canvas_set_px_rect(lv_obj_t * obj, const lv_area_t * area, const void * px, uint32_t stride);
+
 /**
  * Set the palette color of a canvas for index format. Valid only for `LV_COLOR_FORMAT_I1/2/4/8`
  * @param obj       pointer to canvas object
@@ -132,6 +165,13 @@ lv_image_dsc_t * lv_canvas_get_image(lv_obj_t * canvas);
  */
 const void * lv_canvas_get_buf(lv_obj_t * canvas);
 
+/**
+ * Tell whether a layer passed to `lv_canvas_finish_layer_async` is still being rendered
+ * @param obj       pointer to a canvas object
+ * @return          true: the rendering is in progress
+ */
+bool lv_canvas_is_rendering(lv_obj_t * obj);
+
 /*=====================
  * Other functions
  *====================*/
@@ -163,13 +203,42 @@ void lv_canvas_fill_bg(lv_obj_t * obj, lv_color_t color, lv_opa_t opa);
 void lv_canvas_init_layer(lv_obj_t * canvas, lv_layer_t * layer);
 
 /**
- * Wait until all the drawings are finished on layer.
+ * Wait until all the drawings are finished on layer and invalidate the area where something was drawn.
  * Needs to be usd in pair with `lv_canvas_init_layer`.
  * @param canvas    pointer to a canvas
  * @param layer     pointer to a layer to finalize
  */
 void lv_canvas_finish_layer(lv_obj_t * canvas, lv_layer_t * layer);
 
+/**
+ * Get a layer to draw on the canvas asynchronously with LVGL's generic draw functions.
+ * The layer targets the back buffer if it's set (see `lv_canvas_set_back_draw_buf`).
+ * Its content is not copied from the shown buffer, so the drawing should cover all the
+ * parts which need to be kept.
+ * Needs to be used in pair with `lv_canvas_finish_layer_async`.
+ * @param obj       pointer to a canvas
+ * @return          the layer owned by the canvas, or NULL if there is no buffer or
+ *                  the previous asynchronous rendering is still in progress
+ */
+lv_layer_t * lv_canvas_init_layer_async(lv_obj_t * obj);
+
+/**
+ * Start rendering the layer on the draw units and return immediately.
+ * When all the draw tasks are ready the buffers are swapped (if there is a back buffer),
+ * the drawn area is invalidated and `LV_EVENT_READY` is sent to the canvas.
+ * @param obj       pointer to a canvas
+ * @param layer     the layer returned by `lv_canvas_init_layer_async`
+ */
+void lv_canvas_finish_layer_async(lv_obj_t * obj, lv_layer_t * layer);
+
+/**
+ * Mark an area of the canvas as changed. The changed areas are merged and invalidated
+ * together before the next refresh. Needs to be called only if the buffer is modified directly.
+ * @param obj       pointer to a canvas
+ * @param area      the changed area relative to the canvas's buffer
+ */
+void lv_canvas_invalidate_buf_area(lv_obj_t * obj, const lv_area_t * area);
+
 /**********************
  *      MACROS
  **********************/
@@ -34,6 +34,9 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e);
 
 static void draw_div_lines(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer);
+static void draw_series_polyline(lv_obj_t * obj, lv_layer_t * layer, lv_draw_line_dsc_t * line_dsc,
+                                 lv_draw_rect_dsc_t * point_dsc, const lv_point_precise_t * points, uint32_t point_cnt,
+                                 bool crowded_mode);
 static void draw_series_bar(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_cursors(lv_obj_t * obj, lv_layer_t * layer);
@@ -41,6 +44,18 @@ static void draw_axes(lv_obj_t * obj, lv_layer_t * layer);
 static uint32_t get_index_from_x(lv_obj_t * obj, int32_t x);
 static void invalidate_point(lv_obj_t * obj, uint32_t i);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, int32_t ** a);
+static int32_t get_line_x(lv_chart_t * chart, const lv_chart_series_t * ser, int32_t w, uint32_t i);
+static bool stream_get_geometry(lv_obj_t * obj, int32_t * w, int32_t * h, int32_t * margin);
+static void stream_add_value(lv_obj_t * obj, lv_chart_series_t * ser);
+static void stream_rebuild(lv_obj_t * obj, lv_chart_series_t * ser, int32_t w, int32_t h, int32_t margin);
+static void stream_redraw(lv_obj_t * obj, lv_chart_series_t * ser, int32_t w, int32_t margin, int32_t x1,
+                          int32_t x2);
+static void stream_render(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t first, uint32_t last, int32_t x1,
+                          int32_t x2);
+static void stream_clear(lv_chart_series_t * ser, int32_t x1, int32_t x2);
+static bool stream_draw(lv_obj_t * obj, lv_layer_t * layer, lv_chart_series_t * ser, int32_t x_ofs, int32_t y_ofs);
+static void stream_drop(lv_chart_series_t * ser);
+static void stream_drop_all(lv_obj_t * obj);
 lv_chart_tick_dsc_t * get_tick_gsc(lv_obj_t * obj, lv_chart_axis_t axis);
 
 /**********************
@@ -120,6 +135,7 @@ void lv_chart_set_point_count(lv_obj_t * obj, uint32_t cnt)
         }
         if(!ser->y_ext_buf_assigned) new_points_alloc(obj, ser, cnt, &ser->y_points);
         ser->start_point = 0;
+        ser->stream_phase = 0;
     }
 
     chart->point_cnt = cnt;
@@ -167,6 +183,12 @@ void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode
     if(chart->update_mode == update_mode) return;
 
     chart->update_mode = update_mode;
+
+    lv_chart_series_t * ser;
+    _LV_LL_READ_BACK(&chart->series_ll, ser) {
+        ser->stream_phase = 0;
+    }
+    stream_drop_all(obj);
     lv_obj_invalidate(obj);
 }
 
@@ -267,7 +289,7 @@ uint32_t lv_chart_get_x_start_point(const lv_obj_t * obj, lv_chart_series_t * se
     LV_ASSERT_NULL(ser);
     lv_chart_t * chart  = (lv_chart_t *)obj;
 
-    return chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+    return chart->update_mode != LV_CHART_UPDATE_MODE_CIRCULAR ? ser->start_point : 0;
 }
 
 void lv_chart_get_point_pos_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, lv_point_t * p_out)
@@ -288,7 +310,7 @@ void lv_chart_get_point_pos_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint3
     int32_t h = ((int32_t)lv_obj_get_content_height(obj) * chart->zoom_y) >> 8;
 
     if(chart->type == LV_CHART_TYPE_LINE) {
-        p_out->x = (w * id) / (chart->point_cnt - 1);
+        p_out->x = get_line_x(chart, ser, w, id);
     }
     else if(chart->type == LV_CHART_TYPE_SCATTER) {
         p_out->x = lv_map(ser->x_points[id], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
@@ -335,6 +357,7 @@ void lv_chart_refresh(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    stream_drop_all(obj);
     lv_obj_invalidate(obj);
 }
 
@@ -382,6 +405,9 @@ lv_chart_series_t * lv_chart_add_series(lv_obj_t * obj, lv_color_t color, lv_cha
     /* Set series properties on successful allocation */
     ser->color = color;
     ser->start_point = 0;
+    ser->stream_buf = NULL;
+    ser->stream_ring = 0;
+    ser->stream_phase = 0;
     ser->y_ext_buf_assigned = false;
     ser->hidden = 0;
     ser->x_axis_sec = axis & LV_CHART_AXIS_SECONDARY_X ? 1 : 0;
@@ -406,6 +432,7 @@ void lv_chart_remove_series(lv_obj_t * obj, lv_chart_series_t * series)
     lv_chart_t * chart    = (lv_chart_t *)obj;
     if(!series->y_ext_buf_assigned && series->y_points) lv_free(series->y_points);
     if(!series->x_ext_buf_assigned && series->x_points) lv_free(series->x_points);
+    stream_drop(series);
 
     _lv_ll_remove(&chart->series_ll, series);
     lv_free(series);
@@ -439,6 +466,7 @@ void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint32_
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(id >= chart->point_cnt) return;
     ser->start_point = id;
+    stream_drop(ser);
 }
 
 lv_chart_series_t * lv_chart_get_series_next(const lv_obj_t * obj, const lv_chart_series_t * ser)
@@ -530,6 +558,8 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, int32_t va
     invalidate_point(obj, ser->start_point);
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
     invalidate_point(obj, ser->start_point);
+
+    if(chart->update_mode == LV_CHART_UPDATE_MODE_STREAM) stream_add_value(obj, ser);
 }
 
 void lv_chart_set_next_value2(lv_obj_t * obj, lv_chart_series_t * ser, int32_t x_value, int32_t y_value)
@@ -558,6 +588,7 @@ void lv_chart_set_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t
 
     if(id >= chart->point_cnt) return;
     ser->y_points[id] = value;
+    stream_drop(ser);
     invalidate_point(obj, id);
 }
 
@@ -587,6 +618,7 @@ void lv_chart_set_ext_y_array(lv_obj_t * obj, lv_chart_series_t * ser, int32_t a
     if(!ser->y_ext_buf_assigned && ser->y_points) lv_free(ser->y_points);
     ser->y_ext_buf_assigned = true;
     ser->y_points = array;
+    stream_drop(ser);
     lv_obj_invalidate(obj);
 }
 
@@ -689,6 +721,7 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
         if(!ser->y_ext_buf_assigned) lv_free(ser->y_points);
         if(!ser->x_ext_buf_assigned) lv_free(ser->x_points);
+        stream_drop(ser);
 
         _lv_ll_remove(&chart->series_ll, ser);
         lv_free(ser);
@@ -740,6 +773,10 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e)
     }
     else if(code == LV_EVENT_SIZE_CHANGED) {
         lv_obj_refresh_self_size(obj);
+        stream_drop_all(obj);
+    }
+    else if(code == LV_EVENT_STYLE_CHANGED) {
+        stream_drop_all(obj);
     }
     else if(code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
         lv_event_set_ext_draw_size(e, LV_MAX4(chart->tick[0].draw_size, chart->tick[1].draw_size, chart->tick[2].draw_size,
@@ -882,6 +919,23 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
     /*If there are at least as many points as pixels then draw only vertical lines*/
     bool crowded_mode = (int32_t)chart->point_cnt >= w;
 
+    /*If the draw tasks are not hooked by the user draw each continuous part of the series with a single polyline.
+     *In crowded mode only the minimum and maximum of each pixel column is added to it.*/
+    lv_point_precise_t * poly_points = NULL;
+    if(!lv_obj_has_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS)) {
+        uint32_t poly_max = crowded_mode ? 2 * (uint32_t)(w + 2) : chart->point_cnt;
+        poly_points = lv_malloc(sizeof(lv_point_precise_t) * poly_max);
+        LV_ASSERT_MALLOC(poly_points);
+    }
+
+    /*Skip the points on the left of the clip area without processing them one by one*/
+    uint32_t i_first = 0;
+    int32_t x_skip = clip_area_ori.x1 - point_w - 1 - x_ofs;
+    if(x_skip > 0 && w > 0) {
+        int64_t i_skip = ((int64_t)x_skip * (chart->point_cnt - 1)) / w - 1;
+        if(i_skip > 0) i_first = (uint32_t)LV_MIN(i_skip, (int64_t)chart->point_cnt - 1);
+    }
+
     line_dsc.base.id1 = _lv_ll_get_len(&chart->series_ll) - 1;
     point_dsc_default.base.id1 = line_dsc.base.id1;
     /*Go through all data lines*/
@@ -896,8 +950,88 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
         line_dsc.base.id2 = 0;
         point_dsc_default.base.id2 = 0;
 
+        if(chart->update_mode == LV_CHART_UPDATE_MODE_STREAM && stream_draw(obj, layer, ser, x_ofs, y_ofs)) {
+            point_dsc_default.base.id1--;
+            line_dsc.base.id1--;
+            continue;
+        }
+
         int32_t start_point = lv_chart_get_x_start_point(obj, ser);
 
+        if(poly_points) {
+            uint32_t poly_cnt = 0;
+            int32_t col_x = 0;
+            int32_t col_y_min = 0;
+            int32_t col_y_max = 0;
+            bool col_max_first = false;
+            bool col_empty = true;
+
+            for(i = i_first; i < chart->point_cnt; i++) {
+                int32_t x = get_line_x(chart, ser, w, i) + x_ofs;
+                int32_t p_act = (start_point + i) % chart->point_cnt;
+
+                if(crowded_mode && !col_empty && (x != col_x || ser->y_points[p_act] == LV_CHART_POINT_NONE)) {
+                    /*Close the column: add its extremes in the order they appeared*/
+                    poly_points[poly_cnt].x = col_x;
+                    poly_points[poly_cnt].y = col_max_first ? col_y_max : col_y_min;
+                    poly_cnt++;
+                    if(col_y_min != col_y_max) {
+                        poly_points[poly_cnt].x = col_x;
+                        poly_points[poly_cnt].y = col_max_first ? col_y_min : col_y_max;
+                        poly_cnt++;
+                    }
+                    col_empty = true;
+                }
+
+                if(ser->y_points[p_act] == LV_CHART_POINT_NONE) {
+                    draw_series_polyline(obj, layer, &line_dsc, &point_dsc_default, poly_points, poly_cnt, crowded_mode);
+                    poly_cnt = 0;
+                }
+                else {
+                    int32_t y = h - lv_map(ser->y_points[p_act], chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0,
+                                           h) + y_ofs;
+                    if(!crowded_mode) {
+                        poly_points[poly_cnt].x = x;
+                        poly_points[poly_cnt].y = y;
+                        poly_cnt++;
+                    }
+                    else if(col_empty) {
+                        col_x = x;
+                        col_y_min = y;
+                        col_y_max = y;
+                        col_empty = false;
+                    }
+                    else if(y < col_y_min) {
+                        col_y_min = y;
+                        col_max_first = true;
+                    }
+                    else if(y > col_y_max) {
+                        col_y_max = y;
+                        col_max_first = false;
+                    }
+                }
+
+                if(x > clip_area_ori.x2 + point_w + 1) break;
+            }
+
+            if(!col_empty) {
+                poly_points[poly_cnt].x = col_x;
+                poly_points[poly_cnt].y = col_max_first ? col_y_max : col_y_min;
+                poly_cnt++;
+                if(col_y_min != col_y_max) {
+                    poly_points[poly_cnt].x = col_x;
+                    poly_points[poly_cnt].y = col_max_first ? col_y_min : col_y_max;
+                    poly_cnt++;
+                }
+            }
+
+            draw_series_polyline(obj, layer, &line_dsc, &point_dsc_default, poly_points, poly_cnt, crowded_mode);
+
+            point_dsc_default.base.id1--;
+            line_dsc.base.id1--;
+            continue;
+        }
+
         line_dsc.p1.x = x_ofs;
         line_dsc.p2.x = x_ofs;
 
@@ -914,7 +1048,7 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
             line_dsc.p1.y = line_dsc.p2.y;
 
             if(line_dsc.p1.x > clip_area_ori.x2 + point_w + 1) break;
-            line_dsc.p2.x = (lv_value_precise_t)((w * i) / (chart->point_cnt - 1)) + x_ofs;
+            line_dsc.p2.x = (lv_value_precise_t)get_line_x(chart, ser, w, i) + x_ofs;
 
             p_act = (start_point + i) % chart->point_cnt;
 
@@ -987,9 +1121,45 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
         line_dsc.base.id1--;
     }
 
+    lv_free(poly_points);
     layer->_clip_area = clip_area_ori;
 }
 
+static void draw_series_polyline(lv_obj_t * obj, lv_layer_t * layer, lv_draw_line_dsc_t * line_dsc,
+                                 lv_draw_rect_dsc_t * point_dsc, const lv_point_precise_t * points, uint32_t point_cnt,
+                                 bool crowded_mode)
+{
+    if(point_cnt == 0) return;
+
+    if(point_cnt >= 2) {
+        lv_draw_polyline(layer, line_dsc, points, point_cnt);
+    }
+    else if(crowded_mode) {
+        /*A single column with a single value: draw a dot as the vertical lines would be invisible*/
+        line_dsc->p1 = points[0];
+        line_dsc->p2 = points[0];
+        line_dsc->p2.y++;
+        lv_draw_line(layer, line_dsc);
+    }
+
+    if(crowded_mode) return;
+
+    /*The points are drawn after the line to be on the top of it*/
+    int32_t point_w = lv_obj_get_style_width(obj, LV_PART_INDICATOR) / 2;
+    int32_t point_h = lv_obj_get_style_height(obj, LV_PART_INDICATOR) / 2;
+    if(point_w && point_h) {
+        uint32_t i;
+        for(i = 0; i < point_cnt; i++) {
+            lv_area_t point_area;
+            point_area.x1 = (int32_t)points[i].x - point_w;
+            point_area.x2 = (int32_t)points[i].x + point_w;
+            point_area.y1 = (int32_t)points[i].y - point_h;
+            point_area.y2 = (int32_t)points[i].y + point_h;
+            lv_draw_rect(layer, point_dsc, &point_area);
+        }
+    }
+}
+
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
 {
 
@@ -1551,7 +1721,7 @@ static void invalidate_point(lv_obj_t * obj, uint32_t i)
     int32_t scroll_left = lv_obj_get_scroll_left(obj);
 
     /*In shift mode the whole chart changes so the whole object*/
-    if(chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT) {
+    if(chart->update_mode != LV_CHART_UPDATE_MODE_CIRCULAR) {
         lv_obj_invalidate(obj);
         return;
     }
@@ -1650,6 +1820,343 @@ static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t c
     }
 }
 
+static int32_t get_line_x(lv_chart_t * chart, const lv_chart_series_t * ser, int32_t w, uint32_t i)
+{
+    /*In stream mode the positions are rounded relative to the first value ever added,
+     *so that adding a value moves all the points by the same amount of pixels*/
+    uint32_t phase = chart->update_mode == LV_CHART_UPDATE_MODE_STREAM ? ser->stream_phase : 0;
+    int64_t x = ((int64_t)w * (i + phase)) / (chart->point_cnt - 1);
+    int64_t x_phase = ((int64_t)w * phase) / (chart->point_cnt - 1);
+    return (int32_t)(x - x_phase);
+}
+
+/**
+ * Get the size of the ring buffers of stream mode.
+ * @param obj       pointer to a chart
+ * @param w         store the width of the series area here
+ * @param h         store the height of the series area here
+ * @param margin    store the space around the series area for the line endings and points here
+ * @return          true: the lines can be cached; false: draw the lines as usual
+ */
+static bool stream_get_geometry(lv_obj_t * obj, int32_t * w, int32_t * h, int32_t * margin)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->type != LV_CHART_TYPE_LINE) return false;
+    if(chart->zoom_x != LV_SCALE_NONE || chart->zoom_y != LV_SCALE_NONE) return false;
+    if(chart->point_cnt < 2) return false;
+
+    /*The draw tasks of the segments can't be modified if they are cached*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS)) return false;
+
+    *w = lv_obj_get_content_width(obj);
+    *h = lv_obj_get_content_height(obj);
+    if(*w <= 0 || *h <= 0) return false;
+
+    /*Crowded charts are decimated when drawn which can't be done incrementally*/
+    if((int32_t)chart->point_cnt >= *w) return false;
+
+    int32_t line_w = lv_obj_get_style_line_width(obj, LV_PART_ITEMS);
+    int32_t point_w = lv_obj_get_style_width(obj, LV_PART_INDICATOR);
+    int32_t point_h = lv_obj_get_style_height(obj, LV_PART_INDICATOR);
+    *margin = line_w + LV_MAX(point_w, point_h) / 2 + 1;
+    return true;
+}
+
+static void stream_add_value(lv_obj_t * obj, lv_chart_series_t * ser)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->point_cnt < 2) return;
+
+    int32_t w;
+    int32_t h;
+    int32_t margin;
+    bool cacheable = stream_get_geometry(obj, &w, &h, &margin);
+
+    /*All the points move left by this many pixels*/
+    uint32_t phase = ser->stream_phase;
+    int32_t dx = cacheable ? (int32_t)(((int64_t)w * (phase + 1)) / (chart->point_cnt - 1) -
+                                       ((int64_t)w * phase) / (chart->point_cnt - 1)) : 0;
+    ser->stream_phase = (phase + 1) % (chart->point_cnt - 1);
+
+    if(!cacheable || ser->hidden) {
+        stream_drop(ser);
+        return;
+    }
+
+    lv_draw_buf_t * buf = ser->stream_buf;
+    int32_t buf_w = w + 1 + 2 * margin;
+    int32_t buf_h = h + 1 + 2 * margin;
+    if(buf == NULL || buf->header.w != buf_w || buf->header.h != buf_h || dx >= buf_w) {
+        stream_rebuild(obj, ser, w, h, margin);
+        return;
+    }
+
+    LV_PROFILER_BEGIN;
+    /*Shift the ring. The columns which were on the left will be the new columns on the right.*/
+    ser->stream_ring = (ser->stream_ring + dx) % buf_w;
+
+    /*Draw again the columns touched by the new segment and the columns on the left side
+     *where the segment from the removed point still is.*/
+    int32_t x_last = get_line_x(chart, ser, w, chart->point_cnt - 2);
+    int32_t x_first = get_line_x(chart, ser, w, 0) + 2 * margin;
+    if(x_last <= x_first) {
+        stream_redraw(obj, ser, w, margin, 0, buf_w - 1);
+    }
+    else {
+        stream_redraw(obj, ser, w, margin, x_last, buf_w - 1);
+        stream_redraw(obj, ser, w, margin, 0, x_first);
+    }
+    LV_PROFILER_END;
+}
+
+static void stream_rebuild(lv_obj_t * obj, lv_chart_series_t * ser, int32_t w, int32_t h, int32_t margin)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    int32_t buf_w = w + 1 + 2 * margin;
+    int32_t buf_h = h + 1 + 2 * margin;
+    lv_draw_buf_t * buf = ser->stream_buf;
+    if(buf == NULL || buf->header.w != buf_w || buf->header.h != buf_h) {
+        stream_drop(ser);
+        buf = lv_draw_buf_create(buf_w, buf_h, LV_COLOR_FORMAT_ARGB8888, 0);
+        if(buf == NULL) {
+            LV_LOG_WARN("Couldn't allocate the stream buffer. Drawing the lines directly.");
+            return;
+        }
+        ser->stream_buf = buf;
+    }
+
+    LV_PROFILER_BEGIN;
+    lv_draw_buf_clear(buf, NULL);
+    ser->stream_ring = 0;
+    stream_render(obj, ser, 0, chart->point_cnt - 1, 0, buf_w - 1);
+    LV_PROFILER_END;
+}
+
+/**
+ * Clear some columns of a ring buffer and draw all the segments and points which touch them again
+ * @param obj       pointer to a chart
+ * @param ser       pointer to a series with a ring buffer
+ * @param w         width of the series area
+ * @param margin    space around the series area
+ * @param x1        first column to redraw (0: left side of the margin, not a column of the buffer)
+ * @param x2        last column to redraw
+ */
+static void stream_redraw(lv_obj_t * obj, lv_chart_series_t * ser, int32_t w, int32_t margin, int32_t x1,
+                          int32_t x2)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    /*A point and its segments to the right cover the columns from its x to x + 2 * margin*/
+    uint32_t first = 0;
+    while(first + 1 < chart->point_cnt && get_line_x(chart, ser, w, first + 1) + 2 * margin < x1) first++;
+    uint32_t last = chart->point_cnt - 1;
+    while(last > first && get_line_x(chart, ser, w, last - 1) > x2) last--;
+
+    stream_clear(ser, x1, x2);
+    stream_render(obj, ser, first, last, x1, x2);
+}
+
+/**
+ * Draw the segments and points of a series into its ring buffer
+ * @param obj       pointer to a chart
+ * @param ser       pointer to a series with a ring buffer
+ * @param first     index of the first point to draw (0: the oldest point)
+ * @param last      index of the last point to draw
+ * @param x1        draw only from this column (0: left side of the margin, not a column of the buffer)
+ * @param x2        draw only until this column
+ */
+static void stream_render(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t first, uint32_t last, int32_t x1,
+                          int32_t x2)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    lv_draw_buf_t * buf = ser->stream_buf;
+    int32_t buf_w = buf->header.w;
+    int32_t buf_h = buf->header.h;
+    uint32_t cnt = last - first + 1;
+
+    int32_t w;
+    int32_t h;
+    int32_t margin;
+    stream_get_geometry(obj, &w, &h, &margin);
+
+    lv_draw_line_dsc_t line_dsc;
+    lv_draw_line_dsc_init(&line_dsc);
+    lv_obj_init_draw_line_dsc(obj, LV_PART_ITEMS, &line_dsc);
+    line_dsc.color = ser->color;
+
+    lv_draw_rect_dsc_t point_dsc;
+    lv_draw_rect_dsc_init(&point_dsc);
+    lv_obj_init_draw_rect_dsc(obj, LV_PART_INDICATOR, &point_dsc);
+    point_dsc.bg_color = ser->color;
+
+    int32_t point_w = lv_obj_get_style_width(obj, LV_PART_INDICATOR) / 2;
+    int32_t point_h = lv_obj_get_style_height(obj, LV_PART_INDICATOR) / 2;
+
+    /*Same as in `draw_series_line`*/
+    if(LV_MIN(point_w, point_h) > line_dsc.width / 2) line_dsc.raw_end = 1;
+    if(line_dsc.width == 1) line_dsc.raw_end = 1;
+
+    lv_point_precise_t * points = lv_malloc(sizeof(lv_point_precise_t) * cnt);
+    LV_ASSERT_MALLOC(points);
+    if(points == NULL) return;
+
+    lv_layer_t layer;
+    lv_memzero(&layer, sizeof(layer));
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    lv_matrix_identity(&layer.matrix);
+#endif
+    layer.draw_buf = buf;
+    layer.color_format = buf->header.cf;
+    lv_area_set(&layer.buf_area, 0, 0, buf_w - 1, buf_h - 1);
+
+    /*The content starting at the ring's position is on the left, the rest is wrapped around to the right.
+     *Draw both parts with the matching offset.*/
+    int32_t ring = ser->stream_ring;
+    uint32_t part;
+    for(part = 0; part < 2; part++) {
+        int32_t x_ofs = part == 0 ? ring : ring - buf_w;
+        lv_area_t clip;
+        if(part == 0) lv_area_set(&clip, ring, 0, buf_w - 1, buf_h - 1);
+        else lv_area_set(&clip, 0, 0, ring - 1, buf_h - 1);
+
+        lv_area_t clip_x;
+        lv_area_set(&clip_x, x1 + x_ofs, 0, x2 + x_ofs, buf_h - 1);
+        if(!_lv_area_intersect(&clip, &clip, &clip_x)) continue;
+
+        layer._clip_area = clip;
+        layer.phy_clip_area = clip;
+
+        uint32_t start_point = lv_chart_get_x_start_point(obj, ser);
+        uint32_t poly_cnt = 0;
+        uint32_t i;
+        for(i = 0; i <= cnt; i++) {
+            int32_t p_act = (start_point + first + i) % chart->point_cnt;
+            if(i == cnt || ser->y_points[p_act] == LV_CHART_POINT_NONE) {
+                lv_draw_polyline(&layer, &line_dsc, points, poly_cnt);
+
+                uint32_t p;
+                for(p = 0; point_w && point_h && p < poly_cnt; p++) {
+                    lv_area_t point_area;
+                    point_area.x1 = (int32_t)points[p].x - point_w;
+                    point_area.x2 = (int32_t)points[p].x + point_w;
+                    point_area.y1 = (int32_t)points[p].y - point_h;
+                    point_area.y2 = (int32_t)points[p].y + point_h;
+                    lv_draw_rect(&layer, &point_dsc, &point_area);
+                }
+                poly_cnt = 0;
+                continue;
+            }
+
+            int32_t y = lv_map(ser->y_points[p_act], chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0, h);
+            points[poly_cnt].x = get_line_x(chart, ser, w, first + i) + margin + x_ofs;
+            points[poly_cnt].y = h - y + margin;
+            poly_cnt++;
+        }
+
+        while(layer.draw_task_head) {
+            lv_draw_dispatch_wait_for_request();
+            lv_draw_dispatch_layer(lv_obj_get_display(obj), &layer);
+        }
+    }
+
+    lv_free(points);
+
+    /*Be sure the image decoder sees the new content*/
+    lv_image_cache_drop(buf);
+}
+
+/**
+ * Clear columns of a ring buffer
+ * @param ser       pointer to a series with a ring buffer
+ * @param x1        first column to clear (0: left side of the margin, not a column of the buffer)
+ * @param x2        last column to clear
+ */
+static void stream_clear(lv_chart_series_t * ser, int32_t x1, int32_t x2)
+{
+    lv_draw_buf_t * buf = ser->stream_buf;
+    int32_t buf_w = buf->header.w;
+    uint32_t px_size = lv_color_format_get_size(buf->header.cf);
+
+    x1 = LV_MAX(x1, 0);
+    x2 = LV_MIN(x2, buf_w - 1);
+
+    int32_t x;
+    int32_t y;
+    for(x = x1; x <= x2;) {
+        int32_t x_phy = (x + ser->stream_ring) % buf_w;
+        int32_t len = LV_MIN(x2 - x + 1, buf_w - x_phy);
+        uint8_t * data = buf->data + x_phy * px_size;
+        for(y = 0; y < buf->header.h; y++) {
+            lv_memzero(data, len * px_size);
+            data += buf->header.stride;
+        }
+        x += len;
+    }
+}
+
+static bool stream_draw(lv_obj_t * obj, lv_layer_t * layer, lv_chart_series_t * ser, int32_t x_ofs, int32_t y_ofs)
+{
+    lv_draw_buf_t * buf = ser->stream_buf;
+    if(buf == NULL) return false;
+
+    int32_t w;
+    int32_t h;
+    int32_t margin;
+    if(!stream_get_geometry(obj, &w, &h, &margin)) return false;
+
+    int32_t buf_w = buf->header.w;
+    int32_t buf_h = buf->header.h;
+    if(buf_w != w + 1 + 2 * margin || buf_h != h + 1 + 2 * margin) return false;
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = buf;
+    img_dsc.base.obj = obj;
+    img_dsc.base.part = LV_PART_ITEMS;
+
+    const lv_area_t clip_area_ori = layer->_clip_area;
+    int32_t ring = ser->stream_ring;
+
+    /*Draw the image twice: the columns from the ring's position are on the left, the rest on the right*/
+    lv_area_t coords;
+    lv_area_set(&coords, x_ofs - margin - ring, y_ofs - margin, x_ofs - margin - ring + buf_w - 1,
+                y_ofs - margin + buf_h - 1);
+    lv_area_t clip;
+    lv_area_set(&clip, x_ofs - margin, coords.y1, coords.x2, coords.y2);
+    if(_lv_area_intersect(&layer->_clip_area, &clip, &clip_area_ori)) {
+        lv_draw_image(layer, &img_dsc, &coords);
+    }
+
+    if(ring > 0) {
+        lv_area_move(&coords, buf_w, 0);
+        lv_area_set(&clip, coords.x1, coords.y1, x_ofs - margin + buf_w - 1, coords.y2);
+        if(_lv_area_intersect(&layer->_clip_area, &clip, &clip_area_ori)) {
+            lv_draw_image(layer, &img_dsc, &coords);
+        }
+    }
+
+    layer->_clip_area = clip_area_ori;
+    return true;
+}
+
+static void stream_drop(lv_chart_series_t * ser)
+{
+    if(ser->stream_buf == NULL) return;
+
+    lv_image_cache_drop(ser->stream_buf);
+    lv_draw_buf_destroy(ser->stream_buf);
+    ser->stream_buf = NULL;
+}
+
+static void stream_drop_all(lv_obj_t * obj)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    lv_chart_series_t * ser;
+    _LV_LL_READ_BACK(&chart->series_ll, ser) {
+        stream_drop(ser);
+    }
+}
+
 lv_chart_tick_dsc_t * get_tick_gsc(lv_obj_t * obj, lv_chart_axis_t axis)
 {
     lv_chart_t * chart = (lv_chart_t *) obj;
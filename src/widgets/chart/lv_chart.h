@@ -52,6 +52,7 @@ typedef uint8_t lv_chart_type_t;
 enum _lv_chart_update_mode_t {
     LV_CHART_UPDATE_MODE_SHIFT,     /**< Shift old data to the left and add the new one the right*/
     LV_CHART_UPDATE_MODE_CIRCULAR,  /**< Add the new data in a circular way*/
+    LV_CHART_UPDATE_MODE_STREAM,    /**< Like shift but the drawn lines are cached and only the new segments are drawn*/
 };
 
 #ifdef DOXYGEN
@@ -85,6 +86,9 @@ typedef struct {
     int32_t * y_points;
     lv_color_t color;
     uint32_t start_point;
+    lv_draw_buf_t * stream_buf;     /**< Lines cached in a ring buffer in LV_CHART_UPDATE_MODE_STREAM*/
+    int32_t stream_ring;            /**< Column of `stream_buf` where the left side of the lines is*/
+    uint32_t stream_phase;          /**< Number of values added in stream mode modulo `point_cnt - 1`*/
     uint32_t hidden : 1;
     uint32_t x_ext_buf_assigned : 1;
     uint32_t y_ext_buf_assigned : 1;
@@ -126,7 +130,7 @@ typedef struct {
     uint32_t zoom_x;
     uint32_t zoom_y;
     lv_chart_type_t type  : 3; /**< Line or column chart*/
-    lv_chart_update_mode_t update_mode : 1;
+    lv_chart_update_mode_t update_mode : 2;
 } lv_chart_t;
 
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_chart_class;
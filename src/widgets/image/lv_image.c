@@ -20,6 +20,14 @@
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+enum {
+    DECODE_STATE_IDLE,
+    DECODE_STATE_PENDING,
+    DECODE_STATE_READY,
+};
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -29,6 +37,13 @@ static void lv_image_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_image(lv_event_t * e);
 static void scale_update(lv_obj_t * obj, int32_t scale_x, int32_t scale_y);
 static void update_align(lv_obj_t * obj);
+#if LV_USE_IMAGE_DECODER_ASYNC
+static bool decode_async_is_ready(lv_obj_t * obj);
+static void decode_async_ready_cb(const void * src, lv_result_t res, void * user_data);
+static void decode_async_reset(lv_obj_t * obj);
+static void draw_placeholder(lv_obj_t * obj, lv_layer_t * layer, lv_draw_image_dsc_t * draw_dsc,
+                             const lv_area_t * img_area);
+#endif
 
 #if LV_USE_OBJ_PROPERTY
 static const lv_property_ops_t properties[] = {
@@ -136,6 +151,10 @@ void lv_image_set_src(lv_obj_t * obj, const void * src)
 
     lv_obj_invalidate(obj);
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+    decode_async_reset(obj);
+#endif
+
     lv_image_src_t src_type = lv_image_src_get_type(src);
     lv_image_t * img = (lv_image_t *)obj;
 
@@ -166,8 +185,13 @@ void lv_image_set_src(lv_obj_t * obj, const void * src)
         return;
     }
 
+    lv_image_decoder_args_t args;
+    lv_memzero(&args, sizeof(args));
+    args.target_w = img->decode_w;
+    args.target_h = img->decode_h;
+
     lv_image_header_t header;
-    lv_result_t res = lv_image_decoder_get_info(src, &header);
+    lv_result_t res = lv_image_decoder_get_info_with_args(src, &args, &header);
     if(res != LV_RESULT_OK) {
 #if LV_USE_LOG
         char buf[24];
@@ -434,6 +458,42 @@ void lv_image_set_bitmap_map_src(lv_obj_t * obj, const lv_image_dsc_t * src)
     lv_obj_invalidate(obj);
 }
 
+void lv_image_set_decode_size(lv_obj_t * obj, int32_t w, int32_t h)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_image_t * img = (lv_image_t *)obj;
+    if(img->decode_w == w && img->decode_h == h) return;
+
+    img->decode_w = w;
+    img->decode_h = h;
+
+    /*Update the size of the image*/
+    if(img->src_type == LV_IMAGE_SRC_FILE || img->src_type == LV_IMAGE_SRC_VARIABLE) {
+        lv_image_set_src(obj, img->src);
+    }
+}
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+void lv_image_set_decode_async(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_image_t * img = (lv_image_t *)obj;
+    if(img->decode_async == en) return;
+
+    decode_async_reset(obj);
+    img->decode_async = en;
+    lv_obj_invalidate(obj);
+}
+
+void lv_image_set_placeholder(lv_obj_t * obj, const void * src)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_image_t * img = (lv_image_t *)obj;
+    img->placeholder_src = src;
+    if(img->decode_state == DECODE_STATE_PENDING) lv_obj_invalidate(obj);
+}
+#endif
+
 /*=====================
  * Getter functions
  *====================*/
@@ -547,6 +607,91 @@ const lv_image_dsc_t * lv_image_get_bitmap_map_src(lv_obj_t * obj)
     return img->bitmap_mask_src;
 }
 
+int32_t lv_image_get_decode_width(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_image_t * img = (lv_image_t *)obj;
+
+    return img->decode_w;
+}
+
+int32_t lv_image_get_decode_height(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_image_t * img = (lv_image_t *)obj;
+
+    return img->decode_h;
+}
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+bool lv_image_get_decode_async(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_image_t * img = (lv_image_t *)obj;
+
+    return img->decode_async;
+}
+
+const void * lv_image_get_placeholder(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_image_t * img = (lv_image_t *)obj;
+
+    return img->placeholder_src;
+}
+#endif
+
+/*=====================
+ * Other functions
+ *====================*/
+
+void lv_image_invalidate_src_area(lv_obj_t * obj, const lv_area_t * area)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(area);
+
+    lv_image_t * img = (lv_image_t *)obj;
+
+    /*The area would be repeated on every tile*/
+    if(img->align == LV_IMAGE_ALIGN_TILE) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    /*Find the position of the source as `draw_image` does*/
+    lv_area_t img_area = {obj->coords.x1, obj->coords.y1,
+                          obj->coords.x1 + img->w - 1, obj->coords.y1 + img->h - 1
+                         };
+    if(img->align < _LV_IMAGE_ALIGN_AUTO_TRANSFORM) {
+        lv_area_align(&obj->coords, &img_area, img->align, img->offset.x, img->offset.y);
+    }
+
+    lv_area_t a = *area;
+    if(img->rotation != 0 || img->scale_x != LV_SCALE_NONE || img->scale_y != LV_SCALE_NONE) {
+        /*Transform the corners, with 1 px margin as the neighbor pixels are also sampled*/
+        lv_point_t p[4] = {
+            {a.x1 - 1, a.y1 - 1},
+            {a.x2 + 2, a.y1 - 1},
+            {a.x1 - 1, a.y2 + 2},
+            {a.x2 + 2, a.y2 + 2},
+        };
+        lv_point_t pivot;
+        lv_image_get_pivot(obj, &pivot);
+        lv_point_array_transform(p, 4, img->rotation, img->scale_x, img->scale_y, &pivot, true);
+        a.x1 = LV_MIN4(p[0].x, p[1].x, p[2].x, p[3].x);
+        a.x2 = LV_MAX4(p[0].x, p[1].x, p[2].x, p[3].x);
+        a.y1 = LV_MIN4(p[0].y, p[1].y, p[2].y, p[3].y);
+        a.y2 = LV_MAX4(p[0].y, p[1].y, p[2].y, p[3].y);
+    }
+
+    lv_area_move(&a, img_area.x1, img_area.y1);
+    lv_obj_invalidate_area(obj, &a);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -581,6 +726,9 @@ static void lv_image_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 {
     LV_UNUSED(class_p);
     lv_image_t * img = (lv_image_t *)obj;
+#if LV_USE_IMAGE_DECODER_ASYNC
+    decode_async_reset(obj);
+#endif
     if(img->src_type == LV_IMAGE_SRC_FILE || img->src_type == LV_IMAGE_SRC_SYMBOL) {
         lv_free((void *)img->src);
         img->src      = NULL;
@@ -744,6 +892,8 @@ static void draw_image(lv_event_t * e)
             draw_dsc.blend_mode = img->blend_mode;
             draw_dsc.bitmap_mask_src = img->bitmap_mask_src;
             draw_dsc.src = img->src;
+            draw_dsc.target_w = img->decode_w;
+            draw_dsc.target_h = img->decode_h;
 
             lv_area_t img_area = {obj->coords.x1, obj->coords.y1,
                                   obj->coords.x1 + img->w - 1, obj->coords.y1 + img->h - 1
@@ -764,7 +914,11 @@ static void draw_image(lv_event_t * e)
                 draw_dsc.tile = 1;
             }
 
-            lv_draw_image(layer, &draw_dsc, &img_area);
+#if LV_USE_IMAGE_DECODER_ASYNC
+            if(!decode_async_is_ready(obj)) draw_placeholder(obj, layer, &draw_dsc, &img_area);
+            else
+#endif
+                lv_draw_image(layer, &draw_dsc, &img_area);
             layer->_clip_area = clip_area_ori;
 
         }
@@ -838,4 +992,87 @@ static void update_align(lv_obj_t * obj)
 
     }
 }
+#if LV_USE_IMAGE_DECODER_ASYNC
+/**
+ * Check if the image can be drawn and start decoding it in the background if not.
+ * @param obj   pointer to an image object
+ * @return      true: draw the image normally; false: it's being decoded, draw the placeholder
+ */
+static bool decode_async_is_ready(lv_obj_t * obj)
+{
+    lv_image_t * img = (lv_image_t *)obj;
+    if(!img->decode_async || img->src_type != LV_IMAGE_SRC_FILE) return true;
+
+    /*Once it was decoded draw it as usual. If it didn't fit into the cache
+     *decoding it again in the background would just lead to an endless loop.*/
+    if(img->decode_state == DECODE_STATE_READY) return true;
+    if(img->decode_state == DECODE_STATE_PENDING) return false;
+
+    if(lv_image_cache_is_cached(img->src)) return true;
+
+    lv_image_decoder_args_t args = {
+        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
+        .target_w = img->decode_w,
+        .target_h = img->decode_h,
+    };
+
+    /*If it can't be decoded in the background decode it while drawing*/
+    if(lv_image_decoder_decode_async(img->src, &args, decode_async_ready_cb, obj) != LV_RESULT_OK) return true;
+
+    img->decode_state = DECODE_STATE_PENDING;
+    return false;
+}
+
+static void decode_async_ready_cb(const void * src, lv_result_t res, void * user_data)
+{
+    LV_UNUSED(src);
+    LV_UNUSED(res);
+
+    lv_obj_t * obj = user_data;
+    lv_image_t * img = (lv_image_t *)obj;
+    img->decode_state = DECODE_STATE_READY;
+    lv_obj_invalidate(obj);
+}
+
+static void decode_async_reset(lv_obj_t * obj)
+{
+    lv_image_t * img = (lv_image_t *)obj;
+    if(img->decode_state == DECODE_STATE_PENDING) {
+        lv_image_decoder_cancel_async(decode_async_ready_cb, obj);
+    }
+    img->decode_state = DECODE_STATE_IDLE;
+}
+
+static void draw_placeholder(lv_obj_t * obj, lv_layer_t * layer, lv_draw_image_dsc_t * draw_dsc,
+                             const lv_area_t * img_area)
+{
+    lv_image_t * img = (lv_image_t *)obj;
+    if(img->placeholder_src == NULL || draw_dsc->tile) return;
+
+    lv_image_header_t header;
+    if(lv_image_decoder_get_info(img->placeholder_src, &header) != LV_RESULT_OK) return;
+    if(header.w == 0 || header.h == 0) return;
+    if(img->w == 0 || img->h == 0) return;
+
+    /*Stretch the placeholder to the image's size. Move the pivot accordingly
+     *and shift the area to keep the pivot at the same place on the screen.*/
+    lv_point_t pivot = draw_dsc->pivot;
+    draw_dsc->pivot.x = pivot.x * header.w / img->w;
+    draw_dsc->pivot.y = pivot.y * header.h / img->h;
+    draw_dsc->scale_x = (int32_t)(((int64_t)draw_dsc->scale_x * img->w) / header.w);
+    draw_dsc->scale_y = (int32_t)(((int64_t)draw_dsc->scale_y * img->h) / header.h);
+    draw_dsc->src = img->placeholder_src;
+    draw_dsc->target_w = 0;
+    draw_dsc->target_h = 0;
+
+    lv_area_t area;
+    area.x1 = img_area->x1 + pivot.x - draw_dsc->pivot.x;
+    area.y1 = img_area->y1 + pivot.y - draw_dsc->pivot.y;
+    area.x2 = area.x1 + header.w - 1;
+    area.y2 = area.y1 + header.h - 1;
+
+    lv_draw_image(layer, draw_dsc, &area);
+}
+#endif
+
 #endif
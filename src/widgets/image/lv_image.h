@@ -48,11 +48,18 @@ typedef struct {
     uint32_t scale_x;      /**< 256 means no zoom, 512 double size, 128 half size*/
     uint32_t scale_y;      /**< 256 means no zoom, 512 double size, 128 half size*/
     lv_point_t pivot;     /**< Rotation center of the image*/
+    int32_t decode_w;     /**< Decode the image with a lower resolution to about this width. 0: full size*/
+    int32_t decode_h;     /**< Decode the image with a lower resolution to about this height. 0: full size*/
     uint32_t src_type : 2;  /**< See: lv_image_src_t*/
     uint32_t cf : 5;        /**< Color format from `lv_color_format_t`*/
     uint32_t antialias : 1; /**< Apply anti-aliasing in transformations (rotate, zoom)*/
     uint32_t align: 4;   /**< Image size mode when image size and object size is different. See `lv_image_align_t`*/
     uint32_t blend_mode: 4;   /**< Element of `lv_blend_mode_t`*/
+#if LV_USE_IMAGE_DECODER_ASYNC
+    uint32_t decode_async: 1;   /**< Decode the image in the background if it's not cached*/
+    uint32_t decode_state: 2;   /**< State of the background decoding (internal)*/
+    const void * placeholder_src;   /**< Drawn while the image is decoded in the background*/
+#endif
 } lv_image_t;
 
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_image_class;
@@ -247,6 +254,37 @@ void lv_image_set_inner_align(lv_obj_t * obj, lv_image_align_t align);
  */
 void lv_image_set_bitmap_map_src(lv_obj_t * obj, const lv_image_dsc_t * src);
 
+/**
+ * Decode the image with a lower resolution if it's shown smaller than its original size (e.g. a photo as a thumbnail).
+ * Only the scalable decoders (e.g. libjpeg-turbo) reduce the resolution, the others decode the full image.
+ * The size of the image object is updated to the reduced size, and the images decoded with different sizes
+ * are cached separately.
+ * @param obj       pointer to an image object
+ * @param w         the width the image is shown with. 0: decode the image with full resolution.
+ * @param h         the height the image is shown with. 0: decode the image with full resolution.
+ */
+void lv_image_set_decode_size(lv_obj_t * obj, int32_t w, int32_t h);
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+/**
+ * Decode the image in the background if it's not in the image cache yet, instead of blocking the rendering.
+ * Until it's ready the placeholder is drawn, and the image is redrawn when it's decoded.
+ * Only image files are affected.
+ * @param obj       pointer to an image object
+ * @param en        true: enable background decoding
+ */
+void lv_image_set_decode_async(lv_obj_t * obj, bool en);
+
+/**
+ * Set an image to draw while the image is decoded in the background.
+ * It's stretched to the size of the image so a small, low resolution version of the image can be used.
+ * @param obj       pointer to an image object
+ * @param src       an image source which is fast to draw, typically an `lv_image_dsc_t`.
+ *                  It's not copied so it needs to be valid while the image object exists. NULL to draw nothing.
+ */
+void lv_image_set_placeholder(lv_obj_t * obj, const void * src);
+#endif
+
 /*=====================
  * Getter functions
  *====================*/
@@ -338,6 +376,49 @@ lv_image_align_t lv_image_get_inner_align(lv_obj_t * obj);
  */
 const lv_image_dsc_t * lv_image_get_bitmap_map_src(lv_obj_t * obj);
 
+/**
+ * Get the width the image is decoded for
+ * @param obj       pointer to an image object
+ * @return          the width set by `lv_image_set_decode_size` or 0 for full resolution
+ */
+int32_t lv_image_get_decode_width(lv_obj_t * obj);
+
+/**
+ * Get the height the image is decoded for
+ * @param obj       pointer to an image object
+ * @return          the height set by `lv_image_set_decode_size` or 0 for full resolution
+ */
+int32_t lv_image_get_decode_height(lv_obj_t * obj);
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+/**
+ * Get whether the image is decoded in the background
+ * @param obj       pointer to an image object
+ * @return          true: background decoding is enabled
+ */
+bool lv_image_get_decode_async(lv_obj_t * obj);
+
+/**
+ * Get the placeholder image
+ * @param obj       pointer to an image object
+ * @return          the placeholder's source or NULL if not set
+ */
+const void * lv_image_get_placeholder(lv_obj_t * obj);
+#endif
+
+/*=====================
+ * Other functions
+ *====================*/
+
+/**
+ * Redraw only a part of the image, e.g. after the pixels of the source were changed directly.
+ * The area is mapped to the screen the same way as the image is drawn, so offset,
+ * alignment, scale and rotation are considered.
+ * @param obj       pointer to an image object
+ * @param area      the changed area relative to the image source
+ */
+void lv_image_invalidate_src_area(lv_obj_t * obj, const lv_area_t * area);
+
 /**********************
  *      MACROS
  **********************/
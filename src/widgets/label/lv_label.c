@@ -18,6 +18,8 @@
 #include "../../misc/lv_bidi.h"
 #include "../../misc/lv_text_ap.h"
 #include "../../misc/lv_text_private.h"
+#include "../../misc/lv_text_line_process.h"
+#include "../../misc/lv_iter.h"
 #include "../../stdlib/lv_sprintf.h"
 #include "../../stdlib/lv_string.h"
 
@@ -56,6 +58,13 @@ static void copy_text_to_label(lv_label_t * label, const char * text);
 static lv_text_flag_t get_label_flags(lv_label_t * label);
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt,
                                    uint32_t length, const lv_font_t * font, int32_t letter_space, lv_area_t * txt_coords);
+static void text_edited(lv_obj_t * obj, uint32_t pos, uint32_t del_len, uint32_t ins_len);
+static uint32_t lines_update(lv_label_t * label, uint32_t pos, uint32_t del_len, uint32_t ins_len);
+static void lines_break(lv_label_t * label, uint32_t first, uint32_t pos, uint32_t del_len, uint32_t ins_len);
+static void lines_get_size(lv_label_t * label, lv_point_t * size_res, const lv_font_t * font, int32_t letter_space,
+                           int32_t line_space, int32_t max_w);
+static void lines_invalidate(lv_label_t * label);
+static void lines_free(lv_label_t * label);
 
 /**********************
  *  STATIC VARIABLES
@@ -108,6 +117,7 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
         label->text = lv_realloc(label->text, text_len);
         LV_ASSERT_MALLOC(label->text);
         if(label->text == NULL) return;
+        label->text_size = text_len;
 
 #if LV_USE_ARABIC_PERSIAN_CHARS
         _lv_text_ap_proc(label->text, label->text);
@@ -124,6 +134,7 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
         label->text = lv_malloc(text_len);
         LV_ASSERT_MALLOC(label->text);
         if(label->text == NULL) return;
+        label->text_size = text_len;
 
         copy_text_to_label(label, text);
 
@@ -131,6 +142,7 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
         label->static_txt = 0;
     }
 
+    lines_invalidate(label);
     lv_label_refr_text(obj);
 }
 
@@ -158,7 +170,9 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
     label->text = lv_text_set_text_vfmt(fmt, args);
     va_end(args);
     label->static_txt = 0; /*Now the text is dynamically allocated*/
+    label->text_size = 0;
 
+    lines_invalidate(label);
     lv_label_refr_text(obj);
 }
 
@@ -175,8 +189,10 @@ void lv_label_set_text_static(lv_obj_t * obj, const char * text)
     if(text != NULL) {
         label->static_txt = 1;
         label->text       = (char *)text;
+        label->text_size  = 0;
     }
 
+    lines_invalidate(label);
     lv_label_refr_text(obj);
 }
 
@@ -202,6 +218,7 @@ void lv_label_set_long_mode(lv_obj_t * obj, lv_label_long_mode_t long_mode)
     }
 
     label->long_mode = long_mode;
+    lines_invalidate(label);
     lv_label_refr_text(obj);
 }
 
@@ -397,20 +414,21 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in, bool
         line_start = new_line_start;
     }
 
-    char * bidi_txt;
+    const char * bidi_txt;
 
 #if LV_USE_BIDI
-    uint32_t txt_len;
+    const lv_bidi_paragraph_t * bidi_par = NULL;
     if(bidi) {
-        bidi_txt = lv_malloc(new_line_start - line_start + 1);
-        txt_len = new_line_start - line_start;
+        uint32_t txt_len = new_line_start - line_start;
         if(new_line_start > 0 && txt[new_line_start - 1] == '\0' && txt_len > 0) txt_len--;
-        _lv_bidi_process_paragraph(txt + line_start, bidi_txt, txt_len, lv_obj_get_style_base_dir(obj, LV_PART_MAIN), NULL, 0);
+        bidi_par = _lv_bidi_paragraph_acquire(txt + line_start, txt_len, lv_obj_get_style_base_dir(obj, LV_PART_MAIN));
+        LV_ASSERT_MALLOC(bidi_par);
+        bidi_txt = bidi_par->visual_txt;
     }
     else
 #endif
     {
-        bidi_txt = (char *)txt + line_start;
+        bidi_txt = txt + line_start;
     }
 
     /*Calculate the x coordinate*/
@@ -453,11 +471,10 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in, bool
         }
         else {
             bool is_rtl;
-            logical_pos = _lv_bidi_get_logical_pos(&txt[line_start], NULL,
-                                                   txt_len, lv_obj_get_style_base_dir(obj, LV_PART_MAIN), cid, &is_rtl);
+            logical_pos = _lv_bidi_paragraph_get_logical_pos(bidi_par, cid, &is_rtl);
             if(is_rtl) logical_pos++;
         }
-        lv_free(bidi_txt);
+        _lv_bidi_paragraph_release(bidi_par);
     }
     else
 #endif
@@ -580,20 +597,26 @@ void lv_label_ins_text(lv_obj_t * obj, uint32_t pos, const char * txt)
 
     lv_obj_invalidate(obj);
 
-    /*Allocate space for the new text*/
+    /*Allocate space for the new text. Allocate some more to not reallocate the text
+     *every time a character is added*/
     size_t old_len = lv_strlen(label->text);
     size_t ins_len = lv_strlen(txt);
     size_t new_len = ins_len + old_len;
-    label->text        = lv_realloc(label->text, new_len + 1);
-    LV_ASSERT_MALLOC(label->text);
-    if(label->text == NULL) return;
+    if(label->text_size < new_len + 1) {
+        size_t new_size = new_len + 1 + (new_len + 1) / 2;
+        label->text        = lv_realloc(label->text, new_size);
+        LV_ASSERT_MALLOC(label->text);
+        if(label->text == NULL) return;
+        label->text_size = new_size;
+    }
 
     if(pos == LV_LABEL_POS_LAST) {
         pos = lv_text_get_encoded_length(label->text);
     }
 
+    uint32_t byte_pos = lv_text_encoded_get_byte_id(label->text, pos);
     lv_text_ins(label->text, pos, txt);
-    lv_label_set_text(obj, NULL);
+    text_edited(obj, byte_pos, 0, ins_len);
 }
 
 void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
@@ -607,11 +630,15 @@ void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
     lv_obj_invalidate(obj);
 
     char * label_txt = lv_label_get_text(obj);
+    uint32_t byte_pos = lv_text_encoded_get_byte_id(label_txt, pos);
+    uint32_t byte_cnt = lv_text_encoded_get_byte_id(&label_txt[byte_pos], cnt);
+    if(byte_pos + byte_cnt > lv_strlen(label_txt)) byte_cnt = 0; /*Nothing is deleted in this case*/
+
     /*Delete the characters*/
     lv_text_cut(label_txt, pos, cnt);
 
     /*Refresh the label*/
-    lv_label_refr_text(obj);
+    text_edited(obj, byte_pos, byte_cnt, 0);
 }
 
 /**********************
@@ -626,6 +653,8 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_t * label = (lv_label_t *)obj;
 
     label->text       = NULL;
+    label->text_size  = 0;
+    label->lines      = NULL;
     label->static_txt = 0;
     label->dot_end    = LV_LABEL_DOT_END_INV;
     label->long_mode  = LV_LABEL_LONG_WRAP;
@@ -657,6 +686,7 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_t * label = (lv_label_t *)obj;
 
     lv_label_dot_tmp_free(obj);
+    lines_free(label);
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
 }
@@ -701,7 +731,14 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
 
             w = LV_MIN(w, lv_obj_get_style_max_width(obj, 0));
 
-            lv_text_get_size(&label->size_cache, label->text, font, letter_space, line_space, w, flag);
+            /*Use the line breaks of the edited texts to avoid processing the whole text again*/
+            if(label->lines && label->long_mode != LV_LABEL_LONG_DOT) {
+                if(label->expand != 0 || w <= 0) w = LV_COORD_MAX;
+                lines_get_size(label, &label->size_cache, font, letter_space, line_space, w);
+            }
+            else {
+                lv_text_get_size(&label->size_cache, label->text, font, letter_space, line_space, w, flag);
+            }
             label->invalid_size_cache = false;
         }
 
@@ -854,11 +891,14 @@ static void lv_label_refr_text(lv_obj_t * obj)
     int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
     int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
 
-    /*Calc. the height and longest line*/
-    lv_point_t size;
+    /*Calc. the height and longest line. Only the scrolling and dots need it.*/
+    lv_point_t size = {0, 0};
     lv_text_flag_t flag = get_label_flags(label);
 
-    lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    if(label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR ||
+       label->long_mode == LV_LABEL_LONG_DOT) {
+        lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    }
 
     lv_obj_refresh_self_size(obj);
 
@@ -1275,4 +1315,295 @@ static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, con
     }
 }
 
+/**
+ * Refresh the label after `del_len` bytes of its text were replaced by `ins_len` bytes at `pos`
+ * @param obj       pointer to a label object
+ * @param pos       byte index of the edit
+ * @param del_len   number of deleted bytes
+ * @param ins_len   number of inserted bytes
+ */
+static void text_edited(lv_obj_t * obj, uint32_t pos, uint32_t del_len, uint32_t ins_len)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+#if LV_USE_ARABIC_PERSIAN_CHARS
+    /*The Arabic and Persian letters take their form from their neighbors, so process
+     *the whole text again if such letters were added. (U+0600..U+06FF start with 0xD8..0xDB)*/
+    uint32_t i;
+    for(i = pos; i < pos + ins_len; i++) {
+        uint8_t c = (uint8_t)label->text[i];
+        if(c >= 0xD8 && c <= 0xDB) {
+            lv_label_set_text(obj, NULL);
+            return;
+        }
+    }
+#endif
+
+    /*Start to track the line breaks of edited texts. They are broken when the size is required.*/
+    if(label->lines == NULL && label->long_mode != LV_LABEL_LONG_DOT) {
+        label->lines = lv_malloc_zeroed(sizeof(lv_label_lines_t));
+        LV_ASSERT_MALLOC(label->lines);
+    }
+
+    uint32_t unchanged_end = lines_update(label, pos, del_len, ins_len);
+
+#if LV_LABEL_LONG_TXT_HINT
+    lv_draw_label_hint_t hint = label->hint;
+#endif
+
+    lv_label_refr_text(obj);
+
+#if LV_LABEL_LONG_TXT_HINT
+    /*The lines before the edited ones haven't changed so the hint is still valid
+     *if the lines are drawn with the same width*/
+    if(hint.line_start >= 0 && (uint32_t)hint.line_start < unchanged_end &&
+       label->expand == 0 && label->lines->max_w == lv_obj_get_content_width(obj)) {
+        label->hint = hint;
+    }
+#else
+    LV_UNUSED(unchanged_end);
+#endif
+}
+
+static bool lines_is_paragraph_start(const char * text, uint32_t byte_id)
+{
+    return byte_id == 0 || text[byte_id - 1] == '\n' || text[byte_id - 1] == '\r';
+}
+
+static bool lines_is_word_start(const char * text, uint32_t byte_id)
+{
+    char c = text[byte_id - 1];
+    return c == ' ' || c == '\t' || lv_text_is_break_char((uint8_t)c);
+}
+
+/**
+ * Update the line breaks after `del_len` bytes were replaced by `ins_len` bytes at `pos`.
+ * The text is broken again from a little before the edited line until the line breaks
+ * are the same as before.
+ * @param label     pointer to a label
+ * @param pos       byte index of the edit
+ * @param del_len   number of deleted bytes
+ * @param ins_len   number of inserted bytes
+ * @return          the lines are the same as before until this byte index
+ */
+static uint32_t lines_update(lv_label_t * label, uint32_t pos, uint32_t del_len, uint32_t ins_len)
+{
+    lv_label_lines_t * lines = label->lines;
+    if(lines == NULL || lines->font == NULL) return 0;
+
+    /*The dots modify the text so don't track it*/
+    if(label->long_mode == LV_LABEL_LONG_DOT) {
+        lines_invalidate(label);
+        return 0;
+    }
+
+    uint32_t first = 0;
+    if(lines->cnt > 0) {
+        /*Find the line of the edit*/
+        uint32_t min = 0;
+        uint32_t max = lines->cnt - 1;
+        while(min < max) {
+            uint32_t mid = (min + max + 1) / 2;
+            if(lines->start[mid] <= pos) min = mid;
+            else max = mid - 1;
+        }
+        first = min;
+
+        /*A changed word might fit to the end of the previous line and a line's end depends on
+         *the first words of the next line too. So start two lines earlier and also go back
+         *until the lines are broken between words. The paragraphs are always independent.*/
+        const char * text = label->text;
+        uint32_t i;
+        for(i = 0; i < 2 && !lines_is_paragraph_start(text, lines->start[first]); i++) first--;
+
+        while(!lines_is_paragraph_start(text, lines->start[first]) &&
+              (!lines_is_word_start(text, lines->start[first]) || !lines_is_word_start(text, lines->start[first + 1]))) {
+            first--;
+        }
+    }
+
+    uint32_t unchanged_end = lines->start[first];
+    lines_break(label, first, pos, del_len, ins_len);
+    return unchanged_end;
+}
+
+/**
+ * Break the text to lines from the `first` line. After the edited text stop if a line
+ * starts where a line started before the edit, because from there all the lines are the same.
+ * @param label     pointer to a label
+ * @param first     index of the first line to break again
+ * @param pos       byte index of the edit
+ * @param del_len   number of deleted bytes
+ * @param ins_len   number of inserted bytes
+ */
+static void lines_break(lv_label_t * label, uint32_t first, uint32_t pos, uint32_t del_len, uint32_t ins_len)
+{
+    lv_label_lines_t * lines = label->lines;
+    const char * text = label->text;
+    const uint32_t restart = lines->cnt > 0 ? lines->start[first] : 0;
+
+    lv_iter_t * line_iter = lv_text_line_process_iter_create(&text[restart], lines->font, lines->max_w,
+                                                             lines->letter_space, 0, true);
+    if(line_iter == NULL) {
+        lines_invalidate(label);
+        return;
+    }
+
+    /*Collect the new lines until they are the same as the old ones*/
+    uint32_t * new_start = NULL;
+    int32_t * new_width = NULL;
+    uint32_t new_cnt = 0;
+    uint32_t new_size = 0;
+    uint32_t old_line = first;
+    uint32_t end = restart;
+    bool same = false;
+
+    lv_text_line_process_line_info_t line_info;
+    while(lv_iter_next(line_iter, &line_info) == LV_RESULT_OK) {
+        uint32_t line_start = restart + line_info.pos.start;
+        if(line_start >= pos + ins_len) {
+            uint32_t old_start = line_start - ins_len + del_len;
+            while(old_line < lines->cnt && lines->start[old_line] < old_start) old_line++;
+            if(old_line < lines->cnt && lines->start[old_line] == old_start) {
+                same = true;
+                break;
+            }
+        }
+
+        if(new_cnt == new_size) {
+            new_size = new_size == 0 ? 8 : new_size * 2;
+            uint32_t * start_tmp = lv_realloc(new_start, new_size * sizeof(uint32_t));
+            if(start_tmp) new_start = start_tmp;
+            int32_t * width_tmp = lv_realloc(new_width, new_size * sizeof(int32_t));
+            if(width_tmp) new_width = width_tmp;
+            if(start_tmp == NULL || width_tmp == NULL) {
+                LV_LOG_WARN("Couldn't allocate the line breaks");
+                lv_free(new_start);
+                lv_free(new_width);
+                lv_text_line_process_iter_destroy(line_iter);
+                lines_invalidate(label);
+                return;
+            }
+        }
+
+        new_start[new_cnt] = line_start;
+        new_width[new_cnt] = lv_text_get_width(&text[line_start], line_info.pos.brk - line_info.pos.start,
+                                               lines->font, lines->letter_space);
+        new_cnt++;
+        end = restart + line_info.pos.brk;
+    }
+    lv_text_line_process_iter_destroy(line_iter);
+
+    /*Keep the lines after the new ones*/
+    uint32_t tail_cnt = 0;
+    if(same) {
+        tail_cnt = lines->cnt - old_line;
+        end = lines->start[lines->cnt] + ins_len - del_len;
+    }
+
+    uint32_t cnt = first + new_cnt + tail_cnt;
+    if(cnt > lines->size || lines->start == NULL) {
+        uint32_t size = cnt + cnt / 2;
+        uint32_t * start_tmp = lv_realloc(lines->start, (size + 1) * sizeof(uint32_t));
+        if(start_tmp) lines->start = start_tmp;
+        int32_t * width_tmp = lv_realloc(lines->width, (size + 1) * sizeof(int32_t));
+        if(width_tmp) lines->width = width_tmp;
+        if(start_tmp == NULL || width_tmp == NULL) {
+            LV_LOG_WARN("Couldn't allocate the line breaks");
+            lv_free(new_start);
+            lv_free(new_width);
+            lines_invalidate(label);
+            return;
+        }
+        lines->size = size;
+    }
+
+    if(tail_cnt > 0) {
+        lv_memmove(&lines->start[first + new_cnt], &lines->start[old_line], tail_cnt * sizeof(uint32_t));
+        lv_memmove(&lines->width[first + new_cnt], &lines->width[old_line], tail_cnt * sizeof(int32_t));
+        uint32_t i;
+        for(i = first + new_cnt; i < cnt; i++) {
+            lines->start[i] = lines->start[i] + ins_len - del_len;
+        }
+    }
+
+    if(new_cnt > 0) {
+        lv_memcpy(&lines->start[first], new_start, new_cnt * sizeof(uint32_t));
+        lv_memcpy(&lines->width[first], new_width, new_cnt * sizeof(int32_t));
+    }
+
+    lines->start[cnt] = end;
+    lines->cnt = cnt;
+
+    lv_free(new_start);
+    lv_free(new_width);
+}
+
+/**
+ * Get the size of the text from its line breaks the same way as `lv_text_get_size()`.
+ * Break the text again if the lines were broken with other parameters.
+ * @param label         pointer to a label
+ * @param size_res      store the size here
+ * @param font          font of the text
+ * @param letter_space  letter space of the text
+ * @param line_space    line space of the text
+ * @param max_w         max. width of the lines
+ */
+static void lines_get_size(lv_label_t * label, lv_point_t * size_res, const lv_font_t * font, int32_t letter_space,
+                           int32_t line_space, int32_t max_w)
+{
+    lv_label_lines_t * lines = label->lines;
+
+    if(font != NULL && label->text != NULL &&
+       (lines->font != font || lines->max_w != max_w || lines->letter_space != letter_space)) {
+        lines->font = font;
+        lines->max_w = max_w;
+        lines->letter_space = letter_space;
+        lines->cnt = 0;
+        lines_break(label, 0, 0, 0, 0);
+    }
+
+    if(lines->font == NULL || font == NULL || label->text == NULL) {
+        lv_text_get_size(size_res, label->text, font, letter_space, line_space, max_w, LV_TEXT_FLAG_NONE);
+        return;
+    }
+
+    const int32_t letter_height = lv_font_get_line_height(font);
+    int64_t h = (int64_t)lines->cnt * (letter_height + line_space);
+
+    /*Make the text one line taller if the last character is '\n' or '\r'*/
+    const uint32_t end = lines->start[lines->cnt];
+    if(end != 0 && (label->text[end - 1] == '\n' || label->text[end - 1] == '\r')) {
+        h += letter_height + line_space;
+    }
+
+    /*Correction with the last line space or set the height manually if the text is empty*/
+    if(h == 0) h = letter_height;
+    else h -= line_space;
+
+    int32_t w = 0;
+    uint32_t i;
+    for(i = 0; i < lines->cnt; i++) {
+        w = LV_MAX(w, lines->width[i]);
+    }
+
+    size_res->x = w;
+    size_res->y = (int32_t)LV_MIN(h, (int64_t)INT32_MAX);
+}
+
+static void lines_invalidate(lv_label_t * label)
+{
+    if(label->lines) label->lines->font = NULL;
+}
+
+static void lines_free(lv_label_t * label)
+{
+    if(label->lines == NULL) return;
+
+    lv_free(label->lines->start);
+    lv_free(label->lines->width);
+    lv_free(label->lines);
+    label->lines = NULL;
+}
+
 #endif
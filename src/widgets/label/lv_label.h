@@ -59,9 +59,23 @@ typedef _lv_label_long_mode_t lv_label_long_mode_t;
 typedef uint8_t lv_label_long_mode_t;
 #endif /*DOXYGEN*/
 
+/** Line breaks of a label's text. Kept up to date while the text is edited with
+ *  `lv_label_ins_text()` and `lv_label_cut_text()`*/
+typedef struct {
+    uint32_t * start;       /*Byte index of the first character of the lines. `start[cnt]` is the end of the last line*/
+    int32_t * width;        /*Width of the lines*/
+    uint32_t cnt;           /*Number of lines*/
+    uint32_t size;          /*Number of allocated lines*/
+    const lv_font_t * font; /*The lines were broken with these parameters. NULL: the lines are invalid*/
+    int32_t max_w;
+    int32_t letter_space;
+} lv_label_lines_t;
+
 typedef struct {
     lv_obj_t obj;
     char * text;
+    uint32_t text_size; /*Allocated size of `text` or 0 if unknown*/
+    lv_label_lines_t * lines; /*Only allocated if the text is edited*/
     union {
         char * tmp_ptr; /*Pointer to the allocated memory containing the character replaced by dots*/
         char tmp[LV_LABEL_DOT_NUM + 1]; /*Directly store the characters if <=4 characters*/
@@ -35,6 +35,14 @@ typedef struct {
     int32_t letter_space;
 } lv_snippet_t;
 
+typedef struct {
+    uint32_t first_snippet;     /* index of the first snippet in `layout_snippets` */
+    uint32_t snippet_cnt;
+    int32_t height;             /* the max line height of the snippets */
+    int32_t base_line;          /* the baseline of the highest snippet */
+    int32_t width;              /* the sum of the snippets' width */
+} lv_span_line_t;
+
 struct _snippet_stack {
     lv_snippet_t    stack[LV_SPAN_SNIPPET_STACK_SIZE];
     uint32_t        index;
@@ -72,6 +80,9 @@ static uint32_t lv_get_snippet_count(void);
 static void lv_snippet_push(lv_snippet_t * item);
 static lv_snippet_t * lv_get_snippet(uint32_t index);
 static int32_t convert_indent_pct(lv_obj_t * spans, int32_t width);
+static void layout_update(lv_obj_t * obj, int32_t width);
+static void layout_invalidate(lv_obj_t * obj);
+static void array_push_back_grow(lv_array_t * array, const void * element);
 
 /**********************
  *  STATIC VARIABLES
@@ -132,7 +143,7 @@ lv_span_t * lv_spangroup_new_span(lv_obj_t * obj)
     span->static_flag = 1;
     span->spangroup = obj;
 
-    refresh_self_size(obj);
+    layout_invalidate(obj);
 
     return span;
 }
@@ -160,7 +171,7 @@ void lv_spangroup_delete_span(lv_obj_t * obj, lv_span_t * span)
         }
     }
 
-    refresh_self_size(obj);
+    layout_invalidate(obj);
 }
 
 /*=====================
@@ -189,7 +200,7 @@ void lv_span_set_text(lv_span_t * span, const char * text)
     span->static_flag = 0;
     lv_memcpy(span->txt, text, text_alloc_len);
 
-    refresh_self_size(span->spangroup);
+    layout_invalidate(span->spangroup);
 }
 
 void lv_span_set_text_static(lv_span_t * span, const char * text)
@@ -205,7 +216,7 @@ void lv_span_set_text_static(lv_span_t * span, const char * text)
     span->static_flag = 1;
     span->txt = (char *)text;
 
-    refresh_self_size(span->spangroup);
+    layout_invalidate(span->spangroup);
 }
 
 void lv_spangroup_set_align(lv_obj_t * obj, lv_text_align_t align)
@@ -231,7 +242,7 @@ void lv_spangroup_set_indent(lv_obj_t * obj, int32_t indent)
 
     spans->indent = indent;
 
-    refresh_self_size(obj);
+    layout_invalidate(obj);
 }
 
 void lv_spangroup_set_mode(lv_obj_t * obj, lv_span_mode_t mode)
@@ -371,7 +382,7 @@ void lv_spangroup_refr_mode(lv_obj_t * obj)
         }
     }
 
-    refresh_self_size(obj);
+    layout_invalidate(obj);
 }
 
 int32_t lv_spangroup_get_max_line_height(lv_obj_t * obj)
@@ -432,109 +443,24 @@ int32_t lv_spangroup_get_expand_height(lv_obj_t * obj, int32_t width)
         return 0;
     }
 
-    /* init draw variable */
-    lv_text_flag_t txt_flag = LV_TEXT_FLAG_NONE;
-    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
-    int32_t max_width = width;
-    int32_t indent = convert_indent_pct(obj, max_width);
-    int32_t max_w  = max_width - indent; /* first line need minus indent */
-
-    /* coords of draw span-txt */
-    lv_point_t txt_pos;
-    lv_point_set(&txt_pos, 0, indent); /* first line need add indent */
-
-    lv_span_t * cur_span = _lv_ll_get_head(&spans->child_ll);
-    const char * cur_txt = cur_span->txt;
-    span_text_check(&cur_txt);
-    uint32_t cur_txt_ofs = 0;
-    lv_snippet_t snippet;   /* use to save cur_span info and push it to stack */
-    lv_memset(&snippet, 0, sizeof(snippet));
-
-    int32_t line_cnt = 0;
-    int32_t lines = spans->lines < 0 ? INT32_MAX : spans->lines;
-    /* the loop control how many lines need to draw */
-    while(cur_span) {
-        int snippet_cnt = 0;
-        int32_t max_line_h = 0;  /* the max height of span-font when a line have a lot of span */
-
-        /* the loop control to find a line and push the relevant span info into stack  */
-        while(1) {
-            /* switch to the next span when current is end */
-            if(cur_txt[cur_txt_ofs] == '\0') {
-                cur_span->trailing_pos = txt_pos;
-                cur_span->trailing_height = max_line_h;
-
-                cur_span = _lv_ll_get_next(&spans->child_ll, cur_span);
-                if(cur_span == NULL) break;
-                cur_txt = cur_span->txt;
-                span_text_check(&cur_txt);
-                cur_txt_ofs = 0;
-                /* maybe also cur_txt[cur_txt_ofs] == '\0' */
-                continue;
-            }
-
-            /* init span info to snippet. */
-            if(cur_txt_ofs == 0) {
-                snippet.span = cur_span;
-                snippet.font = lv_span_get_style_text_font(obj, cur_span);
-                snippet.letter_space = lv_span_get_style_text_letter_space(obj, cur_span);
-                snippet.line_h = lv_font_get_line_height(snippet.font) + line_space;
-            }
-
-            /* get current span text line info */
-            uint32_t next_ofs = 0;
-            int32_t use_width = 0;
-            bool isfill = lv_text_get_snippet(&cur_txt[cur_txt_ofs], snippet.font, snippet.letter_space,
-                                              max_w, txt_flag, &use_width, &next_ofs);
-            if(isfill == false) txt_pos.x += use_width;
-            else txt_pos.x = 0;
-
-            /* break word deal width */
-            if(isfill && next_ofs > 0 && snippet_cnt > 0) {
-                int32_t drawn_width = use_width;
-                if(_lv_ll_get_next(&spans->child_ll, cur_span) == NULL) {
-                    drawn_width -= snippet.letter_space;
-                }
-                if(max_w < drawn_width) {
-                    break;
-                }
+    layout_update(obj, width);
 
-                uint32_t tmp_ofs = next_ofs;
-                uint32_t letter = lv_text_encoded_prev(&cur_txt[cur_txt_ofs], &tmp_ofs);
-                uint32_t letter_next = lv_text_encoded_next(&cur_txt[cur_txt_ofs + next_ofs], NULL);
-                if(!(letter == '\0' || letter == '\n' || letter == '\r' || lv_text_is_break_char(letter) ||
-                     lv_text_is_a_word(letter) || lv_text_is_a_word(letter_next))) {
-                    if(!(letter_next == '\0' || letter_next == '\n'  || letter_next == '\r' || lv_text_is_break_char(letter_next))) {
-                        break;
-                    }
-                }
-            }
-
-            snippet.txt = &cur_txt[cur_txt_ofs];
-            snippet.bytes = next_ofs;
-            snippet.txt_w = use_width;
-            cur_txt_ofs += next_ofs;
-            if(max_line_h < snippet.line_h) {
-                max_line_h = snippet.line_h;
-            }
-            snippet_cnt ++;
-            max_w = max_w - use_width;
-            if(isfill  || max_w <= 0) {
-                break;
-            }
-        }
+    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    uint32_t line_cnt = lv_array_size(&spans->layout_lines);
+    if(spans->lines >= 0) {
+        /* at least one line is measured */
+        line_cnt = LV_MIN(line_cnt, (uint32_t)LV_MAX(spans->lines, 1));
+    }
 
-        /* next line init */
-        txt_pos.y += max_line_h;
-        max_w = max_width;
-        line_cnt += 1;
-        if(line_cnt >= lines) {
-            break;
-        }
+    /* the height starts from the indent as the trailing positions of the spans */
+    int32_t height = convert_indent_pct(obj, width);
+    uint32_t i;
+    for(i = 0; i < line_cnt; i++) {
+        const lv_span_line_t * line = lv_array_at(&spans->layout_lines, i);
+        height += line->height;
     }
-    txt_pos.y -= line_space;
 
-    return txt_pos.y;
+    return height - line_space;
 }
 
 lv_span_coords_t lv_spangroup_get_span_coords(lv_obj_t * obj, lv_span_t * span)
@@ -548,6 +474,9 @@ lv_span_coords_t lv_spangroup_get_span_coords(lv_obj_t * obj, lv_span_t * span)
 
     if(obj == NULL || span == NULL || _lv_ll_get_head(spans) == NULL) return coords;
 
+    /* the trailing positions are updated with the layout */
+    layout_update(obj, width);
+
     lv_span_t * prev_span = NULL;
     lv_span_t * curr_span;
     _LV_LL_READ(spans, curr_span) {
@@ -646,8 +575,11 @@ static void lv_spangroup_constructor(const lv_obj_class_t * class_p, lv_obj_t *
     spans->cache_w = 0;
     spans->cache_h = 0;
     spans->refresh = 1;
+    spans->layout_w = -1;
 
     lv_array_init(&spans->event_spans, 0, sizeof(span_event_key_pair));
+    lv_array_init(&spans->layout_lines, 0, sizeof(lv_span_line_t));
+    lv_array_init(&spans->layout_snippets, 0, sizeof(lv_snippet_t));
 }
 
 static void lv_spangroup_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
@@ -665,6 +597,9 @@ static void lv_spangroup_destructor(const lv_obj_class_t * class_p, lv_obj_t * o
         lv_free(cur_span);
         cur_span = _lv_ll_get_head(&spans->child_ll);
     }
+
+    lv_array_deinit(&spans->layout_lines);
+    lv_array_deinit(&spans->layout_snippets);
 }
 
 static void lv_spangroup_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -682,7 +617,7 @@ static void lv_spangroup_event(const lv_obj_class_t * class_p, lv_event_t * e)
         draw_main(e);
     }
     else if(code == LV_EVENT_STYLE_CHANGED) {
-        refresh_self_size(obj);
+        layout_invalidate(obj);
     }
     else if(code == LV_EVENT_SIZE_CHANGED) {
         refresh_self_size(obj);
@@ -951,42 +886,34 @@ static int32_t convert_indent_pct(lv_obj_t * obj, int32_t width)
 }
 
 /**
- * draw span group
- * @param spans obj handle
- * @param coords coordinates of the label
- * @param mask the label will be drawn only in this area
+ * Break the text of the spans to lines and cache the lines and their snippets.
+ * Nothing happens if the layout is already created for this width.
+ * @param obj       pointer to a spangroup
+ * @param width     the max width of the lines
  */
-static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
+static void layout_update(lv_obj_t * obj, int32_t width)
 {
-
-    lv_area_t coords;
-    lv_obj_get_content_coords(obj, &coords);
-
     lv_spangroup_t * spans = (lv_spangroup_t *)obj;
+    if(spans->layout_w == width) return;
 
-    /* return if not span */
-    if(_lv_ll_get_head(&spans->child_ll) == NULL) {
+    spans->layout_w = width;
+    lv_array_clear(&spans->layout_lines);
+    lv_array_clear(&spans->layout_snippets);
+
+    if(_lv_ll_get_head(&spans->child_ll) == NULL || width <= 0) {
         return;
     }
 
-    /* return if no draw area */
-    lv_area_t clip_area;
-    if(!_lv_area_intersect(&clip_area, &coords, &layer->_clip_area))  return;
-    const lv_area_t clip_area_ori = layer->_clip_area;
-    layer->_clip_area = clip_area;
-
     /* init draw variable */
     lv_text_flag_t txt_flag = LV_TEXT_FLAG_NONE;
-    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);;
-    int32_t max_width = lv_area_get_width(&coords);
+    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    int32_t max_width = width;
     int32_t indent = convert_indent_pct(obj, max_width);
     int32_t max_w  = max_width - indent; /* first line need minus indent */
-    lv_opa_t obj_opa = lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN);
 
-    /* coords of draw span-txt */
+    /* coords of the span trailing positions */
     lv_point_t txt_pos;
-    txt_pos.y = coords.y1;
-    txt_pos.x = coords.x1 + indent; /* first line need add indent */
+    lv_point_set(&txt_pos, 0, indent);
 
     lv_span_t * cur_span = _lv_ll_get_head(&spans->child_ll);
     const char * cur_txt = cur_span->txt;
@@ -995,22 +922,20 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
     lv_snippet_t snippet;   /* use to save cur_span info and push it to stack */
     lv_memzero(&snippet, sizeof(snippet));
 
-    lv_draw_label_dsc_t label_draw_dsc;
-    lv_draw_label_dsc_init(&label_draw_dsc);
-
-    bool is_first_line = true;
     /* the loop control how many lines need to draw */
     while(cur_span) {
-        bool is_end_line = false;
-        bool ellipsis_valid = false;
         int32_t max_line_h = 0;  /* the max height of span-font when a line have a lot of span */
         int32_t max_baseline = 0; /*baseline of the highest span*/
+        int32_t line_w = 0;
         lv_snippet_clear();
 
         /* the loop control to find a line and push the relevant span info into stack  */
         while(1) {
             /* switch to the next span when current is end */
             if(cur_txt[cur_txt_ofs] == '\0') {
+                cur_span->trailing_pos = txt_pos;
+                cur_span->trailing_height = max_line_h;
+
                 cur_span = _lv_ll_get_next(&spans->child_ll, cur_span);
                 if(cur_span == NULL) break;
                 cur_txt = cur_span->txt;
@@ -1033,6 +958,8 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
             int32_t use_width = 0;
             bool isfill = lv_text_get_snippet(&cur_txt[cur_txt_ofs], snippet.font, snippet.letter_space,
                                               max_w, txt_flag, &use_width, &next_ofs);
+            if(isfill == false) txt_pos.x += use_width;
+            else txt_pos.x = 0;
 
             if(isfill) {
                 if(next_ofs > 0 && lv_get_snippet_count() > 0) {
@@ -1067,35 +994,130 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
             }
 
             lv_snippet_push(&snippet);
+            line_w += use_width;
             max_w = max_w - use_width;
             if(isfill || max_w <= 0) {
                 break;
             }
         }
 
-        /* start current line deal with */
-
         uint32_t item_cnt = lv_get_snippet_count();
         if(item_cnt == 0) {     /* break if stack is empty */
             break;
         }
 
+        lv_span_line_t line;
+        line.first_snippet = lv_array_size(&spans->layout_snippets);
+        line.snippet_cnt = item_cnt;
+        line.height = max_line_h;
+        line.base_line = max_baseline;
+        line.width = line_w;
+        array_push_back_grow(&spans->layout_lines, &line);
+
+        uint32_t i;
+        for(i = 0; i < item_cnt; i++) {
+            array_push_back_grow(&spans->layout_snippets, lv_get_snippet(i));
+        }
+
+        /* next line init */
+        txt_pos.y += max_line_h;
+        max_w = max_width;
+    }
+}
+
+/**
+ * Make the layout created again and refresh the size of the spangroup.
+ * Needs to be called when the texts or the styles of the spans change.
+ * @param obj       pointer to a spangroup
+ */
+static void layout_invalidate(lv_obj_t * obj)
+{
+    lv_spangroup_t * spans = (lv_spangroup_t *)obj;
+    spans->layout_w = -1;
+    refresh_self_size(obj);
+}
+
+static void array_push_back_grow(lv_array_t * array, const void * element)
+{
+    /* grow exponentially as a layout can have hundreds of snippets */
+    if(lv_array_is_full(array)) {
+        lv_array_resize(array, lv_array_capacity(array) * 2 + LV_ARRAY_DEFAULT_CAPACITY);
+    }
+
+    lv_array_push_back(array, element);
+}
+
+/**
+ * draw span group
+ * @param spans obj handle
+ * @param coords coordinates of the label
+ * @param mask the label will be drawn only in this area
+ */
+static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
+{
+
+    lv_area_t coords;
+    lv_obj_get_content_coords(obj, &coords);
+
+    lv_spangroup_t * spans = (lv_spangroup_t *)obj;
+
+    /* return if not span */
+    if(_lv_ll_get_head(&spans->child_ll) == NULL) {
+        return;
+    }
+
+    /* return if no draw area */
+    lv_area_t clip_area;
+    if(!_lv_area_intersect(&clip_area, &coords, &layer->_clip_area))  return;
+    const lv_area_t clip_area_ori = layer->_clip_area;
+    layer->_clip_area = clip_area;
+
+    /* init draw variable */
+    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);;
+    int32_t max_width = lv_area_get_width(&coords);
+    int32_t indent = convert_indent_pct(obj, max_width);
+    lv_opa_t obj_opa = lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN);
+    lv_text_align_t align = lv_obj_get_style_text_align(obj, LV_PART_MAIN);
+
+    layout_update(obj, max_width);
+
+    /* coords of draw span-txt */
+    lv_point_t txt_pos;
+    txt_pos.y = coords.y1;
+    txt_pos.x = coords.x1 + indent; /* first line need add indent */
+
+    lv_draw_label_dsc_t label_draw_dsc;
+    lv_draw_label_dsc_init(&label_draw_dsc);
+
+    uint32_t line_cnt = lv_array_size(&spans->layout_lines);
+    uint32_t line_i;
+    for(line_i = 0; line_i < line_cnt; line_i++) {
+        const lv_span_line_t * line = lv_array_at(&spans->layout_lines, line_i);
+        const lv_snippet_t * snippets = lv_array_at(&spans->layout_snippets, line->first_snippet);
+        uint32_t item_cnt = line->snippet_cnt;
+        int32_t max_line_h = line->height;
+        int32_t max_baseline = line->base_line;
+        bool is_end_line = false;
+        bool ellipsis_valid = false;
+
+        /* the last snippet is copied as it's extended to the end of its span on the end line */
+        lv_snippet_t last_snippet = snippets[item_cnt - 1];
+
         /* Whether the current line is the end line and does overflow processing */
         {
-            lv_snippet_t * last_snippet = lv_get_snippet(item_cnt - 1);
-            int32_t next_line_h = last_snippet->line_h;
-            if(last_snippet->txt[last_snippet->bytes] == '\0') {
+            int32_t next_line_h = last_snippet.line_h;
+            if(last_snippet.txt[last_snippet.bytes] == '\0') {
                 next_line_h = 0;
-                lv_span_t * next_span = _lv_ll_get_next(&spans->child_ll, last_snippet->span);
+                lv_span_t * next_span = _lv_ll_get_next(&spans->child_ll, last_snippet.span);
                 if(next_span) { /* have the next line */
                     next_line_h = lv_font_get_line_height(lv_span_get_style_text_font(obj, next_span)) + line_space;
                 }
             }
             if(txt_pos.y + max_line_h + next_line_h - line_space > coords.y2 + 1) { /* for overflow if is end line. */
-                if(last_snippet->txt[last_snippet->bytes] != '\0') {
-                    last_snippet->bytes = lv_strlen(last_snippet->txt);
-                    last_snippet->txt_w = lv_text_get_width(last_snippet->txt, last_snippet->bytes, last_snippet->font,
-                                                            last_snippet->letter_space);
+                if(last_snippet.txt[last_snippet.bytes] != '\0') {
+                    last_snippet.bytes = lv_strlen(last_snippet.txt);
+                    last_snippet.txt_w = lv_text_get_width(last_snippet.txt, last_snippet.bytes, last_snippet.font,
+                                                           last_snippet.letter_space);
                 }
                 ellipsis_valid = spans->overflow == LV_SPAN_OVERFLOW_ELLIPSIS;
                 is_end_line = true;
@@ -1108,16 +1130,11 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
         }
 
         /* align deal with */
-        lv_text_align_t align = lv_obj_get_style_text_align(obj, LV_PART_MAIN);
         if(align == LV_TEXT_ALIGN_CENTER || align == LV_TEXT_ALIGN_RIGHT) {
             int32_t align_ofs = 0;
-            int32_t txts_w = is_first_line ? indent : 0;
-            uint32_t i;
-            for(i = 0; i < item_cnt; i++) {
-                lv_snippet_t * pinfo = lv_get_snippet(i);
-                txts_w = txts_w + pinfo->txt_w;
-            }
-            txts_w -= lv_get_snippet(item_cnt - 1)->letter_space;
+            int32_t txts_w = line_i == 0 ? indent : 0;
+            txts_w += line->width - snippets[item_cnt - 1].txt_w + last_snippet.txt_w;
+            txts_w -= last_snippet.letter_space;
             align_ofs = max_width > txts_w ? max_width - txts_w : 0;
             if(align == LV_TEXT_ALIGN_CENTER) {
                 align_ofs = align_ofs >> 1;
@@ -1128,7 +1145,7 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
         /* draw line letters */
         uint32_t i;
         for(i = 0; i < item_cnt; i++) {
-            lv_snippet_t * pinfo = lv_get_snippet(i);
+            const lv_snippet_t * pinfo = i == item_cnt - 1 ? &last_snippet : &snippets[i];
 
             /* bidi deal with:todo */
             const char * bidi_txt = pinfo->txt;
@@ -1138,7 +1155,7 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
             pos.y = txt_pos.y + max_line_h - pinfo->line_h - (max_baseline - pinfo->font->base_line);
             label_draw_dsc.color = lv_span_get_style_text_color(obj, pinfo->span);
             label_draw_dsc.opa = lv_span_get_style_text_opa(obj, pinfo->span);
-            label_draw_dsc.font = lv_span_get_style_text_font(obj, pinfo->span);
+            label_draw_dsc.font = pinfo->font;
             label_draw_dsc.blend_mode = lv_span_get_style_text_blend_mode(obj, pinfo->span);
             if(obj_opa < LV_OPA_MAX) {
                 label_draw_dsc.opa = LV_OPA_MIX2(label_draw_dsc.opa, obj_opa);
@@ -1219,14 +1236,11 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
 
 Next_line_init:
         /* next line init */
-        is_first_line = false;
         txt_pos.x = coords.x1;
         txt_pos.y += max_line_h;
         if(is_end_line || txt_pos.y > clip_area.y2 + 1) {
-            layer->_clip_area = clip_area_ori;
-            return;
+            break;
         }
-        max_w = max_width;
     }
     layer->_clip_area = clip_area_ori;
 }
@@ -82,6 +82,9 @@ typedef struct {
     uint32_t refresh : 1;    /* the spangroup need refresh cache_w and cache_h */
 
     lv_array_t event_spans;
+    lv_array_t layout_lines;     /* the lines of the text broken to `layout_w` width */
+    lv_array_t layout_snippets;  /* the text snippets of `layout_lines` */
+    int32_t layout_w;            /* the width of the cached layout, -1: needs to be recreated */
 } lv_spangroup_t;
 
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_spangroup_class;
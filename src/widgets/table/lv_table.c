@@ -39,6 +39,12 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
                               int32_t cell_left, int32_t cell_right, int32_t cell_top, int32_t cell_bottom);
 static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row);
 static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col);
+static void refr_row_heights(lv_obj_t * obj);
+static void mark_rows_dirty(lv_obj_t * obj, uint32_t start_row, uint32_t end_row);
+static int32_t get_row_y(lv_table_t * table, uint32_t row);
+static uint32_t get_row_at_y(lv_table_t * table, int32_t y);
+static const char * get_cell_txt(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table_cell_ctrl_t * ctrl);
+static void free_cells(lv_obj_t * obj);
 static lv_result_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint32_t * col);
 static size_t get_cell_txt_len(const char * txt);
 static void copy_cell_txt(lv_table_cell_t * dst, const char * txt);
@@ -92,6 +98,11 @@ void lv_table_set_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col, const c
 
     lv_table_t * table = (lv_table_t *)obj;
 
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("the cells are provided by a callback");
+        return;
+    }
+
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
     if(row >= table->row_cnt) lv_table_set_row_count(obj, row + 1);
@@ -126,6 +137,11 @@ void lv_table_set_cell_value_fmt(lv_obj_t * obj, uint32_t row, uint32_t col, con
     LV_ASSERT_NULL(fmt);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("the cells are provided by a callback");
+        return;
+    }
+
     if(col >= table->col_cnt) {
         lv_table_set_column_count(obj, col + 1);
     }
@@ -208,36 +224,45 @@ void lv_table_set_row_count(lv_obj_t * obj, uint32_t row_cnt)
     uint32_t old_row_cnt = table->row_cnt;
     table->row_cnt         = row_cnt;
 
+    table->row_y = lv_realloc(table->row_y, (table->row_cnt + 1) * sizeof(table->row_y[0]));
+    LV_ASSERT_MALLOC(table->row_y);
+    if(table->row_y == NULL) return;
+    table->row_y_valid = LV_MIN(table->row_y_valid, row_cnt);
+
     table->row_h = lv_realloc(table->row_h, table->row_cnt * sizeof(table->row_h[0]));
     LV_ASSERT_MALLOC(table->row_h);
     if(table->row_h == NULL) return;
 
-    /*Free the unused cells*/
-    if(old_row_cnt > row_cnt) {
-        uint32_t old_cell_cnt = old_row_cnt * table->col_cnt;
-        uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
-        uint32_t i;
-        for(i = new_cell_cnt; i < old_cell_cnt; i++) {
-            if(table->cell_data[i] && table->cell_data[i]->user_data) {
-                lv_free(table->cell_data[i]->user_data);
-                table->cell_data[i]->user_data = NULL;
+    if(table->cell_value_cb == NULL) {
+        /*Free the unused cells*/
+        if(old_row_cnt > row_cnt) {
+            uint32_t old_cell_cnt = old_row_cnt * table->col_cnt;
+            uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
+            uint32_t i;
+            for(i = new_cell_cnt; i < old_cell_cnt; i++) {
+                if(table->cell_data[i] && table->cell_data[i]->user_data) {
+                    lv_free(table->cell_data[i]->user_data);
+                    table->cell_data[i]->user_data = NULL;
+                }
+                lv_free(table->cell_data[i]);
             }
-            lv_free(table->cell_data[i]);
         }
-    }
 
-    table->cell_data = lv_realloc(table->cell_data, table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
-    LV_ASSERT_MALLOC(table->cell_data);
-    if(table->cell_data == NULL) return;
+        table->cell_data = lv_realloc(table->cell_data, table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
+        LV_ASSERT_MALLOC(table->cell_data);
+        if(table->cell_data == NULL) return;
 
-    /*Initialize the new fields*/
-    if(old_row_cnt < row_cnt) {
-        uint32_t old_cell_cnt = old_row_cnt * table->col_cnt;
-        uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
-        lv_memzero(&table->cell_data[old_cell_cnt], (new_cell_cnt - old_cell_cnt) * sizeof(table->cell_data[0]));
+        /*Initialize the new fields*/
+        if(old_row_cnt < row_cnt) {
+            uint32_t old_cell_cnt = old_row_cnt * table->col_cnt;
+            uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
+            lv_memzero(&table->cell_data[old_cell_cnt], (new_cell_cnt - old_cell_cnt) * sizeof(table->cell_data[0]));
+        }
     }
 
-    refr_size_form_row(obj, 0);
+    /*Only the new rows need to be measured*/
+    table->row_h_dirty_end = LV_MIN(table->row_h_dirty_end, row_cnt);
+    refr_size_form_row(obj, LV_MIN(old_row_cnt, row_cnt));
 }
 
 void lv_table_set_column_count(lv_obj_t * obj, uint32_t col_cnt)
@@ -251,40 +276,42 @@ void lv_table_set_column_count(lv_obj_t * obj, uint32_t col_cnt)
     uint32_t old_col_cnt = table->col_cnt;
     table->col_cnt         = col_cnt;
 
-    lv_table_cell_t ** new_cell_data = lv_malloc(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
-    LV_ASSERT_MALLOC(new_cell_data);
-    if(new_cell_data == NULL) return;
-    uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
+    if(table->cell_value_cb == NULL) {
+        lv_table_cell_t ** new_cell_data = lv_malloc(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
+        LV_ASSERT_MALLOC(new_cell_data);
+        if(new_cell_data == NULL) return;
+        uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
 
-    lv_memzero(new_cell_data, new_cell_cnt * sizeof(table->cell_data[0]));
+        lv_memzero(new_cell_data, new_cell_cnt * sizeof(table->cell_data[0]));
 
-    /*The new column(s) messes up the mapping of `cell_data`*/
-    uint32_t old_col_start;
-    uint32_t new_col_start;
-    uint32_t min_col_cnt = LV_MIN(old_col_cnt, col_cnt);
-    uint32_t row;
-    for(row = 0; row < table->row_cnt; row++) {
-        old_col_start = row * old_col_cnt;
-        new_col_start = row * col_cnt;
-
-        lv_memcpy(&new_cell_data[new_col_start], &table->cell_data[old_col_start],
-                  sizeof(new_cell_data[0]) * min_col_cnt);
-
-        /*Free the old cells (only if the table becomes smaller)*/
-        int32_t i;
-        for(i = 0; i < (int32_t)old_col_cnt - (int32_t)col_cnt; i++) {
-            uint32_t idx = old_col_start + min_col_cnt + i;
-            if(table->cell_data[idx]->user_data) {
-                lv_free(table->cell_data[idx]->user_data);
-                table->cell_data[idx]->user_data = NULL;
+        /*The new column(s) messes up the mapping of `cell_data`*/
+        uint32_t old_col_start;
+        uint32_t new_col_start;
+        uint32_t min_col_cnt = LV_MIN(old_col_cnt, col_cnt);
+        uint32_t row;
+        for(row = 0; row < table->row_cnt; row++) {
+            old_col_start = row * old_col_cnt;
+            new_col_start = row * col_cnt;
+
+            lv_memcpy(&new_cell_data[new_col_start], &table->cell_data[old_col_start],
+                      sizeof(new_cell_data[0]) * min_col_cnt);
+
+            /*Free the old cells (only if the table becomes smaller)*/
+            int32_t i;
+            for(i = 0; i < (int32_t)old_col_cnt - (int32_t)col_cnt; i++) {
+                uint32_t idx = old_col_start + min_col_cnt + i;
+                if(table->cell_data[idx]->user_data) {
+                    lv_free(table->cell_data[idx]->user_data);
+                    table->cell_data[idx]->user_data = NULL;
+                }
+                lv_free(table->cell_data[idx]);
+                table->cell_data[idx] = NULL;
             }
-            lv_free(table->cell_data[idx]);
-            table->cell_data[idx] = NULL;
         }
-    }
 
-    lv_free(table->cell_data);
-    table->cell_data = new_cell_data;
+        lv_free(table->cell_data);
+        table->cell_data = new_cell_data;
+    }
 
     /*Initialize the new column widths if any*/
     table->col_w = lv_realloc(table->col_w, col_cnt * sizeof(table->col_w[0]));
@@ -318,6 +345,11 @@ void lv_table_add_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table
 
     lv_table_t * table = (lv_table_t *)obj;
 
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("the cells are provided by a callback");
+        return;
+    }
+
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
     if(row >= table->row_cnt) lv_table_set_row_count(obj, row + 1);
@@ -343,6 +375,11 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_tab
 
     lv_table_t * table = (lv_table_t *)obj;
 
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("the cells are provided by a callback");
+        return;
+    }
+
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
     if(row >= table->row_cnt) lv_table_set_row_count(obj, row + 1);
@@ -368,6 +405,11 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
 
     lv_table_t * table = (lv_table_t *)obj;
 
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("the cells are provided by a callback");
+        return;
+    }
+
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
     if(row >= table->row_cnt) lv_table_set_row_count(obj, row + 1);
@@ -391,6 +433,37 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
     table->cell_data[cell]->user_data = user_data;
 }
 
+void lv_table_set_cell_value_cb(lv_obj_t * obj, lv_table_cell_value_cb_t cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_value_cb == cb) return;
+
+    if(cb) {
+        free_cells(obj);
+    }
+    else {
+        table->cell_data = lv_malloc_zeroed(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
+        LV_ASSERT_MALLOC(table->cell_data);
+    }
+
+    table->cell_value_cb = cb;
+    refr_size_form_row(obj, 0);
+}
+
+void lv_table_refresh_rows(lv_obj_t * obj, uint32_t row, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    if(row >= table->row_cnt || cnt == 0) return;
+
+    mark_rows_dirty(obj, row, LV_MIN(row + cnt, table->row_cnt));
+    lv_obj_refresh_self_size(obj);
+    lv_obj_invalidate(obj);
+}
+
 /*=====================
  * Getter functions
  *====================*/
@@ -404,11 +477,8 @@ const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col)
         LV_LOG_WARN("invalid row or column");
         return "";
     }
-    uint32_t cell = row * table->col_cnt + col;
-
-    if(is_cell_empty(table->cell_data[cell])) return "";
-
-    return table->cell_data[cell]->txt;
+    const char * txt = get_cell_txt(obj, row, col, NULL);
+    return txt ? txt : "";
 }
 
 uint32_t lv_table_get_row_count(lv_obj_t * obj)
@@ -450,10 +520,9 @@ bool lv_table_has_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table
         LV_LOG_WARN("invalid row or column");
         return false;
     }
-    uint32_t cell = row * table->col_cnt + col;
-
-    if(is_cell_empty(table->cell_data[cell])) return false;
-    else return (table->cell_data[cell]->ctrl & ctrl) == ctrl;
+    lv_table_cell_ctrl_t cell_ctrl;
+    if(get_cell_txt(obj, row, col, &cell_ctrl) == NULL) return false;
+    else return (cell_ctrl & ctrl) == ctrl;
 }
 
 void lv_table_get_selected_cell(lv_obj_t * obj, uint32_t * row, uint32_t * col)
@@ -472,6 +541,8 @@ void * lv_table_get_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col)
         LV_LOG_WARN("invalid row or column");
         return NULL;
     }
+    if(table->cell_value_cb) return NULL;
+
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) return NULL;
@@ -479,6 +550,14 @@ void * lv_table_get_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col)
     return table->cell_data[cell]->user_data;
 }
 
+lv_table_cell_value_cb_t lv_table_get_cell_value_cb(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    return table->cell_value_cb;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -494,8 +573,10 @@ static void lv_table_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     table->row_cnt = 1;
     table->col_w = lv_malloc(table->col_cnt * sizeof(table->col_w[0]));
     table->row_h = lv_malloc(table->row_cnt * sizeof(table->row_h[0]));
+    table->row_y = lv_malloc((table->row_cnt + 1) * sizeof(table->row_y[0]));
     table->col_w[0] = LV_DPI_DEF;
     table->row_h[0] = LV_DPI_DEF;
+    table->row_y[0] = 0;
     table->cell_data = lv_realloc(table->cell_data, table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
     table->cell_data[0] = NULL;
 
@@ -506,21 +587,9 @@ static void lv_table_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 {
     LV_UNUSED(class_p);
     lv_table_t * table = (lv_table_t *)obj;
-    /*Free the cell texts*/
-    uint32_t i;
-    for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
-        if(table->cell_data[i]) {
-            if(table->cell_data[i]->user_data) {
-                lv_free(table->cell_data[i]->user_data);
-                table->cell_data[i]->user_data = NULL;
-            }
-            lv_free(table->cell_data[i]);
-            table->cell_data[i] = NULL;
-        }
-    }
-
-    if(table->cell_data) lv_free(table->cell_data);
+    free_cells(obj);
     if(table->row_h) lv_free(table->row_h);
+    if(table->row_y) lv_free(table->row_y);
     if(table->col_w) lv_free(table->col_w);
 }
 
@@ -547,8 +616,8 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
         int32_t w = 0;
         for(i = 0; i < table->col_cnt; i++) w += table->col_w[i];
 
-        int32_t h = 0;
-        for(i = 0; i < table->row_cnt; i++) h += table->row_h[i];
+        refr_row_heights(obj);
+        int32_t h = get_row_y(table, table->row_cnt);
 
         p->x = w - 1;
         p->y = h - 1;
@@ -653,6 +722,8 @@ static void draw_main(lv_event_t * e)
     lv_area_t clip_area;
     if(!_lv_area_intersect(&clip_area, &obj->coords, &layer->_clip_area)) return;
 
+    refr_row_heights(obj);
+
     const lv_area_t clip_area_ori = layer->_clip_area;
     layer->_clip_area = clip_area;
 
@@ -682,16 +753,19 @@ static void draw_main(lv_event_t * e)
 
     uint32_t col;
     uint32_t row;
-    uint32_t cell = 0;
 
-    cell_area.y2 = obj->coords.y1 + bg_top - 1 - lv_obj_get_scroll_y(obj) + border_width;
+    /*Skip the rows above the clip area*/
+    int32_t y_ofs = obj->coords.y1 + bg_top - lv_obj_get_scroll_y(obj) + border_width;
+    uint32_t row_start = get_row_at_y(table, clip_area.y1 - y_ofs);
+
+    cell_area.y2 = y_ofs + (row_start < table->row_cnt ? get_row_y(table, row_start) : 0) - 1;
     cell_area.x1 = 0;
     cell_area.x2 = 0;
     int32_t scroll_x = lv_obj_get_scroll_x(obj) ;
     bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL;
 
     /*Handle custom drawer*/
-    for(row = 0; row < table->row_cnt; row++) {
+    for(row = row_start; row < table->row_cnt; row++) {
         int32_t h_row = table->row_h[row];
 
         cell_area.y1 = cell_area.y2 + 1;
@@ -704,7 +778,7 @@ static void draw_main(lv_event_t * e)
 
         for(col = 0; col < table->col_cnt; col++) {
             lv_table_cell_ctrl_t ctrl = 0;
-            if(table->cell_data[cell]) ctrl = table->cell_data[cell]->ctrl;
+            get_cell_txt(obj, row, col, &ctrl);
 
             if(rtl) {
                 cell_area.x2 = cell_area.x1 - 1;
@@ -717,11 +791,9 @@ static void draw_main(lv_event_t * e)
 
             uint32_t col_merge = 0;
             for(col_merge = 0; col_merge + col < table->col_cnt - 1; col_merge++) {
-                lv_table_cell_t * next_cell_data = table->cell_data[cell + col_merge];
-
-                if(is_cell_empty(next_cell_data)) break;
+                lv_table_cell_ctrl_t merge_ctrl;
+                if(get_cell_txt(obj, row, col + col_merge, &merge_ctrl) == NULL) break;
 
-                lv_table_cell_ctrl_t merge_ctrl = (lv_table_cell_ctrl_t) next_cell_data->ctrl;
                 if(merge_ctrl & LV_TABLE_CELL_CTRL_MERGE_RIGHT) {
                     int32_t offset = table->col_w[col + col_merge + 1];
 
@@ -734,7 +806,6 @@ static void draw_main(lv_event_t * e)
             }
 
             if(cell_area.y2 < clip_area.y1) {
-                cell += col_merge + 1;
                 col += col_merge;
                 continue;
             }
@@ -788,7 +859,9 @@ static void draw_main(lv_event_t * e)
 
             lv_draw_rect(layer, &rect_dsc_act, &cell_area_border);
 
-            if(table->cell_data[cell]) {
+            /*Get the text only now as the callback might have overwritten it while checking the merged cells*/
+            const char * txt = get_cell_txt(obj, row, col, NULL);
+            if(txt) {
                 const int32_t cell_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
                 const int32_t cell_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
                 const int32_t cell_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
@@ -805,7 +878,7 @@ static void draw_main(lv_event_t * e)
                 bool crop = ctrl & LV_TABLE_CELL_CTRL_TEXT_CROP;
                 if(crop) txt_flags = LV_TEXT_FLAG_EXPAND;
 
-                lv_text_get_size(&txt_size, table->cell_data[cell]->txt, label_dsc_def.font,
+                lv_text_get_size(&txt_size, txt, label_dsc_def.font,
                                  label_dsc_act.letter_space, label_dsc_act.line_space,
                                  lv_area_get_width(&txt_area), txt_flags);
 
@@ -820,13 +893,14 @@ static void draw_main(lv_event_t * e)
                 label_mask_ok = _lv_area_intersect(&label_clip_area, &clip_area, &cell_area);
                 if(label_mask_ok) {
                     layer->_clip_area = label_clip_area;
-                    label_dsc_act.text = table->cell_data[cell]->txt;
+                    label_dsc_act.text = txt;
+                    /*The callback might reuse its buffer so copy the text*/
+                    label_dsc_act.text_local = table->cell_value_cb != NULL;
                     lv_draw_label(layer, &label_dsc_act, &txt_area);
                     layer->_clip_area = clip_area;
                 }
             }
 
-            cell += col_merge + 1;
             col += col_merge;
         }
     }
@@ -834,28 +908,12 @@ static void draw_main(lv_event_t * e)
     layer->_clip_area = clip_area_ori;
 }
 
-/* Refreshes size of the table starting from @start_row row */
+/* Refreshes size of the table starting from @start_row row.
+ * The rows are measured only when their height is needed, so that many changes are handled at once.*/
 static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row)
 {
-    const int32_t cell_pad_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
-    const int32_t cell_pad_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
-    const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
-    const int32_t cell_pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
-
-    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_ITEMS);
-    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_ITEMS);
-    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
-
-    const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
-    const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
-
     lv_table_t * table = (lv_table_t *)obj;
-    uint32_t i;
-    for(i = start_row; i < table->row_cnt; i++) {
-        int32_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
-                                                   cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
-        table->row_h[i] = LV_CLAMP(minh, calculated_height, maxh);
-    }
+    mark_rows_dirty(obj, start_row, table->row_cnt);
 
     lv_obj_refresh_self_size(obj);
     lv_obj_invalidate(obj);
@@ -890,11 +948,107 @@ static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col)
         lv_obj_invalidate_area(obj, &cell_area);
     }
     else {
+        table->row_y_valid = LV_MIN(table->row_y_valid, row);
         lv_obj_refresh_self_size(obj);
         lv_obj_invalidate(obj);
     }
 }
 
+/**
+ * Measure the rows whose height was marked as outdated
+ * @param obj       pointer to a table
+ */
+static void refr_row_heights(lv_obj_t * obj)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->row_h_dirty_start >= table->row_h_dirty_end) return;
+
+    LV_PROFILER_BEGIN;
+    const int32_t cell_pad_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
+
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_ITEMS);
+    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_ITEMS);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
+
+    const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
+    const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
+
+    uint32_t i;
+    for(i = table->row_h_dirty_start; i < table->row_h_dirty_end; i++) {
+        int32_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
+                                                   cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
+        table->row_h[i] = LV_CLAMP(minh, calculated_height, maxh);
+    }
+
+    table->row_y_valid = LV_MIN(table->row_y_valid, table->row_h_dirty_start);
+    table->row_h_dirty_start = 0;
+    table->row_h_dirty_end = 0;
+    LV_PROFILER_END;
+}
+
+/**
+ * Mark the height of some rows as outdated
+ * @param obj           pointer to a table
+ * @param start_row     the first row to measure again
+ * @param end_row       measure until this row (exclusive)
+ */
+static void mark_rows_dirty(lv_obj_t * obj, uint32_t start_row, uint32_t end_row)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(start_row >= end_row) return;
+
+    if(table->row_h_dirty_start >= table->row_h_dirty_end) {
+        table->row_h_dirty_start = start_row;
+        table->row_h_dirty_end = end_row;
+    }
+    else {
+        table->row_h_dirty_start = LV_MIN(table->row_h_dirty_start, start_row);
+        table->row_h_dirty_end = LV_MAX(table->row_h_dirty_end, end_row);
+    }
+}
+
+/**
+ * Get the top of a row relative to the first row. The sums are updated only when needed.
+ * @param table     pointer to a table
+ * @param row       id of a row [0 .. row_cnt]. `row_cnt` returns the height of the whole table.
+ * @return          the sum of the height of the previous rows
+ */
+static int32_t get_row_y(lv_table_t * table, uint32_t row)
+{
+    uint32_t i;
+    for(i = table->row_y_valid; i < row; i++) {
+        table->row_y[i + 1] = table->row_y[i] + table->row_h[i];
+    }
+    if(row > table->row_y_valid) table->row_y_valid = row;
+
+    return table->row_y[row];
+}
+
+/**
+ * Find the row at a given y coordinate with binary search
+ * @param table     pointer to a table
+ * @param y         y coordinate relative to the top of the first row
+ * @return          id of the row. 0 if `y` is above the table and `row_cnt` if it's below
+ */
+static uint32_t get_row_at_y(lv_table_t * table, int32_t y)
+{
+    /*Update all the sums*/
+    get_row_y(table, table->row_cnt);
+
+    uint32_t min = 0;
+    uint32_t max = table->row_cnt;
+    while(min < max) {
+        uint32_t mid = min + (max - min) / 2;
+        if(table->row_y[mid + 1] > y) max = mid;
+        else min = mid + 1;
+    }
+
+    return min;
+}
+
 static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t * font,
                               int32_t letter_space, int32_t line_space,
                               int32_t cell_left, int32_t cell_right, int32_t cell_top, int32_t cell_bottom)
@@ -902,16 +1056,17 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
     lv_table_t * table = (lv_table_t *)obj;
 
     int32_t h_max = lv_font_get_line_height(font) + cell_top + cell_bottom;
-    /* Calculate the cell_data index where to start */
-    uint32_t row_start = row_id * table->col_cnt;
 
     /* Traverse the cells in the row_id row */
-    uint32_t cell;
     uint32_t col;
-    for(cell = row_start, col = 0; cell < row_start + table->col_cnt; cell++, col++) {
-        lv_table_cell_t * cell_data = table->cell_data[cell];
+    for(col = 0; col < table->col_cnt; col++) {
+        lv_table_cell_ctrl_t ctrl;
+        if(get_cell_txt(obj, row_id, col, &ctrl) == NULL) {
+            continue;
+        }
 
-        if(is_cell_empty(cell_data)) {
+        /*When cropping the text we can assume the row height is equal to the line height*/
+        if(ctrl & LV_TABLE_CELL_CTRL_TEXT_CROP) {
             continue;
         }
 
@@ -922,12 +1077,10 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
          * exit the traversal when the current cell control is not LV_TABLE_CELL_CTRL_MERGE_RIGHT */
         uint32_t col_merge = 0;
         for(col_merge = 0; col_merge + col < table->col_cnt - 1; col_merge++) {
-            lv_table_cell_t * next_cell_data = table->cell_data[cell + col_merge];
-
-            if(is_cell_empty(next_cell_data)) break;
+            lv_table_cell_ctrl_t merge_ctrl;
+            if(get_cell_txt(obj, row_id, col + col_merge, &merge_ctrl) == NULL) break;
 
-            lv_table_cell_ctrl_t ctrl = (lv_table_cell_ctrl_t) next_cell_data->ctrl;
-            if(ctrl & LV_TABLE_CELL_CTRL_MERGE_RIGHT) {
+            if(merge_ctrl & LV_TABLE_CELL_CTRL_MERGE_RIGHT) {
                 txt_w += table->col_w[col + col_merge + 1];
             }
             else {
@@ -935,26 +1088,17 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
             }
         }
 
-        lv_table_cell_ctrl_t ctrl = (lv_table_cell_ctrl_t) cell_data->ctrl;
+        /*Calculate the height of the cell text.
+         *Get the text only now as the callback might have overwritten it while checking the merged cells.*/
+        lv_point_t txt_size;
+        txt_w -= cell_left + cell_right;
 
-        /*When cropping the text we can assume the row height is equal to the line height*/
-        if(ctrl & LV_TABLE_CELL_CTRL_TEXT_CROP) {
-            h_max = LV_MAX(lv_font_get_line_height(font) + cell_top + cell_bottom,
-                           h_max);
-        }
-        /*Else we have to calculate the height of the cell text*/
-        else {
-            lv_point_t txt_size;
-            txt_w -= cell_left + cell_right;
+        lv_text_get_size(&txt_size, get_cell_txt(obj, row_id, col, NULL), font,
+                         letter_space, line_space, txt_w, LV_TEXT_FLAG_NONE);
 
-            lv_text_get_size(&txt_size, table->cell_data[cell]->txt, font,
-                             letter_space, line_space, txt_w, LV_TEXT_FLAG_NONE);
-
-            h_max = LV_MAX(txt_size.y + cell_top + cell_bottom, h_max);
-            /*Skip until one element after the last merged column*/
-            cell += col_merge;
-            col += col_merge;
-        }
+        h_max = LV_MAX(txt_size.y + cell_top + cell_bottom, h_max);
+        /*Skip until one element after the last merged column*/
+        col += col_merge;
     }
 
     return h_max;
@@ -999,13 +1143,8 @@ static lv_result_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint32_t * c
         y -= obj->coords.y1;
         y -= lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
 
-        *row = 0;
-        tmp = 0;
-
-        for(*row = 0; *row < table->row_cnt; (*row)++) {
-            tmp += table->row_h[*row];
-            if(y < tmp) break;
-        }
+        refr_row_heights(obj);
+        *row = get_row_at_y(table, y);
     }
 
     return LV_RESULT_OK;
@@ -1058,12 +1197,8 @@ static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t
         area->x2 = area->x1 + table->col_w[col] - 1;
     }
 
-    uint32_t r;
-    area->y1 = 0;
-    for(r = 0; r < row; r++) {
-        area->y1 += table->row_h[r];
-    }
-
+    refr_row_heights(obj);
+    area->y1 = get_row_y(table, row);
     area->y1 += lv_obj_get_style_pad_top(obj, 0);
     area->y1 -= lv_obj_get_scroll_y(obj);
     area->y2 = area->y1 + table->row_h[row] - 1;
@@ -1091,4 +1226,55 @@ static void scroll_to_selected_cell(lv_obj_t * obj)
     }
 
 }
+
+/**
+ * Get the text and control bits of a cell either from the stored cells or from the callback
+ * @param obj       pointer to a table
+ * @param row       id of the row
+ * @param col       id of the column
+ * @param ctrl      store the control bits here (can be NULL)
+ * @return          the text of the cell or NULL if the cell is empty
+ */
+static const char * get_cell_txt(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table_cell_ctrl_t * ctrl)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    lv_table_cell_ctrl_t cell_ctrl = 0;
+    const char * txt = NULL;
+
+    if(table->cell_value_cb) {
+        txt = table->cell_value_cb(obj, row, col, &cell_ctrl);
+    }
+    else {
+        lv_table_cell_t * cell = table->cell_data[row * table->col_cnt + col];
+        if(!is_cell_empty(cell)) {
+            txt = cell->txt;
+            cell_ctrl = cell->ctrl;
+        }
+    }
+
+    if(ctrl) *ctrl = txt ? cell_ctrl : 0;
+    return txt;
+}
+
+static void free_cells(lv_obj_t * obj)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_data == NULL) return;
+
+    /*Free the cell texts*/
+    uint32_t i;
+    for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
+        if(table->cell_data[i]) {
+            if(table->cell_data[i]->user_data) {
+                lv_free(table->cell_data[i]->user_data);
+                table->cell_data[i]->user_data = NULL;
+            }
+            lv_free(table->cell_data[i]);
+            table->cell_data[i] = NULL;
+        }
+    }
+
+    lv_free(table->cell_data);
+    table->cell_data = NULL;
+}
 #endif
@@ -55,6 +55,18 @@ typedef struct {
     char txt[1]; /**< Variable length array*/
 } lv_table_cell_t;
 
+/**
+ * Get the content of a cell on demand.
+ * @param table     pointer to a Table object
+ * @param row       id of the row [0 .. row_cnt -1]
+ * @param col       id of the column [0 .. col_cnt -1]
+ * @param ctrl      set the control bits of the cell here. It's 0 by default.
+ * @return          text of the cell or NULL if the cell is empty.
+ *                  It needs to remain valid only until the next call of the callback.
+ */
+typedef const char * (*lv_table_cell_value_cb_t)(lv_obj_t * table, uint32_t row, uint32_t col,
+                                                 lv_table_cell_ctrl_t * ctrl);
+
 /*Data of table*/
 typedef struct {
     lv_obj_t obj;
@@ -65,6 +77,12 @@ typedef struct {
     int32_t * col_w;
     uint32_t col_act;
     uint32_t row_act;
+    int32_t * row_y;                /**< Top of the rows: sum of the height of the previous rows.
+                                     *   `row_y[row_cnt]` is the height of the whole table*/
+    uint32_t row_y_valid;           /**< `row_y` is up to date until this row*/
+    uint32_t row_h_dirty_start;     /**< The height of the rows in [start, end) needs to be measured again*/
+    uint32_t row_h_dirty_end;
+    lv_table_cell_value_cb_t cell_value_cb;
 } lv_table_t;
 
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_table_class;
@@ -157,6 +175,24 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_tab
  */
 void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, void * user_data);
 
+/**
+ * Get the text and control bits of the cells from a callback instead of storing them in the table.
+ * Useful for very large tables whose data is available elsewhere anyway.
+ * The stored cells are deleted and the cell setter functions are ignored while the callback is set.
+ * @param obj       pointer to a Table object
+ * @param cb        the callback or NULL to store the cells in the table again (they will be empty)
+ * @note            the number of rows and columns still needs to be set
+ */
+void lv_table_set_cell_value_cb(lv_obj_t * obj, lv_table_cell_value_cb_t cb);
+
+/**
+ * Notify the table that the data of some rows has changed. Needed only when the cells are provided by a callback.
+ * @param obj       pointer to a Table object
+ * @param row       id of the first changed row
+ * @param cnt       number of changed rows
+ */
+void lv_table_refresh_rows(lv_obj_t * obj, uint32_t row, uint32_t cnt);
+
 /*=====================
  * Getter functions
  *====================*/
@@ -218,6 +254,13 @@ void lv_table_get_selected_cell(lv_obj_t * obj, uint32_t * row, uint32_t * col);
  */
 void * lv_table_get_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col);
 
+/**
+ * Get the callback which provides the cells.
+ * @param obj       pointer to a Table object
+ * @return          the callback or NULL if the cells are stored in the table
+ */
+lv_table_cell_value_cb_t lv_table_get_cell_value_cb(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
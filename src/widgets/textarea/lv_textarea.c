@@ -60,6 +60,7 @@ static void draw_placeholder(lv_event_t * e);
 static void draw_cursor(lv_event_t * e);
 static void auto_hide_characters(lv_obj_t * obj);
 static inline bool is_valid_but_non_printable_char(const uint32_t letter);
+static bool pwd_tmp_reserve(lv_obj_t * obj, size_t size);
 
 /**********************
  *  STATIC VARIABLES
@@ -152,11 +153,8 @@ void lv_textarea_add_char(lv_obj_t * obj, uint32_t c)
     lv_textarea_clear_selection(obj); /*Clear selection*/
 
     if(ta->pwd_mode) {
-        /*+2: the new char + \0*/
-        size_t realloc_size = lv_strlen(ta->pwd_tmp) + lv_strlen(letter_buf) + 1;
-        ta->pwd_tmp = lv_realloc(ta->pwd_tmp, realloc_size);
-        LV_ASSERT_MALLOC(ta->pwd_tmp);
-        if(ta->pwd_tmp == NULL) return;
+        /*+1: \0*/
+        if(!pwd_tmp_reserve(obj, lv_strlen(ta->pwd_tmp) + lv_strlen(letter_buf) + 1)) return;
 
         lv_text_ins(ta->pwd_tmp, ta->cursor.pos, (const char *)letter_buf);
 
@@ -203,10 +201,7 @@ void lv_textarea_add_text(lv_obj_t * obj, const char * txt)
     lv_textarea_clear_selection(obj);
 
     if(ta->pwd_mode) {
-        size_t realloc_size = lv_strlen(ta->pwd_tmp) + lv_strlen(txt) + 1;
-        ta->pwd_tmp = lv_realloc(ta->pwd_tmp, realloc_size);
-        LV_ASSERT_MALLOC(ta->pwd_tmp);
-        if(ta->pwd_tmp == NULL) return;
+        if(!pwd_tmp_reserve(obj, lv_strlen(ta->pwd_tmp) + lv_strlen(txt) + 1)) return;
 
         lv_text_ins(ta->pwd_tmp, ta->cursor.pos, txt);
 
@@ -234,13 +229,8 @@ void lv_textarea_delete_char(lv_obj_t * obj)
     lv_result_t res = insert_handler(obj, del_buf);
     if(res != LV_RESULT_OK) return;
 
-    char * label_txt = lv_label_get_text(ta->label);
-
     /*Delete a character*/
-    lv_text_cut(label_txt, ta->cursor.pos - 1, 1);
-
-    /*Refresh the label*/
-    lv_label_set_text(ta->label, label_txt);
+    lv_label_cut_text(ta->label, ta->cursor.pos - 1, 1);
     lv_textarea_clear_selection(obj);
 
     /*If the textarea became empty, invalidate it to hide the placeholder*/
@@ -251,10 +241,6 @@ void lv_textarea_delete_char(lv_obj_t * obj)
 
     if(ta->pwd_mode) {
         lv_text_cut(ta->pwd_tmp, ta->cursor.pos - 1, 1);
-
-        ta->pwd_tmp = lv_realloc(ta->pwd_tmp, lv_strlen(ta->pwd_tmp) + 1);
-        LV_ASSERT_MALLOC(ta->pwd_tmp);
-        if(ta->pwd_tmp == NULL) return;
     }
 
     /*Move the cursor to the place of the deleted character*/
@@ -316,6 +302,7 @@ void lv_textarea_set_text(lv_obj_t * obj, const char * txt)
         ta->pwd_tmp = lv_strdup(txt);
         LV_ASSERT_MALLOC(ta->pwd_tmp);
         if(ta->pwd_tmp == NULL) return;
+        ta->pwd_tmp_size = lv_strlen(ta->pwd_tmp) + 1;
 
         /*Auto hide characters*/
         auto_hide_characters(obj);
@@ -431,6 +418,7 @@ void lv_textarea_set_password_mode(lv_obj_t * obj, bool en)
         ta->pwd_tmp = lv_strdup(txt);
         LV_ASSERT_MALLOC(ta->pwd_tmp);
         if(ta->pwd_tmp == NULL) return;
+        ta->pwd_tmp_size = lv_strlen(ta->pwd_tmp) + 1;
 
         pwd_char_hider(obj);
 
@@ -442,6 +430,7 @@ void lv_textarea_set_password_mode(lv_obj_t * obj, bool en)
         lv_label_set_text(ta->label, ta->pwd_tmp);
         lv_free(ta->pwd_tmp);
         ta->pwd_tmp = NULL;
+        ta->pwd_tmp_size = 0;
     }
 
     refr_cursor_area(obj);
@@ -836,6 +825,7 @@ static void lv_textarea_constructor(const lv_obj_class_t * class_p, lv_obj_t * o
 
     ta->pwd_mode          = 0;
     ta->pwd_tmp           = NULL;
+    ta->pwd_tmp_size      = 0;
     ta->pwd_bullet        = NULL;
     ta->pwd_show_time     = LV_TEXTAREA_DEF_PWD_SHOW_TIME;
     ta->accepted_chars    = NULL;
@@ -874,6 +864,7 @@ static void lv_textarea_destructor(const lv_obj_class_t * class_p, lv_obj_t * ob
     if(ta->pwd_tmp != NULL) {
         lv_free(ta->pwd_tmp);
         ta->pwd_tmp = NULL;
+        ta->pwd_tmp_size = 0;
     }
     if(ta->pwd_bullet != NULL) {
         lv_free(ta->pwd_bullet);
@@ -942,8 +933,8 @@ static void label_event_cb(lv_event_t * e)
     lv_obj_t * label = lv_event_get_current_target(e);
     lv_obj_t * ta = lv_obj_get_parent(label);
 
+    /*The label refreshes its text itself*/
     if(code == LV_EVENT_STYLE_CHANGED || code == LV_EVENT_SIZE_CHANGED) {
-        lv_label_set_text(label, NULL);
         refr_cursor_area(ta);
         start_cursor_blink(ta);
     }
@@ -1394,4 +1385,26 @@ static inline bool is_valid_but_non_printable_char(const uint32_t letter)
     return false;
 }
 
+/**
+ * Make sure `pwd_tmp` can store `size` bytes. Allocate some more space to not reallocate it
+ * on every new character.
+ * @param obj   pointer to a text area object
+ * @param size  the required size in bytes
+ * @return      true: `pwd_tmp` is large enough; false: out of memory
+ */
+static bool pwd_tmp_reserve(lv_obj_t * obj, size_t size)
+{
+    lv_textarea_t * ta = (lv_textarea_t *)obj;
+    if(ta->pwd_tmp != NULL && ta->pwd_tmp_size >= size) return true;
+
+    size += size / 2;
+    char * pwd_tmp = lv_realloc(ta->pwd_tmp, size);
+    LV_ASSERT_MALLOC(pwd_tmp);
+    if(pwd_tmp == NULL) return false;
+
+    ta->pwd_tmp = pwd_tmp;
+    ta->pwd_tmp_size = size;
+    return true;
+}
+
 #endif
@@ -1,5 +1,7 @@
 #define LV_MEM_SIZE                     (32 * 1024 * 1024)
 #define LV_DRAW_SW_SHADOW_CACHE_SIZE    8
+#define LV_DRAW_SW_GLYPH_ATLAS_SIZE     128
+#define LV_DRAW_SW_VECTOR_CACHE_SIZE    (256 * 1024)
 #define LV_USE_LOG              1
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
 #define LV_LOG_PRINTF           1
@@ -45,6 +47,7 @@
 #define LV_USE_PERF_MONITOR         1
 #define LV_USE_MEM_MONITOR          1
 #define LV_LABEL_TEXT_SELECTION     1
+#define LV_USE_INDEV_HIT_INDEX      1
 
 #define LV_USE_LOTTIE 1
 
@@ -67,6 +70,8 @@
 #define LV_USE_TJPGD        1
 #define LV_USE_LIBJPEG_TURBO   1
 #define LV_USE_GIF          1
+#define LV_GIF_DECODE_ASYNC 1
+#define LV_GIF_CACHE_FRAMES 1
 #define LV_USE_QRCODE       1
 #define LV_USE_BARCODE      1
 #define LV_USE_FRAGMENT     1
@@ -78,12 +83,14 @@
 #define LV_USE_SYSMON           1
 #define LV_USE_SNAPSHOT         1
 #define LV_USE_THORVG_INTERNAL  1
+#define LV_THORVG_THREAD_CNT    2
 #define LV_USE_LZ4_INTERNAL     1
 #define LV_USE_VECTOR_GRAPHIC   1
 #define LV_USE_SVG              1
 #define LV_USE_SVG_DEBUG        1
 #define LV_USE_PROFILER         1
 #define LV_PROFILER_INCLUDE     "lv_profiler_builtin.h"
+#define LV_PROFILER_CACHE       1
 
 #define LV_BUILD_EXAMPLES       1
 #define LV_USE_DEMO_WIDGETS     1
@@ -103,6 +110,7 @@
 #define LV_USE_OBJ_PROPERTY     0
 
 #define LV_CACHE_DEF_SIZE       (10 * 1024 * 1024)
+#define LV_USE_IMAGE_DECODER_ASYNC  1
 
 #ifndef LV_USE_LINUX_DRM
     #define LV_USE_LINUX_DRM    1
@@ -150,4 +150,53 @@ void test_cache_1(void)
     TEST_ASSERT_EQUAL(40, lv_cache_get_free_size(cache, NULL));
 }
 
+static void add_entry(int32_t key, uint32_t size)
+{
+    test_data search_key = {
+        .slot.size = size,
+        .key1 = key,
+        .key2 = key + 1
+    };
+
+    lv_cache_entry_t * entry = lv_cache_add(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+
+    test_data * data = lv_cache_entry_get_data(entry);
+    data->data = lv_malloc(size);
+    lv_cache_release(cache, entry, NULL);
+}
+
+static bool contains_entry(int32_t key)
+{
+    test_data search_key = {
+        .key1 = key,
+        .key2 = key + 1
+    };
+
+    return lv_cache_contains(cache, &search_key, NULL);
+}
+
+void test_cache_contains(void)
+{
+    add_entry(1, 300);
+    add_entry(2, 300);
+    add_entry(3, 300);
+
+    uint32_t hit_cnt = lv_cache_get_hit_cnt(cache);
+    uint32_t miss_cnt = lv_cache_get_miss_cnt(cache);
+    TEST_ASSERT_TRUE(contains_entry(1));
+    TEST_ASSERT_FALSE(contains_entry(4));
+
+    /*Neither a hit nor a miss*/
+    TEST_ASSERT_EQUAL_UINT32(hit_cnt, lv_cache_get_hit_cnt(cache));
+    TEST_ASSERT_EQUAL_UINT32(miss_cnt, lv_cache_get_miss_cnt(cache));
+
+    /*The first entry is still the least recently used one, so it's evicted*/
+    add_entry(4, 300);
+    TEST_ASSERT_FALSE(contains_entry(1));
+    TEST_ASSERT_TRUE(contains_entry(2));
+    TEST_ASSERT_TRUE(contains_entry(3));
+    TEST_ASSERT_TRUE(contains_entry(4));
+}
+
 #endif
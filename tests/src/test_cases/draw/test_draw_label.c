@@ -122,4 +122,31 @@ void test_label_decor(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("draw/label_decor.png");
 }
 
+void test_draw_label_glyph_atlas_drop(void)
+{
+    all_labels_create("normal", NULL);
+
+    /*The glyphs are fetched from the fonts again*/
+    lv_draw_sw_glyph_atlas_drop();
+    lv_obj_invalidate(lv_screen_active());
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/label_normal.png");
+}
+
+void test_draw_label_glyph_atlas_full(void)
+{
+    /*More glyphs than fit into the atlas at once*/
+    const lv_font_t * fonts[] = {&lv_font_montserrat_28, &lv_font_montserrat_48};
+    uint32_t i;
+    for(i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        lv_obj_t * label = lv_label_create(lv_screen_active());
+        lv_label_set_text(label, "ABCDEFGHIJKLMNOPQRSTUVWXYZ\n"
+                          "abcdefghijklmnopqrstuvwxyz\n"
+                          "0123456789 ABCDEFGHIJ");
+        lv_obj_set_style_text_font(label, fonts[i], 0);
+        lv_obj_set_width(label, LV_PCT(100));
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/label_glyph_atlas_full.png");
+}
+
 #endif
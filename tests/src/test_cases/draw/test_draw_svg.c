@@ -690,6 +690,65 @@ void test_draw_svg(void)
     draw_snapshot(SNAPSHOT_NAME(svg_viewport_3));
     lv_svg_node_delete(svg);
 }
+
+static void draw_svg_transformed(lv_svg_node_t * svg, const lv_matrix_t * matrix)
+{
+    lv_image_cache_drop(canvas_buf);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+    lv_canvas_init_layer(canvas, &layer);
+    lv_draw_svg_transformed(&layer, svg, matrix);
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+static void assert_px(lv_color_t color, int32_t x, int32_t y)
+{
+    lv_color32_t px = lv_canvas_get_px(canvas, x, y);
+    TEST_ASSERT_UINT8_WITHIN(2, color.red, px.red);
+    TEST_ASSERT_UINT8_WITHIN(2, color.green, px.green);
+    TEST_ASSERT_UINT8_WITHIN(2, color.blue, px.blue);
+}
+
+void test_draw_svg_display_list(void)
+{
+    const char * svg_data = "<svg><rect x=\"0\" y=\"0\" width=\"50\" height=\"50\" fill=\"red\"/></svg>";
+    lv_svg_node_t * svg = lv_svg_load_data(svg_data, lv_strlen(svg_data));
+    TEST_ASSERT_NOT_EQUAL(NULL, svg);
+
+    lv_matrix_t matrix;
+    lv_matrix_identity(&matrix);
+    lv_matrix_translate(&matrix, 100, 100);
+
+    /*Drawing the same document and transformation again uses the kept paths*/
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        draw_svg_transformed(svg, &matrix);
+        assert_px(lv_color_hex(0xff0000), 110, 110);
+        assert_px(lv_color_white(), 10, 10);
+    }
+
+    /*Another transformation has its own paths*/
+    draw_svg_transformed(svg, NULL);
+    assert_px(lv_color_hex(0xff0000), 10, 10);
+    assert_px(lv_color_white(), 110, 110);
+
+    /*A modified document is built again after dropping the cache*/
+    lv_svg_node_t * rect = LV_SVG_NODE_CHILD(svg, 0);
+    lv_svg_attr_t * attr = NULL;
+    uint32_t j;
+    for(j = 0; j < lv_array_size(&rect->attrs); j++) {
+        attr = lv_array_at(&rect->attrs, j);
+        if(attr->id == LV_SVG_ATTR_WIDTH) break;
+    }
+    TEST_ASSERT_EQUAL(LV_SVG_ATTR_WIDTH, attr->id);
+    attr->value.fval = 20;
+    lv_draw_svg_cache_drop();
+
+    draw_svg_transformed(svg, &matrix);
+    assert_px(lv_color_hex(0xff0000), 110, 110);
+    assert_px(lv_color_white(), 130, 110);
+
+    lv_svg_node_delete(svg);
+}
 #else
 
 void test_draw_svg(void)
@@ -303,4 +303,84 @@ void test_draw_shapes(void)
 {
     canvas_draw("draw_shapes", draw_shapes);
 }
+
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+static void draw_cached_rect(lv_obj_t * canvas, float x, lv_color_t color, lv_opa_t opa)
+{
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_vector_dsc_t * ctx = lv_vector_dsc_create(&layer);
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+    lv_fpoint_t pts[] = {{x, 10}, {x + 30, 10}, {x + 30, 40}, {x, 40}};
+    lv_vector_path_move_to(path, &pts[0]);
+    lv_vector_path_line_to(path, &pts[1]);
+    lv_vector_path_line_to(path, &pts[2]);
+    lv_vector_path_line_to(path, &pts[3]);
+    lv_vector_path_close(path);
+
+    lv_vector_dsc_set_fill_color(ctx, color);
+    lv_vector_dsc_set_fill_opa(ctx, opa);
+    lv_vector_dsc_set_stroke_color(ctx, lv_color_black());
+    lv_vector_dsc_set_stroke_opa(ctx, opa);
+    lv_vector_dsc_set_stroke_width(ctx, 4.0f);
+    lv_vector_dsc_add_path(ctx, path);
+    lv_draw_vector(ctx);
+
+    lv_vector_path_delete(path);
+    lv_vector_dsc_delete(ctx);
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+static void assert_px(lv_obj_t * canvas, int32_t x, int32_t y, uint32_t hex)
+{
+    lv_color32_t px = lv_canvas_get_px(canvas, x, y);
+    lv_color_t expected = lv_color_hex(hex);
+    TEST_ASSERT_UINT8_WITHIN(2, expected.red, px.red);
+    TEST_ASSERT_UINT8_WITHIN(2, expected.green, px.green);
+    TEST_ASSERT_UINT8_WITHIN(2, expected.blue, px.blue);
+}
+
+void test_draw_cached_path(void)
+{
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->sw_vector_cache;
+    lv_draw_sw_vector_cache_drop();
+
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(100, 60, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    TEST_ASSERT_NOT_NULL(draw_buf);
+    lv_canvas_set_draw_buf(canvas, draw_buf);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+
+    /*The coverage of the fill and the stroke are cached*/
+    uint32_t miss_cnt = lv_cache_get_miss_cnt(cache);
+    uint32_t hit_cnt = lv_cache_get_hit_cnt(cache);
+    draw_cached_rect(canvas, 10, lv_color_hex(0xff0000), LV_OPA_COVER);
+    TEST_ASSERT_EQUAL_UINT32(miss_cnt + 2, lv_cache_get_miss_cnt(cache));
+    assert_px(canvas, 25, 25, 0xff0000);
+    assert_px(canvas, 10, 25, 0x000000);
+    assert_px(canvas, 50, 25, 0xffffff);
+
+    /*Only the color and the opacity are changed, so the cached coverage is blended*/
+    draw_cached_rect(canvas, 10, lv_color_hex(0x0000ff), LV_OPA_50);
+    TEST_ASSERT_EQUAL_UINT32(miss_cnt + 2, lv_cache_get_miss_cnt(cache));
+    TEST_ASSERT_EQUAL_UINT32(hit_cnt + 2, lv_cache_get_hit_cnt(cache));
+    assert_px(canvas, 25, 25, 0x800080);
+    assert_px(canvas, 10, 25, 0x000040);
+
+    /*Other points are another path*/
+    draw_cached_rect(canvas, 50, lv_color_hex(0x00ff00), LV_OPA_COVER);
+    TEST_ASSERT_EQUAL_UINT32(miss_cnt + 4, lv_cache_get_miss_cnt(cache));
+    assert_px(canvas, 65, 25, 0x00ff00);
+    assert_px(canvas, 50, 25, 0x000000);
+    assert_px(canvas, 25, 25, 0x800080);
+
+    lv_draw_sw_vector_cache_drop();
+    TEST_ASSERT_EQUAL_UINT32(0, lv_cache_get_size(cache, NULL));
+
+    lv_image_cache_drop(draw_buf);
+    lv_draw_buf_destroy(draw_buf);
+    lv_obj_delete(canvas);
+}
+#endif
 #endif
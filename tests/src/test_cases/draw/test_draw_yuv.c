@@ -0,0 +1,204 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define IMG_W       8
+#define IMG_H       4
+#define CANVAS_W    40
+#define CANVAS_H    20
+
+/*BT.601 limited range samples of red and blue*/
+#define RED_Y   81
+#define RED_U   90
+#define RED_V   240
+#define BLUE_Y  41
+#define BLUE_U  240
+#define BLUE_V  110
+
+static lv_obj_t * canvas;
+static lv_draw_buf_t * canvas_buf;
+
+/*The left half of the images is red, the right half is blue*/
+static uint8_t y_plane[IMG_W * IMG_H];
+static uint8_t u_plane[IMG_W * IMG_H];
+static uint8_t v_plane[IMG_W * IMG_H];
+static uint8_t uv_plane[IMG_W * IMG_H * 2];
+static uint8_t packed[IMG_W * IMG_H * 2];
+static lv_yuv_buf_t yuv_buf;
+static lv_image_dsc_t img_dsc;
+
+void setUp(void)
+{
+    canvas_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_XRGB8888, LV_STRIDE_AUTO);
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, canvas_buf);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_draw_buf_destroy(canvas_buf);
+}
+
+static void make_image(lv_color_format_t cf)
+{
+    lv_memzero(&img_dsc, sizeof(img_dsc));
+    img_dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    img_dsc.header.cf = cf;
+    img_dsc.header.w = IMG_W;
+    img_dsc.header.h = IMG_H;
+    img_dsc.data = (const uint8_t *)&yuv_buf;
+    img_dsc.data_size = sizeof(yuv_buf);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            bool red = x < IMG_W / 2;
+            y_plane[y * IMG_W + x] = red ? RED_Y : BLUE_Y;
+        }
+    }
+
+    /*Chroma planes with the size of the Y plane, only the needed part is used*/
+    int32_t uv_w = cf == LV_COLOR_FORMAT_I444 ? IMG_W : IMG_W / 2;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < uv_w; x++) {
+            bool red = x < uv_w / 2;
+            u_plane[y * uv_w + x] = red ? RED_U : BLUE_U;
+            v_plane[y * uv_w + x] = red ? RED_V : BLUE_V;
+            uv_plane[y * IMG_W + x * 2] = cf == LV_COLOR_FORMAT_NV21 ? v_plane[y * uv_w + x] : u_plane[y * uv_w + x];
+            uv_plane[y * IMG_W + x * 2 + 1] = cf == LV_COLOR_FORMAT_NV21 ? u_plane[y * uv_w + x] : v_plane[y * uv_w + x];
+        }
+    }
+
+    if(cf == LV_COLOR_FORMAT_NV12 || cf == LV_COLOR_FORMAT_NV21) {
+        yuv_buf.semi_planar.y.buf = y_plane;
+        yuv_buf.semi_planar.y.stride = IMG_W;
+        yuv_buf.semi_planar.uv.buf = uv_plane;
+        yuv_buf.semi_planar.uv.stride = IMG_W;
+    }
+    else if(cf == LV_COLOR_FORMAT_YUY2 || cf == LV_COLOR_FORMAT_UYVY) {
+        for(y = 0; y < IMG_H; y++) {
+            for(x = 0; x < IMG_W; x += 2) {
+                uint8_t * px = &packed[y * IMG_W * 2 + x * 2];
+                bool red = x < IMG_W / 2;
+                uint8_t yuyv[4] = {red ? RED_Y : BLUE_Y, red ? RED_U : BLUE_U, red ? RED_Y : BLUE_Y, red ? RED_V : BLUE_V};
+                if(cf == LV_COLOR_FORMAT_YUY2) lv_memcpy(px, yuyv, 4);
+                else {
+                    px[0] = yuyv[1];
+                    px[1] = yuyv[0];
+                    px[2] = yuyv[3];
+                    px[3] = yuyv[2];
+                }
+            }
+        }
+        img_dsc.header.stride = IMG_W * 2;
+        img_dsc.data = packed;
+        img_dsc.data_size = sizeof(packed);
+    }
+    else {
+        yuv_buf.planar.y.buf = y_plane;
+        yuv_buf.planar.y.stride = IMG_W;
+        yuv_buf.planar.u.buf = u_plane;
+        yuv_buf.planar.u.stride = uv_w;
+        yuv_buf.planar.v.buf = v_plane;
+        yuv_buf.planar.v.stride = uv_w;
+    }
+}
+
+static void draw_image(int32_t x, int32_t y, int32_t scale)
+{
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.src = &img_dsc;
+    dsc.scale_x = scale;
+    dsc.scale_y = scale;
+    dsc.pivot.x = 0;
+    dsc.pivot.y = 0;
+
+    lv_area_t area = {x, y, x + IMG_W - 1, y + IMG_H - 1};
+    lv_draw_image(&layer, &dsc, &area);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_image_cache_drop(&img_dsc);
+}
+
+static void assert_color(uint32_t hex, int32_t x, int32_t y)
+{
+    lv_color32_t px = lv_canvas_get_px(canvas, x, y);
+    lv_color_t expected = lv_color_hex(hex);
+    TEST_ASSERT_UINT8_WITHIN(2, expected.red, px.red);
+    TEST_ASSERT_UINT8_WITHIN(2, expected.green, px.green);
+    TEST_ASSERT_UINT8_WITHIN(2, expected.blue, px.blue);
+}
+
+static void check_format(lv_color_format_t cf)
+{
+    make_image(cf);
+    draw_image(2, 3, LV_SCALE_NONE);
+
+    uint32_t red = cf == LV_COLOR_FORMAT_I400 ? 0x4c4c4c : 0xff0000;
+    uint32_t blue = cf == LV_COLOR_FORMAT_I400 ? 0x1d1d1d : 0x0000ff;
+
+    int32_t y;
+    for(y = 0; y < IMG_H; y++) {
+        assert_color(red, 2, 3 + y);
+        assert_color(red, 2 + IMG_W / 2 - 1, 3 + y);
+        assert_color(blue, 2 + IMG_W / 2, 3 + y);
+        assert_color(blue, 2 + IMG_W - 1, 3 + y);
+    }
+
+    /*Outside of the image*/
+    assert_color(0x000000, 1, 3);
+    assert_color(0x000000, 2 + IMG_W, 3);
+    assert_color(0x000000, 2, 3 + IMG_H);
+}
+
+void test_draw_yuv_planar(void)
+{
+    check_format(LV_COLOR_FORMAT_I420);
+    check_format(LV_COLOR_FORMAT_I422);
+    check_format(LV_COLOR_FORMAT_I444);
+    check_format(LV_COLOR_FORMAT_I400);
+}
+
+void test_draw_yuv_semi_planar(void)
+{
+    check_format(LV_COLOR_FORMAT_NV12);
+    check_format(LV_COLOR_FORMAT_NV21);
+}
+
+void test_draw_yuv_packed(void)
+{
+    check_format(LV_COLOR_FORMAT_YUY2);
+    check_format(LV_COLOR_FORMAT_UYVY);
+}
+
+void test_draw_yuv_clipped(void)
+{
+    make_image(LV_COLOR_FORMAT_I420);
+
+    /*Only the right part is visible, so the conversion starts in the middle of a chroma sample*/
+    draw_image(-5, 0, LV_SCALE_NONE);
+
+    assert_color(0x0000ff, 0, 0);
+    assert_color(0x0000ff, 2, IMG_H - 1);
+    assert_color(0x000000, 3, 0);
+}
+
+void test_draw_yuv_scaled(void)
+{
+    make_image(LV_COLOR_FORMAT_NV12);
+    draw_image(0, 0, LV_SCALE_NONE * 2);
+
+    assert_color(0xff0000, 2, 2);
+    assert_color(0x0000ff, IMG_W * 2 - 3, IMG_H * 2 - 3);
+    assert_color(0x000000, IMG_W * 2 + 1, 0);
+}
+
+#endif
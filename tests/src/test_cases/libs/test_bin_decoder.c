@@ -88,4 +88,54 @@ void test_bin_decoder_argb8888_tile(void)
     bin_decoder_tile(&test_image_cogwheel_argb8888, "libs/bin_decoder_4.png");
 }
 
+#define BLOCKS_SRC "A:src/test_files/rle_compressed/cogwheel.ARGB8888.blocks.bin"
+
+#if LV_BIN_DECODER_RAM_LOAD
+void test_bin_decoder_compressed_blocks(void)
+{
+    /*Small images are decompressed at once*/
+    bin_decoder(BLOCKS_SRC, "libs/bin_decoder_3.png");
+    TEST_ASSERT_TRUE(lv_image_cache_is_cached(BLOCKS_SRC));
+    lv_image_cache_drop(BLOCKS_SRC);
+}
+#endif
+
+void test_bin_decoder_compressed_blocks_in_bands(void)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+
+    /*The image is larger than the band cache, so only the blocks to draw are decompressed*/
+    uint32_t band_cache_size = lv_image_band_cache_get_size();
+    lv_image_band_cache_resize(8 * 1024, true);
+
+    bin_decoder(BLOCKS_SRC, "libs/bin_decoder_3.png");
+    TEST_ASSERT_FALSE(lv_image_cache_is_cached(BLOCKS_SRC));
+
+    lv_image_decoder_dsc_t dsc;
+    lv_image_decoder_args_t args = { .allow_partial = true };
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, BLOCKS_SRC, &args));
+    TEST_ASSERT_NULL(dsc.decoded);
+
+    /*The band is aligned to the blocks of 8 rows*/
+    lv_area_t full_area = {0, 42, 99, 45};
+    lv_area_t decoded_area = {LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN};
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_area(&dsc, &full_area, &decoded_area));
+    TEST_ASSERT_EQUAL_INT32(0, decoded_area.x1);
+    TEST_ASSERT_EQUAL_INT32(99, decoded_area.x2);
+    TEST_ASSERT_EQUAL_INT32(40, decoded_area.y1);
+    TEST_ASSERT_EQUAL_INT32(47, decoded_area.y2);
+
+    int32_t y;
+    for(y = decoded_area.y1; y <= decoded_area.y2; y++) {
+        TEST_ASSERT_EQUAL_MEMORY(test_image_cogwheel_argb8888.data + y * 400,
+                                 dsc.decoded->data + (y - decoded_area.y1) * dsc.decoded->header.stride, 400);
+    }
+
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_get_area(&dsc, &full_area, &decoded_area));
+    lv_image_decoder_close(&dsc);
+
+    lv_image_cache_drop(BLOCKS_SRC);
+    lv_image_band_cache_resize(band_cache_size, true);
+}
+
 #endif
@@ -510,6 +510,72 @@ void test_freetype_outline_rendering_test(void)
     lv_freetype_font_delete(font_italic);
 }
 
+#define TEST_FREETYPE_CACHE_FONT_PATH "../src/libs/freetype/arial.ttf"
+
+void test_freetype_image_cache_is_shared_by_sizes(void)
+{
+    static const uint32_t sizes[] = {12, 16, 20, 24, 32, 40, 48, 64};
+    lv_font_t * fonts[sizeof(sizes) / sizeof(sizes[0])];
+    lv_cache_t * cache = lv_freetype_get_image_cache();
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_EQUAL_UINT32(LV_FREETYPE_CACHE_SIZE, lv_cache_get_max_size(cache, NULL));
+
+    uint32_t i;
+    for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        fonts[i] = lv_freetype_font_create(TEST_FREETYPE_CACHE_FONT_PATH,
+                                           LV_FREETYPE_FONT_RENDER_MODE_BITMAP,
+                                           sizes[i],
+                                           LV_FREETYPE_FONT_STYLE_NORMAL);
+        TEST_ASSERT_NOT_NULL(fonts[i]);
+        TEST_ASSERT_EQUAL_UINT32(11, lv_freetype_font_warm_up(fonts[i], "0123456789 "));
+
+        /*The bitmaps of all the sizes are counted in the same budget*/
+        TEST_ASSERT_GREATER_THAN(0, lv_cache_get_size(cache, NULL));
+        TEST_ASSERT_LESS_OR_EQUAL(LV_FREETYPE_CACHE_SIZE, lv_cache_get_size(cache, NULL));
+    }
+
+    /*The glyphs of the smallest font are evicted first by the larger ones*/
+    uint32_t miss_cnt = lv_cache_get_miss_cnt(cache);
+    lv_freetype_font_warm_up(fonts[0], "0");
+    TEST_ASSERT_EQUAL_UINT32(miss_cnt + 1, lv_cache_get_miss_cnt(cache));
+
+    for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        lv_freetype_font_delete(fonts[i]);
+    }
+}
+
+void test_freetype_warm_up(void)
+{
+    lv_font_t * font = lv_freetype_font_create(TEST_FREETYPE_CACHE_FONT_PATH,
+                                               LV_FREETYPE_FONT_RENDER_MODE_BITMAP,
+                                               30,
+                                               LV_FREETYPE_FONT_STYLE_NORMAL);
+    TEST_ASSERT_NOT_NULL(font);
+
+    lv_cache_t * glyph_cache = lv_freetype_get_glyph_cache();
+    lv_cache_t * image_cache = lv_freetype_get_image_cache();
+
+    /*U+E000 is not in the font*/
+    TEST_ASSERT_EQUAL_UINT32(4, lv_freetype_font_warm_up(font, "12:3\xee\x80\x80"));
+
+    uint32_t glyph_miss_cnt = lv_cache_get_miss_cnt(glyph_cache);
+    uint32_t image_miss_cnt = lv_cache_get_miss_cnt(image_cache);
+    uint32_t image_hit_cnt = lv_cache_get_hit_cnt(image_cache);
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, "12:32");
+    lv_refr_now(NULL);
+
+    /*Everything was already rendered*/
+    TEST_ASSERT_EQUAL_UINT32(glyph_miss_cnt, lv_cache_get_miss_cnt(glyph_cache));
+    TEST_ASSERT_EQUAL_UINT32(image_miss_cnt, lv_cache_get_miss_cnt(image_cache));
+    TEST_ASSERT_GREATER_THAN(image_hit_cnt, lv_cache_get_hit_cnt(image_cache));
+
+    lv_obj_delete(label);
+    lv_freetype_font_delete(font);
+}
+
 static void freetype_outline_event_cb(lv_event_t * e)
 {
     lv_event_code_t code = lv_event_get_code(e);
@@ -586,6 +652,14 @@ void test_freetype_outline_rendering_test(void)
 {
 }
 
+void test_freetype_image_cache_is_shared_by_sizes(void)
+{
+}
+
+void test_freetype_warm_up(void)
+{
+}
+
 #endif /*LV_USE_FREETYPE*/
 
 #endif
@@ -0,0 +1,192 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <unistd.h>
+
+#define GIF_PATH "A:../examples/libs/gif/bulb.gif"
+
+/*The second frame of the bulb changes only this rectangle*/
+#define FRAME_2_X   25
+#define FRAME_2_Y   51
+#define FRAME_2_W   4
+#define FRAME_2_H   2
+
+static lv_obj_t * gif;
+static lv_area_t inv_area;
+static uint32_t inv_cnt;
+
+static void invalidate_area_cb(lv_event_t * e)
+{
+    const lv_area_t * area = lv_event_get_param(e);
+    if(gif == NULL || !_lv_area_is_in(area, &gif->coords, 0)) return;
+
+    if(inv_cnt == 0) inv_area = *area;
+    else _lv_area_join(&inv_area, &inv_area, area);
+    inv_cnt++;
+}
+
+void setUp(void)
+{
+    lv_display_add_event_cb(lv_display_get_default(), invalidate_area_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+}
+
+void tearDown(void)
+{
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), invalidate_area_cb, NULL);
+    lv_obj_clean(lv_screen_active());
+    gif = NULL;
+}
+
+static void wait_next_frame(void)
+{
+    inv_cnt = 0;
+
+    uint32_t i;
+    for(i = 0; i < 1000 && inv_cnt == 0; i++) {
+        /*Let the decoder thread work*/
+        usleep(1000);
+        lv_test_wait(10);
+    }
+    TEST_ASSERT_NOT_EQUAL(0, inv_cnt);
+}
+
+/**
+ * Show the first frame and wait until the second frame is applied
+ */
+static void show_second_frame(void)
+{
+    lv_gif_set_src(gif, GIF_PATH);
+    lv_test_wait(0);
+    wait_next_frame();
+}
+
+void test_gif_invalidates_only_the_changed_area(void)
+{
+    gif = lv_gif_create(lv_screen_active());
+    lv_obj_center(gif);
+
+    show_second_frame();
+
+    lv_area_t expected;
+    lv_area_set(&expected, FRAME_2_X, FRAME_2_Y, FRAME_2_X + FRAME_2_W - 1, FRAME_2_Y + FRAME_2_H - 1);
+    lv_area_move(&expected, gif->coords.x1, gif->coords.y1);
+
+    /*`lv_obj_invalidate_area()` might add 1 px on the right and bottom*/
+    TEST_ASSERT_EQUAL_INT32(expected.x1, inv_area.x1);
+    TEST_ASSERT_EQUAL_INT32(expected.y1, inv_area.y1);
+    TEST_ASSERT_INT32_WITHIN(1, expected.x2, inv_area.x2);
+    TEST_ASSERT_INT32_WITHIN(1, expected.y2, inv_area.y2);
+    TEST_ASSERT_TRUE(_lv_area_is_in(&expected, &inv_area, 0));
+}
+
+void test_gif_invalidates_the_transformed_area(void)
+{
+    gif = lv_gif_create(lv_screen_active());
+    lv_obj_center(gif);
+    lv_image_set_scale(gif, 512);
+
+    show_second_frame();
+
+    lv_area_t frame_area;
+    lv_area_set(&frame_area, FRAME_2_X, FRAME_2_Y, FRAME_2_X + FRAME_2_W - 1, FRAME_2_Y + FRAME_2_H - 1);
+    lv_area_move(&frame_area, gif->coords.x1, gif->coords.y1);
+
+    TEST_ASSERT_GREATER_THAN(lv_area_get_size(&frame_area), lv_area_get_size(&inv_area));
+    TEST_ASSERT_LESS_THAN(lv_area_get_size(&gif->coords), lv_area_get_size(&inv_area));
+}
+
+void test_gif_keeps_playing_after_restart(void)
+{
+    gif = lv_gif_create(lv_screen_active());
+    lv_obj_center(gif);
+
+    show_second_frame();
+    lv_gif_restart(gif);
+    wait_next_frame();
+
+    /*Deleting while a frame is decoded must be safe*/
+    lv_obj_delete(gif);
+    gif = NULL;
+}
+
+#define PLAYED_FRAME_CNT 12
+
+typedef struct {
+    uint32_t hash;
+    const void * data;
+} played_frame_t;
+
+/**
+ * Play the first frames of the bulb and store their content and buffer
+ * @param frames        store the frames here
+ * @param drop_cache_at drop the image cache before this frame
+ */
+static void play_frames(played_frame_t * frames, uint32_t drop_cache_at)
+{
+    gif = lv_gif_create(lv_screen_active());
+    lv_gif_set_src(gif, GIF_PATH);
+    lv_test_wait(0);
+
+    uint32_t i;
+    for(i = 0; i < PLAYED_FRAME_CNT; i++) {
+        if(i > 0) {
+            if(i == drop_cache_at) lv_image_cache_drop(NULL);
+            wait_next_frame();
+        }
+
+        const lv_image_dsc_t * dsc = lv_image_get_src(gif);
+        uint32_t hash = 2166136261u;
+        uint32_t j;
+        for(j = 0; j < dsc->header.w * dsc->header.h * 4; j++) {
+            hash = (hash ^ dsc->data[j]) * 16777619u;
+        }
+        frames[i].hash = hash;
+        frames[i].data = dsc->data;
+    }
+
+    lv_obj_delete(gif);
+    gif = NULL;
+}
+
+void test_gif_cached_frames_are_the_decoded_frames(void)
+{
+    played_frame_t cached[PLAYED_FRAME_CNT];
+    played_frame_t decoded[PLAYED_FRAME_CNT];
+
+    play_frames(cached, 0);
+
+    /*All frames don't fit into a small cache, so they are decoded one by one*/
+    uint32_t cache_size = lv_image_cache_get_size();
+    lv_image_cache_resize(60 * 80 * 4 * 2, true);
+    play_frames(decoded, 0);
+    lv_image_cache_resize(cache_size, true);
+
+    uint32_t i;
+    for(i = 0; i < PLAYED_FRAME_CNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(decoded[i].hash, cached[i].hash);
+    }
+
+    /*The cached frames are shown without copying them*/
+    TEST_ASSERT_TRUE(cached[0].data != cached[1].data);
+    TEST_ASSERT_TRUE(decoded[0].data == decoded[1].data);
+}
+
+void test_gif_continues_after_the_cached_frames_are_evicted(void)
+{
+    played_frame_t cached[PLAYED_FRAME_CNT];
+    played_frame_t evicted[PLAYED_FRAME_CNT];
+
+    play_frames(cached, 0);
+    play_frames(evicted, PLAYED_FRAME_CNT / 2);
+
+    uint32_t i;
+    for(i = 0; i < PLAYED_FRAME_CNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(cached[i].hash, evicted[i].hash);
+    }
+
+    /*The frames are decoded into the same buffer after the eviction*/
+    TEST_ASSERT_TRUE(evicted[PLAYED_FRAME_CNT - 2].data == evicted[PLAYED_FRAME_CNT - 1].data);
+}
+
+#endif
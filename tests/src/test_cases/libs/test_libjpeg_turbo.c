@@ -79,4 +79,177 @@ void test_jpg_2(void)
     lv_tjpgd_init();
 }
 
+void test_jpg_bands(void)
+{
+    /* Temporarily remove tjpgd decoder */
+    lv_tjpgd_deinit();
+    lv_image_cache_drop(NULL);
+
+    /* Make the band cache smaller than the images to decode them in bands.
+     * The images with Exif orientation are still decoded entirely.*/
+    uint32_t band_cache_size = lv_image_band_cache_get_size();
+    lv_image_band_cache_resize(8 * 1024, true);
+
+    create_images();
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/jpg_2.png");
+    TEST_ASSERT_FALSE(lv_image_cache_is_cached("A:src/test_assets/test_img_lvgl_logo.jpg"));
+    TEST_ASSERT_TRUE(lv_image_cache_is_cached("A:src/test_assets/test_img_lvgl_logo_with_exif_orientation_90.jpg"));
+
+    size_t mem_before = lv_test_get_free_mem();
+    for(uint32_t i = 0; i < 20; i++) {
+        create_images();
+
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/jpg_2.png");
+
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 64);
+
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+    lv_image_band_cache_resize(band_cache_size, true);
+
+    /* Re-add tjpgd decoder */
+    lv_tjpgd_init();
+}
+
+void test_jpg_scaled(void)
+{
+    lv_tjpgd_deinit();
+    lv_image_cache_drop(NULL);
+
+    const char * src = "A:src/test_assets/test_img_lvgl_logo.jpg";
+    const char * src_90 = "A:src/test_assets/test_img_lvgl_logo_with_exif_orientation_90.jpg";
+    lv_image_header_t header;
+
+    /*105x33 is scaled by 1/4 to still cover 16x8*/
+    lv_image_decoder_args_t args = { .target_w = 16, .target_h = 8 };
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_info_with_args(src, &args, &header));
+    TEST_ASSERT_EQUAL_UINT32(27, header.w);
+    TEST_ASSERT_EQUAL_UINT32(9, header.h);
+
+    /*The rotated image needs to be 8 px wide before the rotation, so it's scaled only by 1/2*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_info_with_args(src_90, &args, &header));
+    TEST_ASSERT_EQUAL_UINT32(17, header.w);
+    TEST_ASSERT_EQUAL_UINT32(53, header.h);
+
+    /*The header cache keeps the full size too*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_info(src, &header));
+    TEST_ASSERT_EQUAL_UINT32(105, header.w);
+    TEST_ASSERT_EQUAL_UINT32(33, header.h);
+
+    /*The image decoded for a target size and with full resolution are cached separately*/
+    lv_image_decoder_dsc_t scaled_dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&scaled_dsc, src, &args));
+    TEST_ASSERT_EQUAL_UINT32(27, scaled_dsc.decoded->header.w);
+    TEST_ASSERT_EQUAL_UINT32(9, scaled_dsc.decoded->header.h);
+
+    lv_image_decoder_dsc_t full_dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&full_dsc, src, NULL));
+    TEST_ASSERT_EQUAL_UINT32(105, full_dsc.decoded->header.w);
+    TEST_ASSERT_EQUAL_UINT32(33, full_dsc.decoded->header.h);
+    TEST_ASSERT_NOT_NULL(scaled_dsc.cache_entry);
+    TEST_ASSERT_NOT_NULL(full_dsc.cache_entry);
+    TEST_ASSERT_NOT_EQUAL(scaled_dsc.cache_entry, full_dsc.cache_entry);
+    lv_image_decoder_close(&full_dsc);
+    lv_image_decoder_close(&scaled_dsc);
+
+    /*Dropping the image drops all of its sizes*/
+    TEST_ASSERT_TRUE(lv_image_cache_is_cached(src));
+    lv_image_cache_drop(src);
+    TEST_ASSERT_FALSE(lv_image_cache_is_cached(src));
+
+    lv_tjpgd_init();
+}
+
+void test_jpg_decode_size(void)
+{
+    lv_tjpgd_deinit();
+    lv_image_cache_drop(NULL);
+
+    const char * src = "A:src/test_assets/test_img_lvgl_logo.jpg";
+
+    /*Two images with the same source don't get each other's size*/
+    lv_obj_t * thumbnail = lv_image_create(lv_screen_active());
+    lv_image_set_decode_size(thumbnail, 16, 8);
+    lv_image_set_src(thumbnail, src);
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, src);
+    lv_obj_align(img, LV_ALIGN_CENTER, 0, 0);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_INT32(16, lv_image_get_decode_width(thumbnail));
+    TEST_ASSERT_EQUAL_INT32(8, lv_image_get_decode_height(thumbnail));
+    TEST_ASSERT_EQUAL_INT32(27, lv_obj_get_width(thumbnail));
+    TEST_ASSERT_EQUAL_INT32(9, lv_obj_get_height(thumbnail));
+    TEST_ASSERT_EQUAL_INT32(105, lv_obj_get_width(img));
+    TEST_ASSERT_EQUAL_INT32(33, lv_obj_get_height(img));
+
+    /*Back to the full resolution*/
+    lv_image_set_decode_size(thumbnail, 0, 0);
+    lv_obj_update_layout(thumbnail);
+    TEST_ASSERT_EQUAL_INT32(105, lv_obj_get_width(thumbnail));
+    TEST_ASSERT_EQUAL_INT32(33, lv_obj_get_height(thumbnail));
+
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+    lv_tjpgd_init();
+}
+
+void test_jpg_bands_are_cropped(void)
+{
+    lv_tjpgd_deinit();
+    lv_image_cache_drop(NULL);
+
+    uint32_t band_cache_size = lv_image_band_cache_get_size();
+    lv_image_band_cache_resize(8 * 1024, true);
+
+    const char * src = "A:src/test_assets/test_img_lvgl_logo.jpg";
+    lv_image_decoder_dsc_t full_dsc;
+    lv_image_decoder_args_t args = { .no_cache = true };
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&full_dsc, src, &args));
+    const lv_draw_buf_t * full = full_dsc.decoded;
+
+    lv_image_decoder_dsc_t dsc;
+    args.allow_partial = true;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, src, &args));
+
+    lv_area_t full_area = {40, 0, 60, 32};
+    lv_area_t decoded_area = {LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN};
+    int32_t decoded_h = 0;
+    while(lv_image_decoder_get_area(&dsc, &full_area, &decoded_area) == LV_RESULT_OK) {
+        const lv_draw_buf_t * band = dsc.decoded;
+
+        /*Only the aligned columns of the area are decoded*/
+        TEST_ASSERT_EQUAL_INT32(32, decoded_area.x1);
+        TEST_ASSERT_EQUAL_INT32(63, decoded_area.x2);
+        TEST_ASSERT_EQUAL_UINT32(32, band->header.w);
+
+        int32_t x;
+        int32_t y;
+        for(y = decoded_area.y1; y <= decoded_area.y2; y++) {
+            const uint8_t * band_row = band->data + (y - decoded_area.y1) * band->header.stride;
+            const uint8_t * full_row = full->data + y * full->header.stride;
+            for(x = full_area.x1; x <= full_area.x2; x++) {
+                TEST_ASSERT_EQUAL_MEMORY(full_row + x * 4, band_row + (x - decoded_area.x1) * 4, 3);
+            }
+        }
+
+        decoded_h += lv_area_get_height(&decoded_area);
+    }
+
+    TEST_ASSERT_EQUAL_INT32(33, decoded_h);
+
+    lv_image_decoder_close(&dsc);
+    lv_image_decoder_close(&full_dsc);
+
+    lv_image_cache_drop(NULL);
+    lv_image_band_cache_resize(band_cache_size, true);
+
+    lv_tjpgd_init();
+}
+
 #endif
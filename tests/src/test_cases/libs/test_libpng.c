@@ -50,4 +50,59 @@ void test_libpng_1(void)
     lv_lodepng_init();
 }
 
+void test_libpng_bands(void)
+{
+    /* Temporarily remove lodepng decoder */
+    lv_lodepng_deinit();
+    lv_image_cache_drop(NULL);
+
+    /* Make the band cache smaller than the image to decode it in bands */
+    uint32_t band_cache_size = lv_image_band_cache_get_size();
+    lv_image_band_cache_resize(4 * 1024, true);
+
+    create_images();
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/png_2.png");
+    TEST_ASSERT_FALSE(lv_image_cache_is_cached("A:src/test_assets/test_img_lvgl_logo.png"));
+
+    size_t mem_before = lv_test_get_free_mem();
+    for(uint32_t i = 0; i < 20; i++) {
+        create_images();
+
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/png_2.png");
+
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 32);
+
+    /* Only the bands of the dropped file are invalidated */
+    lv_cache_t * band_cache = LV_GLOBAL_DEFAULT()->img_band_cache;
+    size_t band_size = lv_cache_get_size(band_cache, NULL);
+    TEST_ASSERT_NOT_EQUAL(0, band_size);
+
+    lv_image_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    lv_image_cache_drop(&dsc);
+    lv_image_cache_drop("A:src/test_assets/test_img_lvgl_logo_other.png");
+    TEST_ASSERT_EQUAL(band_size, lv_cache_get_size(band_cache, NULL));
+
+    lv_image_cache_drop("A:src/test_assets/test_img_lvgl_logo.png");
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(band_cache, NULL));
+
+    /* Transformed images are decoded entirely */
+    lv_image_set_rotation(lv_obj_get_child(lv_screen_active(), 0), 300);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(lv_image_cache_is_cached("A:src/test_assets/test_img_lvgl_logo.png"));
+
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+    lv_image_band_cache_resize(band_cache_size, true);
+
+    /* Re-add lodepng decoder */
+    lv_lodepng_init();
+}
+
 #endif
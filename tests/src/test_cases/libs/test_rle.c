@@ -0,0 +1,141 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+/**
+ * Decompress block by block, byte by byte as a reference
+ */
+static uint32_t reference_decompress(const uint8_t * input, uint32_t input_len, uint8_t * output,
+                                     uint32_t output_len, uint32_t blk_size)
+{
+    uint32_t rd = 0;
+    uint32_t wr = 0;
+    while(rd < input_len) {
+        uint8_t ctrl = input[rd++];
+        uint32_t cnt = ctrl & 0x7f;
+        uint32_t i;
+        for(i = 0; i < cnt; i++) {
+            const uint8_t * blk = (ctrl & 0x80) ? &input[rd + i * blk_size] : &input[rd];
+            uint32_t j;
+            for(j = 0; j < blk_size && wr < output_len; j++) output[wr++] = blk[j];
+        }
+        rd += (ctrl & 0x80) ? cnt * blk_size : blk_size;
+    }
+
+    return wr;
+}
+
+static void check_runs(uint32_t blk_size, uint32_t out_ofs)
+{
+    /*A repeated run, a literal run and a repeated run of the maximal length*/
+    uint8_t input[1 + 4 + 1 + 3 * 4 + 1 + 4];
+    uint32_t i = 0;
+    uint32_t j;
+    input[i++] = 5;
+    for(j = 0; j < blk_size; j++) input[i++] = 0x10 + j;
+    input[i++] = 0x80 | 3;
+    for(j = 0; j < 3 * blk_size; j++) input[i++] = 0x20 + j;
+    input[i++] = 127;
+    for(j = 0; j < blk_size; j++) input[i++] = 0x30 + j;
+    uint32_t input_len = i;
+
+    uint32_t out_len = (5 + 3 + 127) * blk_size;
+    uint8_t ref[(5 + 3 + 127) * 4];
+    uint8_t buf[(5 + 3 + 127) * 4 + 8];
+    TEST_ASSERT_EQUAL_UINT32(out_len, reference_decompress(input, input_len, ref, out_len, blk_size));
+
+    /*Unaligned output can't be filled with whole words*/
+    uint8_t * out = buf + out_ofs;
+    TEST_ASSERT_EQUAL_UINT32(out_len, lv_rle_decompress(input, input_len, out, out_len, blk_size));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, out, out_len);
+
+    /*The padding of the last block is not written*/
+    lv_memset(buf, 0xaa, sizeof(buf));
+    TEST_ASSERT_EQUAL_UINT32(out_len - 1, lv_rle_decompress(input, input_len, out, out_len - 1, blk_size));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, out, out_len - blk_size);
+    TEST_ASSERT_EQUAL_UINT8(0xaa, out[out_len - 1]);
+
+    /*Truncated input and too small output are errors*/
+    TEST_ASSERT_EQUAL_UINT32(0, lv_rle_decompress(input, input_len - 1, out, out_len, blk_size));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_rle_decompress(input, input_len, out, out_len - blk_size - 1, blk_size));
+}
+
+void test_rle_decompress_runs(void)
+{
+    uint32_t blk_size;
+    for(blk_size = 1; blk_size <= 4; blk_size++) {
+        uint32_t ofs;
+        for(ofs = 0; ofs < 4; ofs++) {
+            check_runs(blk_size, ofs);
+        }
+    }
+}
+
+static uint8_t * load_compressed(const char * path, uint32_t * compressed_len, uint32_t * decompressed_len)
+{
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, path, LV_FS_MODE_RD));
+
+    /*Image header, then the method, the compressed and the decompressed size*/
+    uint32_t header[6];
+    uint32_t rn;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, header, sizeof(header), &rn));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(header), rn);
+    TEST_ASSERT_EQUAL_UINT32(LV_IMAGE_COMPRESS_RLE, header[3] & 0xf);
+
+    *compressed_len = header[4];
+    *decompressed_len = header[5];
+    uint8_t * data = lv_malloc(*compressed_len);
+    TEST_ASSERT_NOT_NULL(data);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, data, *compressed_len, &rn));
+    TEST_ASSERT_EQUAL_UINT32(*compressed_len, rn);
+    lv_fs_close(&f);
+
+    return data;
+}
+
+static void check_image(const char * name, uint32_t blk_size)
+{
+    char path[128];
+    lv_snprintf(path, sizeof(path), "A:src/test_files/rle_compressed/cogwheel.%s.bin", name);
+
+    uint32_t compressed_len;
+    uint32_t decompressed_len;
+    uint8_t * compressed = load_compressed(path, &compressed_len, &decompressed_len);
+    uint8_t * ref = lv_malloc(decompressed_len);
+    uint8_t * out = lv_malloc(decompressed_len);
+    TEST_ASSERT_NOT_NULL(ref);
+    TEST_ASSERT_NOT_NULL(out);
+
+    TEST_ASSERT_EQUAL_UINT32(decompressed_len,
+                             reference_decompress(compressed, compressed_len, ref, decompressed_len, blk_size));
+    TEST_ASSERT_EQUAL_UINT32(decompressed_len,
+                             lv_rle_decompress(compressed, compressed_len, out, decompressed_len, blk_size));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, out, decompressed_len);
+
+    lv_free(compressed);
+    lv_free(ref);
+    lv_free(out);
+}
+
+void test_rle_decompress_images(void)
+{
+    check_image("A8", 1);
+    check_image("RGB565", 2);
+    check_image("RGB888", 3);
+    check_image("ARGB8888", 4);
+    check_image("XRGB8888", 4);
+}
+
+#endif
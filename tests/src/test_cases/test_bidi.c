@@ -0,0 +1,84 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <string.h>
+
+/*"abc ABC" where the second word is Hebrew*/
+#define MIXED_TXT "abc \xd7\x90\xd7\x91\xd7\x92"
+
+void setUp(void)
+{
+    lv_bidi_cache_drop_all();
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+void test_bidi_paragraph_is_processed(void)
+{
+    const char * txt = MIXED_TXT;
+    uint32_t len = strlen(txt);
+    char expected[32];
+    _lv_bidi_process_paragraph(txt, expected, len, LV_BASE_DIR_LTR, NULL, 0);
+
+    const lv_bidi_paragraph_t * par = _lv_bidi_paragraph_acquire(txt, len, LV_BASE_DIR_LTR);
+    TEST_ASSERT_NOT_NULL(par);
+    TEST_ASSERT_EQUAL_STRING(expected, par->visual_txt);
+    TEST_ASSERT_EQUAL_UINT32(7, par->pos_conv_len);
+
+    uint32_t i;
+    for(i = 0; i < par->pos_conv_len; i++) {
+        bool is_rtl_ref;
+        bool is_rtl;
+        uint16_t ref = _lv_bidi_get_logical_pos(txt, NULL, len, LV_BASE_DIR_LTR, i, &is_rtl_ref);
+        TEST_ASSERT_EQUAL_UINT16(ref, _lv_bidi_paragraph_get_logical_pos(par, i, &is_rtl));
+        TEST_ASSERT_EQUAL(is_rtl_ref, is_rtl);
+    }
+
+    _lv_bidi_paragraph_release(par);
+}
+
+void test_bidi_paragraph_is_reused(void)
+{
+    const char * txt = MIXED_TXT;
+    uint32_t len = strlen(txt);
+
+    const lv_bidi_paragraph_t * par1 = _lv_bidi_paragraph_acquire(txt, len, LV_BASE_DIR_LTR);
+    _lv_bidi_paragraph_release(par1);
+
+    /*The same content at an other address is found too*/
+    char copy[32];
+    lv_strcpy(copy, txt);
+    const lv_bidi_paragraph_t * par2 = _lv_bidi_paragraph_acquire(copy, len, LV_BASE_DIR_LTR);
+    TEST_ASSERT_EQUAL_PTR(par1, par2);
+    _lv_bidi_paragraph_release(par2);
+
+    /*The base direction is part of the key*/
+    const lv_bidi_paragraph_t * par3 = _lv_bidi_paragraph_acquire(txt, len, LV_BASE_DIR_RTL);
+    TEST_ASSERT_TRUE(par1 != par3);
+    TEST_ASSERT_EQUAL(LV_BASE_DIR_RTL, par3->base_dir);
+    _lv_bidi_paragraph_release(par3);
+}
+
+void test_bidi_paragraph_changed_in_place_is_processed_again(void)
+{
+    char txt[32];
+    lv_strcpy(txt, MIXED_TXT);
+    uint32_t len = strlen(txt);
+
+    const lv_bidi_paragraph_t * par = _lv_bidi_paragraph_acquire(txt, len, LV_BASE_DIR_LTR);
+    char visual_old[32];
+    lv_strcpy(visual_old, par->visual_txt);
+    _lv_bidi_paragraph_release(par);
+
+    txt[0] = 'x';
+    par = _lv_bidi_paragraph_acquire(txt, len, LV_BASE_DIR_LTR);
+    TEST_ASSERT_EQUAL_CHAR('x', par->visual_txt[0]);
+    TEST_ASSERT_EQUAL_STRING(visual_old + 1, par->visual_txt + 1);
+    _lv_bidi_paragraph_release(par);
+}
+
+#endif
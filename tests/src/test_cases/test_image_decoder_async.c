@@ -0,0 +1,174 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+#include <unistd.h>
+
+#if LV_USE_IMAGE_DECODER_ASYNC && LV_USE_LODEPNG
+
+#define PNG_32BIT   "A:src/test_assets/test_img_lvgl_logo.png"
+#define PNG_8BIT    "A:src/test_assets/test_img_lvgl_logo_8bit_palette.png"
+
+static uint32_t cb_cnt;
+static lv_result_t cb_res;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_libpng_deinit();
+    lv_image_cache_drop(NULL);
+    cb_cnt = 0;
+    cb_res = LV_RESULT_INVALID;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+    lv_libpng_init();
+}
+
+static void decode_cb(const void * src, lv_result_t res, void * user_data)
+{
+    TEST_ASSERT_EQUAL_STRING(PNG_32BIT, src);
+    TEST_ASSERT_EQUAL_PTR(&cb_cnt, user_data);
+    cb_res = res;
+    cb_cnt++;
+}
+
+static bool wait_for_cache(const char * src)
+{
+    uint32_t i;
+    for(i = 0; i < 500; i++) {
+        if(lv_image_cache_is_cached(src)) return true;
+        usleep(2000);
+        lv_test_wait(2);
+    }
+    return false;
+}
+
+void test_image_cache_prefetch(void)
+{
+    TEST_ASSERT_FALSE(lv_image_cache_is_cached(PNG_32BIT));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_cache_prefetch(PNG_32BIT));
+    TEST_ASSERT_TRUE(wait_for_cache(PNG_32BIT));
+
+    /*Already cached*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_cache_prefetch(PNG_32BIT));
+}
+
+void test_decode_async_cb(void)
+{
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_decode_async(PNG_32BIT, NULL, decode_cb, &cb_cnt));
+
+    uint32_t i;
+    for(i = 0; i < 500 && cb_cnt == 0; i++) {
+        usleep(2000);
+        lv_test_wait(2);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(1, cb_cnt);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, cb_res);
+    TEST_ASSERT_TRUE(lv_image_cache_is_cached(PNG_32BIT));
+
+    /*A missing file is reported too*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_decode_async("A:not_exists.png", NULL, NULL, NULL));
+    lv_test_wait(100);
+}
+
+void test_decode_async_cancel(void)
+{
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_decode_async(PNG_32BIT, NULL, decode_cb, &cb_cnt));
+    lv_image_decoder_cancel_async(decode_cb, &cb_cnt);
+
+    uint32_t i;
+    for(i = 0; i < 50; i++) {
+        usleep(2000);
+        lv_test_wait(2);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0, cb_cnt);
+}
+
+void test_image_decode_async(void)
+{
+    LV_IMG_DECLARE(test_img_lvgl_logo_png);
+    lv_obj_t * img;
+    lv_obj_t * label;
+
+    /*Same as `test_lodepng_1` but the files are decoded in the background*/
+    img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &test_img_lvgl_logo_png);
+    lv_obj_align(img, LV_ALIGN_CENTER, -100, -20);
+
+    label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "Array");
+    lv_obj_align(label, LV_ALIGN_CENTER, -100, 20);
+
+    img = lv_image_create(lv_screen_active());
+    lv_image_set_decode_async(img, true);
+    lv_image_set_placeholder(img, &test_img_lvgl_logo_png);
+    lv_image_set_src(img, PNG_32BIT);
+    lv_obj_align(img, LV_ALIGN_CENTER, 100, -100);
+    TEST_ASSERT_TRUE(lv_image_get_decode_async(img));
+    TEST_ASSERT_EQUAL_PTR(&test_img_lvgl_logo_png, lv_image_get_placeholder(img));
+
+    label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "File (32 bit)");
+    lv_obj_align(label, LV_ALIGN_CENTER, 100, -60);
+
+    img = lv_image_create(lv_screen_active());
+    lv_image_set_decode_async(img, true);
+    lv_image_set_src(img, PNG_8BIT);
+    lv_obj_align(img, LV_ALIGN_CENTER, 100, 60);
+
+    label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "File (8 bit palette)");
+    lv_obj_align(label, LV_ALIGN_CENTER, 100, 100);
+
+    /*The first refresh only starts the decoding*/
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_TRUE(wait_for_cache(PNG_32BIT));
+    TEST_ASSERT_TRUE(wait_for_cache(PNG_8BIT));
+
+    /*Let the callbacks invalidate the images*/
+    lv_test_wait(50);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/png_1.png");
+}
+
+void test_image_decode_async_delete(void)
+{
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_decode_async(img, true);
+    lv_image_set_src(img, PNG_32BIT);
+    lv_refr_now(NULL);
+
+    /*The request is either dropped or finishes without calling back the deleted image*/
+    lv_obj_delete(img);
+
+    uint32_t i;
+    for(i = 0; i < 50; i++) {
+        usleep(2000);
+        lv_test_wait(2);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0, lv_obj_get_child_count(lv_screen_active()));
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+#endif
+
+#endif
@@ -0,0 +1,151 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../src/indev/lv_indev_hit_index.h"
+
+#include "unity/unity.h"
+#include "lv_test_indev.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_USE_INDEV_HIT_INDEX
+
+static void compare_with_search(lv_obj_t * root)
+{
+    lv_display_t * disp = lv_obj_get_display(root);
+    int32_t x;
+    int32_t y;
+    for(y = -10; y < lv_display_get_vertical_resolution(disp) + 10; y += 3) {
+        for(x = -10; x < lv_display_get_horizontal_resolution(disp) + 10; x += 3) {
+            lv_point_t p = {x, y};
+            lv_obj_t * expected = lv_indev_search_obj(root, &p);
+            lv_obj_t * found = _lv_indev_hit_index_search(disp, root, &p);
+            if(expected != found) {
+                char buf[64];
+                lv_snprintf(buf, sizeof(buf), "Mismatch at %d;%d", (int)x, (int)y);
+                TEST_FAIL_MESSAGE(buf);
+            }
+            /*The same point again, served from the cache*/
+            TEST_ASSERT_EQUAL_PTR(expected, _lv_indev_hit_index_search(disp, root, &p));
+        }
+    }
+}
+
+static lv_obj_t * create_tree(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+
+    lv_obj_t * cont = lv_obj_create(scr);
+    lv_obj_set_size(cont, 400, 300);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        lv_obj_t * btn = lv_button_create(cont);
+        lv_obj_set_size(btn, 60, 40);
+        if(i % 7 == 0) lv_obj_add_flag(btn, LV_OBJ_FLAG_HIDDEN);
+        if(i % 5 == 0) lv_obj_set_ext_click_area(btn, 8);
+        if(i % 3 == 0) lv_obj_remove_flag(btn, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text(label, "btn");
+    }
+
+    /*Transformed container with children partially out of it*/
+    lv_obj_t * rot = lv_obj_create(scr);
+    lv_obj_set_pos(rot, 450, 100);
+    lv_obj_set_size(rot, 200, 150);
+    lv_obj_set_style_transform_rotation(rot, 300, 0);
+    lv_obj_set_style_transform_scale(rot, 384, 0);
+    lv_obj_set_style_transform_pivot_x(rot, 100, 0);
+    lv_obj_set_style_transform_pivot_y(rot, 75, 0);
+
+    lv_obj_t * inner = lv_button_create(rot);
+    lv_obj_set_size(inner, 80, 50);
+    lv_obj_set_style_transform_rotation(inner, -450, 0);
+    lv_obj_set_style_transform_scale(inner, 200, 0);
+
+    lv_obj_t * out = lv_button_create(rot);
+    lv_obj_set_pos(out, 150, 120);
+    lv_obj_set_size(out, 80, 50);
+
+    /*Overflow visible parent with a shadow*/
+    lv_obj_t * ov = lv_obj_create(scr);
+    lv_obj_set_pos(ov, 50, 350);
+    lv_obj_set_size(ov, 100, 80);
+    lv_obj_add_flag(ov, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+    lv_obj_set_style_shadow_width(ov, 30, 0);
+    lv_obj_t * ov_child = lv_button_create(ov);
+    lv_obj_set_pos(ov_child, 70, 50);
+    lv_obj_set_size(ov_child, 80, 50);
+
+    lv_obj_update_layout(scr);
+    return cont;
+}
+
+void test_hit_index_same_as_search(void)
+{
+    create_tree();
+    compare_with_search(lv_screen_active());
+}
+
+void test_hit_index_after_changes(void)
+{
+    lv_obj_t * cont = create_tree();
+    compare_with_search(lv_screen_active());
+
+    lv_obj_scroll_by(cont, 0, -50, LV_ANIM_OFF);
+    lv_obj_update_layout(cont);
+    compare_with_search(lv_screen_active());
+
+    lv_obj_delete(lv_obj_get_child(cont, 4));
+    lv_obj_add_flag(lv_obj_get_child(cont, 8), LV_OBJ_FLAG_HIDDEN);
+    lv_obj_move_to_index(lv_obj_get_child(cont, 1), -1);
+    lv_obj_set_style_transform_rotation(cont, 100, 0);
+    lv_obj_update_layout(cont);
+    compare_with_search(lv_screen_active());
+
+    lv_obj_set_style_transform_rotation(cont, 0, 0);
+    lv_obj_set_pos(cont, 200, 100);
+    lv_obj_update_layout(cont);
+    compare_with_search(lv_screen_active());
+}
+
+static void click_event_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+}
+
+void test_hit_index_click(void)
+{
+    uint32_t cnt = 0;
+    lv_obj_t * btn = lv_button_create(lv_screen_active());
+    lv_obj_set_pos(btn, 100, 100);
+    lv_obj_set_size(btn, 100, 50);
+    lv_obj_add_event_cb(btn, click_event_cb, LV_EVENT_CLICKED, &cnt);
+
+    lv_test_mouse_click_at(150, 125);
+    lv_test_mouse_click_at(150, 125);
+    lv_test_mouse_click_at(20, 20);
+    lv_test_mouse_click_at(20, 20);
+    TEST_ASSERT_EQUAL_UINT32(2, cnt);
+
+    /*Move the button to where the previous grid had nothing*/
+    lv_obj_set_pos(btn, 0, 0);
+    lv_test_mouse_click_at(20, 20);
+    lv_test_mouse_click_at(20, 20);
+    lv_test_mouse_click_at(150, 125);
+    TEST_ASSERT_EQUAL_UINT32(4, cnt);
+}
+
+#endif
+
+#endif
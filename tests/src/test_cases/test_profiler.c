@@ -7,15 +7,23 @@
 #define OUTPUT_LINE_MAX 8
 #define OUTPUT_BUF_MAX 128
 
-static uint32_t profiler_tick = 0;
+static uint64_t profiler_tick = 0;
 static int output_line = 0;
 static char output_buf[OUTPUT_LINE_MAX][OUTPUT_BUF_MAX];
+static int profiler_tid = 1;
+static uint8_t bin_buf[512];
+static uint32_t bin_len = 0;
 
-static uint32_t get_tick_cb(void)
+static uint64_t get_tick_cb(void)
 {
     return profiler_tick++;
 }
 
+static int get_tid_cb(void)
+{
+    return profiler_tid;
+}
+
 static void flush_cb(const char * buf)
 {
     TEST_ASSERT_LESS_THAN(OUTPUT_LINE_MAX, output_line);
@@ -25,6 +33,14 @@ static void flush_cb(const char * buf)
     output_line++;
 }
 
+static void flush_bin_cb(const void * buf, uint32_t size)
+{
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(bin_buf), bin_len + size);
+
+    lv_memcpy(bin_buf + bin_len, buf, size);
+    bin_len += size;
+}
+
 void setUp(void)
 {
     lv_profiler_builtin_config_t config;
@@ -97,4 +113,207 @@ void test_profiler_disable(void)
     TEST_ASSERT_EQUAL_CHAR(output_buf[4][0], '\0');
 }
 
+void test_profiler_64bit_tick(void)
+{
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = 1024;
+    config.tick_per_sec = 1000000; /* One second is equal to 1000000 microseconds */
+    config.tick_get_cb = get_tick_cb;
+    config.flush_cb = flush_cb;
+    lv_profiler_builtin_init(&config);
+
+    /* reset */
+    profiler_tick = 5000000000123ULL; /* Doesn't fit into 32 bits */
+    output_line = 0;
+    lv_memzero(output_buf, sizeof(output_buf));
+
+    LV_PROFILER_BEGIN_TAG("custom_tag");
+    lv_profiler_builtin_flush();
+
+    TEST_ASSERT_EQUAL_INT(output_line, 1);
+    TEST_ASSERT_EQUAL_STRING(output_buf[0], "   LVGL-1 [0] 5000000.000123: tracing_mark_write: B|1|custom_tag\n");
+}
+
+void test_profiler_multi_thread(void)
+{
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = 1024;
+    config.tick_per_sec = 1;
+    config.tick_get_cb = get_tick_cb;
+    config.tid_get_cb = get_tid_cb;
+    config.flush_cb = flush_cb;
+    config.thread_max = 2;
+    lv_profiler_builtin_init(&config);
+
+    /* reset */
+    profiler_tick = 0;
+    output_line = 0;
+    lv_memzero(output_buf, sizeof(output_buf));
+
+    /* each thread writes into its own buffer */
+    profiler_tid = 10;
+    LV_PROFILER_BEGIN_TAG("a");
+    profiler_tid = 20;
+    LV_PROFILER_BEGIN_TAG("b");
+    profiler_tid = 10;
+    LV_PROFILER_END_TAG("a");
+    profiler_tid = 20;
+    LV_PROFILER_END_TAG("b");
+
+    /* no buffer is left for a third thread */
+    profiler_tid = 30;
+    LV_PROFILER_BEGIN_TAG("c");
+    profiler_tid = 1;
+
+    TEST_ASSERT_EQUAL_UINT32(1, lv_profiler_builtin_get_overflow_count());
+
+    /* the buffers are merged by timestamp */
+    lv_profiler_builtin_flush();
+
+    TEST_ASSERT_EQUAL_INT(output_line, 4);
+    TEST_ASSERT_EQUAL_STRING(output_buf[0], "   LVGL-10 [0] 0.000000: tracing_mark_write: B|1|a\n");
+    TEST_ASSERT_EQUAL_STRING(output_buf[1], "   LVGL-20 [0] 1.000000: tracing_mark_write: B|1|b\n");
+    TEST_ASSERT_EQUAL_STRING(output_buf[2], "   LVGL-10 [0] 2.000000: tracing_mark_write: E|1|a\n");
+    TEST_ASSERT_EQUAL_STRING(output_buf[3], "   LVGL-20 [0] 3.000000: tracing_mark_write: E|1|b\n");
+}
+
+void test_profiler_counter(void)
+{
+    /* reset */
+    profiler_tick = 0;
+    output_line = 0;
+    lv_memzero(output_buf, sizeof(output_buf));
+
+    LV_PROFILER_COUNTER("fps", 60);
+    LV_PROFILER_COUNTER("mem_used", -1);
+    lv_profiler_builtin_flush();
+
+    TEST_ASSERT_EQUAL_INT(output_line, 2);
+    TEST_ASSERT_EQUAL_STRING(output_buf[0], "   LVGL-1 [0] 0.000000: tracing_mark_write: C|1|fps|60\n");
+    TEST_ASSERT_EQUAL_STRING(output_buf[1], "   LVGL-1 [0] 1.000000: tracing_mark_write: C|1|mem_used|-1\n");
+}
+
+#if LV_PROFILER_CACHE
+
+static int cache_counter_cnt = 0;
+static char cache_counter_buf[OUTPUT_BUF_MAX];
+
+static void flush_cache_counter_cb(const char * buf)
+{
+    /* keep only the counter of the test cache, the cache functions are profiled too */
+    if(strstr(buf, "C|1|test_cache|") == NULL) return;
+
+    lv_strcpy(cache_counter_buf, buf);
+    cache_counter_cnt++;
+}
+
+static lv_cache_compare_res_t cache_compare_cb(const int32_t * lhs, const int32_t * rhs)
+{
+    if(*lhs == *rhs) return 0;
+    return *lhs > *rhs ? 1 : -1;
+}
+
+static bool cache_create_cb(int32_t * node, void * user_data)
+{
+    LV_UNUSED(node);
+    LV_UNUSED(user_data);
+    return true;
+}
+
+static void cache_free_cb(int32_t * node, void * user_data)
+{
+    LV_UNUSED(node);
+    LV_UNUSED(user_data);
+}
+
+static void cache_lookup(lv_cache_t * cache, int32_t key)
+{
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache, &key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    lv_cache_release(cache, entry, NULL);
+}
+
+void test_profiler_cache_counter(void)
+{
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = 4096;
+    config.tick_per_sec = 1;
+    config.tick_get_cb = get_tick_cb;
+    config.flush_cb = flush_cache_counter_cb;
+    lv_profiler_builtin_init(&config);
+    cache_counter_cnt = 0;
+
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)cache_free_cb,
+    };
+    lv_cache_t * cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(int32_t), 4, ops);
+    lv_cache_set_name(cache, "test_cache");
+
+    /* the hit rate is reported only once in a refresh period */
+    int32_t i;
+    for(i = 0; i < 10; i++) {
+        cache_lookup(cache, i % 2);
+    }
+    lv_profiler_builtin_flush();
+    TEST_ASSERT_EQUAL_INT(0, cache_counter_cnt);
+
+    /* 9 hits of the 11 lookups */
+    lv_tick_inc(LV_DEF_REFR_PERIOD);
+    cache_lookup(cache, 0);
+    lv_profiler_builtin_flush();
+    TEST_ASSERT_EQUAL_INT(1, cache_counter_cnt);
+    TEST_ASSERT_NOT_NULL(strstr(cache_counter_buf, "C|1|test_cache|81\n"));
+
+    /* the next report covers only the lookups since the previous one */
+    lv_tick_inc(LV_DEF_REFR_PERIOD);
+    cache_lookup(cache, 2);
+    lv_profiler_builtin_flush();
+    TEST_ASSERT_EQUAL_INT(2, cache_counter_cnt);
+    TEST_ASSERT_NOT_NULL(strstr(cache_counter_buf, "C|1|test_cache|0\n"));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+#endif
+
+void test_profiler_binary(void)
+{
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = 1024;
+    config.tick_per_sec = 1000000;
+    config.tick_get_cb = get_tick_cb;
+    config.format = LV_PROFILER_BUILTIN_FORMAT_BINARY;
+    config.flush_bin_cb = flush_bin_cb;
+    bin_len = 0;
+    lv_profiler_builtin_init(&config);
+
+    /* header: magic, version and varint tick_per_sec */
+    static const uint8_t header[] = {'L', 'V', 'P', 'T', 1, 0xC0, 0x84, 0x3D};
+    TEST_ASSERT_EQUAL_UINT32(sizeof(header), bin_len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(header, bin_buf, sizeof(header));
+
+    profiler_tick = 100;
+    bin_len = 0;
+    LV_PROFILER_BEGIN_TAG("ab");
+    LV_PROFILER_END_TAG("ab");
+    LV_PROFILER_COUNTER("ab", -2);
+    lv_profiler_builtin_flush();
+
+    /* the string is sent only once, the ticks are delta encoded, the numbers are zigzag encoded */
+    static const uint8_t expected[] = {
+        'S', 0, 2, 'a', 'b',
+        'B', 200, 1, 2, 0, 0,
+        'E', 2, 2, 0, 0,
+        'C', 2, 2, 0, 0, 3,
+    };
+    TEST_ASSERT_EQUAL_UINT32(sizeof(expected), bin_len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, bin_buf, sizeof(expected));
+}
+
 #endif
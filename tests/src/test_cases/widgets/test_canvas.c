@@ -0,0 +1,243 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+#include <unistd.h>
+
+
+static lv_obj_t * active_screen = NULL;
+/*The far edges of the invalidated area can be rounded up by one pixel when the object's
+ *transformed area is calculated, so x2 and y2 are checked with this tolerance*/
+static lv_area_t inv_area;
+static uint32_t inv_cnt;
+
+static void invalidate_area_event_cb(lv_event_t * e)
+{
+    lv_area_t * area = lv_event_get_param(e);
+    if(inv_cnt == 0) inv_area = *area;
+    else _lv_area_join(&inv_area, &inv_area, area);
+    inv_cnt++;
+}
+
+static void start_inv_tracking(void)
+{
+    lv_refr_now(NULL);
+    inv_cnt = 0;
+    lv_display_add_event_cb(lv_display_get_default(), invalidate_area_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+}
+
+static void stop_inv_tracking(void)
+{
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), invalidate_area_event_cb, NULL);
+}
+
+void setUp(void)
+{
+    active_screen = lv_screen_active();
+}
+
+void tearDown(void)
+{
+    stop_inv_tracking();
+    lv_obj_clean(active_screen);
+}
+
+void test_canvas_set_px_invalidates_the_changed_area(void)
+{
+    static uint8_t buf[LV_CANVAS_BUF_SIZE(100, 100, 16, LV_DRAW_BUF_STRIDE_ALIGN)];
+    lv_obj_t * canvas = lv_canvas_create(active_screen);
+    lv_canvas_set_buffer(canvas, buf, 100, 100, LV_COLOR_FORMAT_RGB565);
+    lv_obj_set_pos(canvas, 10, 20);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+
+    start_inv_tracking();
+    lv_canvas_set_px(canvas, 5, 5, lv_color_black(), LV_OPA_COVER);
+    lv_canvas_set_px(canvas, 50, 60, lv_color_black(), LV_OPA_COVER);
+    lv_canvas_set_px(canvas, 20, 30, lv_color_black(), LV_OPA_COVER);
+    lv_refr_now(NULL);
+
+    /*Only the first pixel is invalidated immediately, the others together before the refresh*/
+    TEST_ASSERT_EQUAL_UINT32(2, inv_cnt);
+    TEST_ASSERT_EQUAL_INT32(15, inv_area.x1);
+    TEST_ASSERT_EQUAL_INT32(25, inv_area.y1);
+    TEST_ASSERT_INT32_WITHIN(1, 60, inv_area.x2);
+    TEST_ASSERT_INT32_WITHIN(1, 80, inv_area.y2);
+
+    /*A new area is tracked after the refresh*/
+    inv_cnt = 0;
+    lv_canvas_set_px(canvas, 99, 99, lv_color_black(), LV_OPA_COVER);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_INT32(109, inv_area.x1);
+    TEST_ASSERT_EQUAL_INT32(119, inv_area.y1);
+    TEST_ASSERT_INT32_WITHIN(1, 109, inv_area.x2);
+    TEST_ASSERT_INT32_WITHIN(1, 119, inv_area.y2);
+
+    /*The whole canvas is invalidated if it's scaled*/
+    inv_cnt = 0;
+    lv_image_set_scale(canvas, 512);
+    lv_refr_now(NULL);
+    inv_cnt = 0;
+    lv_canvas_set_px(canvas, 0, 0, lv_color_black(), LV_OPA_COVER);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(lv_area_get_width(&inv_area) >= 100);
+    TEST_ASSERT_TRUE(lv_area_get_height(&inv_area) >= 100);
+
+    /*Delete the canvas with changes not invalidated yet*/
+    lv_canvas_set_px(canvas, 1, 1, lv_color_black(), LV_OPA_COVER);
+    lv_obj_delete(canvas);
+    lv_refr_now(NULL);
+}
+
+void test_canvas_set_px_rect(void)
+{
+    static uint8_t buf[LV_CANVAS_BUF_SIZE(20, 10, 32, LV_DRAW_BUF_STRIDE_ALIGN)];
+    lv_obj_t * canvas = lv_canvas_create(active_screen);
+    lv_canvas_set_buffer(canvas, buf, 20, 10, LV_COLOR_FORMAT_ARGB8888);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+
+    lv_color32_t px[4 * 3];
+    uint32_t i;
+    for(i = 0; i < 12; i++) {
+        px[i] = lv_color32_make(i * 10, 0, 0, 0xff);
+    }
+
+    start_inv_tracking();
+
+    /*Partially out of the canvas*/
+    lv_area_t area = {18, 8, 21, 10};
+    lv_canvas_set_px_rect(canvas, &area, px, 0);
+    lv_canvas_set_px_span(canvas, -2, 0, 4, px);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT8(0, lv_canvas_get_px(canvas, 18, 8).red);
+    TEST_ASSERT_EQUAL_UINT8(10, lv_canvas_get_px(canvas, 19, 8).red);
+    TEST_ASSERT_EQUAL_UINT8(40, lv_canvas_get_px(canvas, 18, 9).red);
+    TEST_ASSERT_EQUAL_UINT8(50, lv_canvas_get_px(canvas, 19, 9).red);
+    TEST_ASSERT_EQUAL_UINT8(0, lv_canvas_get_px(canvas, 17, 9).red);
+    TEST_ASSERT_EQUAL_UINT8(20, lv_canvas_get_px(canvas, 0, 0).red);
+    TEST_ASSERT_EQUAL_UINT8(30, lv_canvas_get_px(canvas, 1, 0).red);
+    TEST_ASSERT_EQUAL_UINT8(0, lv_canvas_get_px(canvas, 2, 0).red);
+
+    TEST_ASSERT_EQUAL_INT32(0, inv_area.x1);
+    TEST_ASSERT_EQUAL_INT32(0, inv_area.y1);
+    TEST_ASSERT_INT32_WITHIN(1, 19, inv_area.x2);
+    TEST_ASSERT_INT32_WITHIN(1, 9, inv_area.y2);
+}
+
+void test_canvas_set_px_rect_indexed(void)
+{
+    static uint8_t buf[LV_CANVAS_BUF_SIZE(16, 2, 4, LV_DRAW_BUF_STRIDE_ALIGN) + 16 * 4];
+    lv_obj_t * canvas = lv_canvas_create(active_screen);
+    lv_canvas_set_buffer(canvas, buf, 16, 2, LV_COLOR_FORMAT_I4);
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(canvas);
+    lv_memzero(lv_draw_buf_goto_xy(draw_buf, 0, 0), draw_buf->header.stride * 2);
+
+    /*Indices 1, 2, 3 starting from an odd pixel*/
+    const uint8_t px[2] = {0x12, 0x30};
+    lv_canvas_set_px_span(canvas, 3, 1, 3, px);
+
+    const uint8_t * row = lv_draw_buf_goto_xy(draw_buf, 0, 1);
+    TEST_ASSERT_EQUAL_HEX8(0x01, row[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x23, row[2]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, row[3]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, row[0]);
+}
+
+void test_canvas_finish_layer_invalidates_the_drawn_area(void)
+{
+    static uint8_t buf[LV_CANVAS_BUF_SIZE(100, 100, 32, LV_DRAW_BUF_STRIDE_ALIGN)];
+    lv_obj_t * canvas = lv_canvas_create(active_screen);
+    lv_canvas_set_buffer(canvas, buf, 100, 100, LV_COLOR_FORMAT_ARGB8888);
+    lv_obj_set_pos(canvas, 10, 20);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+
+    start_inv_tracking();
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_palette_main(LV_PALETTE_RED);
+    lv_area_t coords = {10, 10, 29, 19};
+    lv_draw_rect(&layer, &dsc, &coords);
+
+    lv_canvas_finish_layer(canvas, &layer);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_INT32(20, inv_area.x1);
+    TEST_ASSERT_EQUAL_INT32(30, inv_area.y1);
+    TEST_ASSERT_INT32_WITHIN(1, 39, inv_area.x2);
+    TEST_ASSERT_INT32_WITHIN(1, 39, inv_area.y2);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/canvas_finish_layer.png");
+}
+
+static void ready_event_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+}
+
+void test_canvas_finish_layer_async(void)
+{
+    lv_draw_buf_t * front_buf = lv_draw_buf_create(100, 100, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    lv_draw_buf_t * back_buf = lv_draw_buf_create(100, 100, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    lv_obj_t * canvas = lv_canvas_create(active_screen);
+    lv_canvas_set_draw_buf(canvas, front_buf);
+    lv_canvas_set_back_draw_buf(canvas, back_buf);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+
+    uint32_t ready_cnt = 0;
+    lv_obj_add_event_cb(canvas, ready_event_cb, LV_EVENT_READY, &ready_cnt);
+
+    lv_layer_t * layer = lv_canvas_init_layer_async(canvas);
+    TEST_ASSERT_NOT_NULL(layer);
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_color_black();
+    lv_area_t coords = {0, 0, 99, 99};
+    lv_draw_rect(layer, &dsc, &coords);
+    dsc.bg_color = lv_color_hex(0xff0000);
+    lv_area_set(&coords, 10, 10, 29, 19);
+    lv_draw_rect(layer, &dsc, &coords);
+
+    lv_canvas_finish_layer_async(canvas, layer);
+
+    /*The shown buffer is not changed until the rendering is ready*/
+    TEST_ASSERT_TRUE(lv_canvas_is_rendering(canvas));
+    TEST_ASSERT_NULL(lv_canvas_init_layer_async(canvas));
+    TEST_ASSERT_EQUAL_PTR(front_buf, lv_canvas_get_draw_buf(canvas));
+    TEST_ASSERT_EQUAL_UINT32(0, ready_cnt);
+
+    uint32_t i;
+    for(i = 0; i < 1000 && lv_canvas_is_rendering(canvas); i++) {
+        /*Let the render threads work*/
+        usleep(1000);
+        lv_test_wait(5);
+    }
+
+    TEST_ASSERT_FALSE(lv_canvas_is_rendering(canvas));
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+    TEST_ASSERT_EQUAL_PTR(back_buf, lv_canvas_get_draw_buf(canvas));
+    TEST_ASSERT_EQUAL_UINT8(0xff, lv_canvas_get_px(canvas, 20, 15).red);
+    TEST_ASSERT_EQUAL_UINT8(0x00, lv_canvas_get_px(canvas, 50, 50).red);
+
+    /*The next time the other buffer is rendered*/
+    layer = lv_canvas_init_layer_async(canvas);
+    TEST_ASSERT_EQUAL_PTR(front_buf, layer->draw_buf);
+    lv_draw_rect(layer, &dsc, &coords);
+    lv_canvas_finish_layer_async(canvas, layer);
+
+    /*Deleting the canvas finishes the rendering*/
+    lv_obj_delete(canvas);
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+
+    lv_draw_buf_destroy(front_buf);
+    lv_draw_buf_destroy(back_buf);
+}
+
+#endif
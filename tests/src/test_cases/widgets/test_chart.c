@@ -192,4 +192,106 @@ void test_draw_task_hooking(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_bar_draw_hook.png");
 }
 
+
+void test_chart_line_polyline(void)
+{
+    lv_obj_set_size(chart, 600, 300);
+    lv_obj_center(chart);
+    lv_chart_set_point_count(chart, 21);
+
+    lv_chart_series_t * ser1 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_chart_series_t * ser2 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, 0, 400);
+
+    int32_t points[21] = {0, 31, 59, 81, 95, 100, 95, 81, 59, 31, 0, -31, -59, -81, -95, -100, -95, -81, -59, -31, 0};
+
+    for(uint32_t i = 0; i < 21; i++) {
+        lv_chart_set_next_value(chart, ser1, points[i] + 100);
+        lv_chart_set_next_value(chart, ser2, i == 7 || i == 12 || i == 13 ? LV_CHART_POINT_NONE : points[i] * 2 + 200);
+    }
+
+    /*Draw a task for each segment first. The polylines should look the same.*/
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_line_polyline.png");
+
+    lv_obj_remove_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_line_polyline.png");
+}
+
+void test_chart_line_decimation(void)
+{
+    uint32_t cnt = 100000;
+    lv_obj_set_size(chart, 600, 300);
+    lv_obj_center(chart);
+    lv_chart_set_point_count(chart, cnt);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, -1000, 1000);
+
+    lv_chart_series_t * ser = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), 0);
+    for(uint32_t i = 0; i < cnt; i++) {
+        int32_t v = lv_trigo_sin((int16_t)((i / 100) % 360)) * 800 / LV_TRIGO_SIN_MAX;
+        /*Add some noise and a gap*/
+        if(i % 7 == 0) v += 100;
+        if(i >= 50000 && i < 52000) v = LV_CHART_POINT_NONE;
+        lv_chart_set_next_value(chart, ser, v);
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_line_decimation.png");
+
+    /*Scrolled and zoomed*/
+    lv_chart_set_zoom_x(chart, 1024);
+    lv_obj_scroll_to_x(chart, 1000, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_line_decimation_zoom.png");
+}
+
+static void stream_fill(lv_chart_series_t * ser1, lv_chart_series_t * ser2, bool rebuild_last)
+{
+    int32_t points[20] = {0, 31, 59, 81, 95, 100, 95, 81, 59, 31, 0, -31, -59, -81, -95, -100, -95, -81, -59, -31};
+
+    /*Render after each value to test the incremental drawing. Wrap around the ring buffer a few times.*/
+    uint32_t i;
+    for(i = 0; i < 90; i++) {
+        if(rebuild_last && i == 89) lv_chart_refresh(chart);
+        lv_chart_set_next_value(chart, ser1, points[i % 20]);
+        lv_chart_set_next_value(chart, ser2, i % 17 == 0 ? LV_CHART_POINT_NONE : points[(i * 3) % 20] / 2);
+        lv_refr_now(NULL);
+    }
+}
+
+void test_chart_stream(void)
+{
+    lv_obj_set_size(chart, 600, 300);
+    lv_obj_center(chart);
+    lv_chart_set_point_count(chart, 23);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_STREAM);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, -120, 120);
+
+    lv_chart_series_t * ser1 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_chart_series_t * ser2 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_RED), 0);
+
+    stream_fill(ser1, ser2, false);
+    TEST_ASSERT_NOT_NULL(ser1->stream_buf);
+    TEST_ASSERT_NOT_NULL(ser2->stream_buf);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_stream.png");
+
+    /*Without the cache the lines are drawn directly at the same place*/
+    lv_chart_refresh(chart);
+    TEST_ASSERT_NULL(ser1->stream_buf);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_stream_direct.png");
+
+    /*Drawing the same values incrementally or at once should give the same result*/
+    lv_obj_clean(active_screen);
+    chart = lv_chart_create(active_screen);
+    lv_obj_set_size(chart, 600, 300);
+    lv_obj_center(chart);
+    lv_chart_set_point_count(chart, 23);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_STREAM);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, -120, 120);
+
+    ser1 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), 0);
+    ser2 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_RED), 0);
+
+    stream_fill(ser1, ser2, true);
+    TEST_ASSERT_NOT_NULL(ser1->stream_buf);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_stream.png");
+}
 #endif
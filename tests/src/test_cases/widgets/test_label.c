@@ -610,4 +610,68 @@ void test_label_max_width(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/label_max_width.png");
 }
 
+static void check_edited_label_size(lv_obj_t * obj)
+{
+    lv_obj_update_layout(obj);
+
+    lv_label_t * label_p = (lv_label_t *)obj;
+    TEST_ASSERT_FALSE(label_p->invalid_size_cache);
+    TEST_ASSERT_NOT_NULL(label_p->lines);
+
+    lv_point_t size;
+    lv_text_get_size(&size, lv_label_get_text(obj), lv_obj_get_style_text_font(obj, LV_PART_MAIN),
+                     lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN), lv_obj_get_style_text_line_space(obj, LV_PART_MAIN),
+                     lv_obj_get_content_width(obj), LV_TEXT_FLAG_NONE);
+
+    TEST_ASSERT_EQUAL_INT32(size.x, label_p->size_cache.x);
+    TEST_ASSERT_EQUAL_INT32(size.y, label_p->size_cache.y);
+    TEST_ASSERT_EQUAL_INT32(size.y, lv_obj_get_content_height(obj));
+}
+
+void test_label_ins_cut_text_line_breaks(void)
+{
+    static const char * words[] = {"Lorem ", "ipsum", " ", "dolor, ", "\n", "sit-amet ", "(consectetur) ", ". ", "x",
+                                   "adipiscingelitadipiscingelitadipiscingelit", "\xC3\xA1rv\xC3\xADzt\xC5\xB1r\xC5\x91 "
+                                  };
+    static const uint32_t word_lengths[] = {6, 5, 1, 7, 1, 9, 14, 2, 1, 42, 10};
+    const uint32_t word_cnt = sizeof(words) / sizeof(words[0]);
+
+    lv_obj_clean(lv_screen_active());
+    lv_obj_t * obj = lv_label_create(lv_screen_active());
+    lv_obj_set_width(obj, 150);
+    lv_label_set_text(obj, long_text_multiline);
+
+    /*Edit the text randomly and compare its size with the size of the whole text*/
+    uint32_t len = lv_strlen(long_text_multiline);
+    uint32_t seed = 1;
+    uint32_t i;
+    for(i = 0; i < 400; i++) {
+        seed = seed * 1103515245 + 12345;
+        uint32_t pos = (seed >> 8) % (len + 1);
+        if(((seed >> 4) & 0x3) == 0) {
+            uint32_t cnt = LV_MIN(1 + (seed >> 20) % 12, len - pos);
+            lv_label_cut_text(obj, pos, cnt);
+            len -= cnt;
+        }
+        else {
+            uint32_t w = (seed >> 16) % word_cnt;
+            lv_label_ins_text(obj, pos, words[w]);
+            len += word_lengths[w];
+        }
+
+        check_edited_label_size(obj);
+
+        /*The line breaks are calculated again with the new width*/
+        if(i == 200) lv_obj_set_width(obj, 90);
+    }
+
+    /*Clear the text by editing*/
+    lv_label_cut_text(obj, 0, len);
+    check_edited_label_size(obj);
+    TEST_ASSERT_EQUAL_STRING("", lv_label_get_text(obj));
+
+    lv_label_ins_text(obj, LV_LABEL_POS_LAST, "a\n");
+    check_edited_label_size(obj);
+}
+
 #endif
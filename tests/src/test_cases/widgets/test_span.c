@@ -374,4 +374,68 @@ void test_spangroup_style_text_letter_space(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/span_08.png");
 }
 
+void test_spangroup_layout_is_updated_on_changes(void)
+{
+    active_screen = lv_screen_active();
+    spangroup = lv_spangroup_create(active_screen);
+    lv_spangroup_set_mode(spangroup, LV_SPAN_MODE_BREAK);
+    lv_obj_set_width(spangroup, 100);
+
+    lv_span_t * span = lv_spangroup_new_span(spangroup);
+    lv_span_set_text(span, "Short");
+    lv_obj_update_layout(spangroup);
+    int32_t h_one_line = lv_obj_get_height(spangroup);
+
+    lv_span_set_text(span, "This text is over 100 pixels width");
+    lv_obj_update_layout(spangroup);
+    int32_t h_more_lines = lv_obj_get_height(spangroup);
+    TEST_ASSERT_GREATER_THAN(h_one_line, h_more_lines);
+
+    /*Drawing reuses the same layout*/
+    lv_refr_now(NULL);
+    lv_obj_update_layout(spangroup);
+    TEST_ASSERT_EQUAL_INT32(h_more_lines, lv_obj_get_height(spangroup));
+
+    /*The text is broken again for the new width*/
+    lv_obj_set_width(spangroup, 400);
+    lv_obj_update_layout(spangroup);
+    TEST_ASSERT_EQUAL_INT32(h_one_line, lv_obj_get_height(spangroup));
+
+    /*Style changes are applied when the mode is refreshed*/
+    lv_style_set_text_font(&span->style, &lv_font_montserrat_24);
+    lv_style_set_text_color(&span->style, lv_palette_main(LV_PALETTE_RED));
+    lv_spangroup_refr_mode(spangroup);
+    lv_obj_update_layout(spangroup);
+    TEST_ASSERT_GREATER_THAN(h_one_line, lv_obj_get_height(spangroup));
+
+    lv_span_t * span_2 = lv_spangroup_new_span(spangroup);
+    lv_span_set_text(span_2, " and a second span also wraps");
+    lv_style_set_text_decor(&span_2->style, LV_TEXT_DECOR_UNDERLINE);
+    lv_spangroup_refr_mode(spangroup);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/span_09.png");
+}
+
+void test_spangroup_color_change_needs_only_invalidate(void)
+{
+    active_screen = lv_screen_active();
+    spangroup = lv_spangroup_create(active_screen);
+    lv_spangroup_set_mode(spangroup, LV_SPAN_MODE_FIXED);
+    lv_obj_set_size(spangroup, 300, 100);
+    lv_obj_center(spangroup);
+
+    lv_span_t * span = lv_spangroup_new_span(spangroup);
+    lv_span_set_text(span, "The color is changed");
+    lv_style_set_text_font(&span->style, &lv_font_montserrat_24);
+    lv_style_set_text_color(&span->style, lv_palette_main(LV_PALETTE_RED));
+    lv_refr_now(NULL);
+
+    /*The cached line breaks are kept, but the new style is used for drawing*/
+    lv_style_set_text_color(&span->style, lv_palette_main(LV_PALETTE_BLUE));
+    lv_style_set_text_decor(&span->style, LV_TEXT_DECOR_UNDERLINE);
+    lv_obj_invalidate(spangroup);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/span_10.png");
+}
+
 #endif
@@ -264,4 +264,90 @@ void test_table_should_reduce_cells_with_more_than_one_row(void)
     }
 }
 
+void test_table_large_row_count(void)
+{
+    lv_table_t * table_ptr = (lv_table_t *) table;
+    const uint32_t row_cnt = 20000;
+
+    lv_obj_set_size(table, 400, 300);
+    lv_obj_center(table);
+    lv_table_set_column_width(table, 0, 150);
+    lv_table_set_column_width(table, 1, 150);
+
+    lv_table_set_row_count(table, row_cnt);
+    uint32_t i;
+    for(i = 0; i < row_cnt; i++) {
+        lv_table_set_cell_value_fmt(table, i, 0, "Row %" LV_PRIu32, i);
+        if(i % 1000 == 999) lv_table_set_cell_value(table, i, 1, "Multi\nline text");
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(row_cnt, lv_table_get_row_count(table));
+    TEST_ASSERT_GREATER_THAN(table_ptr->row_h[0], table_ptr->row_h[999]);
+
+    int32_t h = 0;
+    for(i = 0; i < row_cnt; i++) h += table_ptr->row_h[i];
+    TEST_ASSERT_EQUAL_INT32(h - 1, lv_obj_get_self_height(table));
+
+    lv_obj_scroll_to_y(table, table_ptr->row_y[12995], LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/table_large_row_count.png");
+}
+
+static uint32_t cb_multiline_row;
+
+static const char * cell_value_cb(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table_cell_ctrl_t * ctrl)
+{
+    LV_UNUSED(obj);
+    static char buf[32];
+
+    if(col == 2) return row % 3 == 0 ? NULL : "-";
+    if(col == 0 && row % 5 == 0) *ctrl = LV_TABLE_CELL_CTRL_MERGE_RIGHT;
+
+    if(row == cb_multiline_row) lv_snprintf(buf, sizeof(buf), "%" LV_PRIu32 "\nMulti line", row);
+    else lv_snprintf(buf, sizeof(buf), "%" LV_PRIu32 ", %" LV_PRIu32, row, col);
+    return buf;
+}
+
+void test_table_cell_value_cb(void)
+{
+    lv_table_t * table_ptr = (lv_table_t *) table;
+    cb_multiline_row = 30002;
+
+    lv_obj_set_size(table, 400, 300);
+    lv_obj_center(table);
+    lv_table_set_column_count(table, 3);
+    lv_table_set_row_count(table, 50000);
+    lv_table_set_cell_value(table, 0, 0, "Stored");
+    lv_table_set_cell_value_cb(table, cell_value_cb);
+    TEST_ASSERT_EQUAL_PTR(cell_value_cb, lv_table_get_cell_value_cb(table));
+    TEST_ASSERT_NULL(table_ptr->cell_data);
+
+    TEST_ASSERT_EQUAL_STRING("12, 1", lv_table_get_cell_value(table, 12, 1));
+    TEST_ASSERT_EQUAL_STRING("", lv_table_get_cell_value(table, 12, 2));
+    TEST_ASSERT_TRUE(lv_table_has_cell_ctrl(table, 15, 0, LV_TABLE_CELL_CTRL_MERGE_RIGHT));
+    TEST_ASSERT_FALSE(lv_table_has_cell_ctrl(table, 16, 0, LV_TABLE_CELL_CTRL_MERGE_RIGHT));
+
+    /*The cells can't be set*/
+    lv_table_set_cell_value(table, 12, 1, "Ignored");
+    TEST_ASSERT_EQUAL_STRING("12, 1", lv_table_get_cell_value(table, 12, 1));
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(table_ptr->row_h[0], table_ptr->row_h[30002]);
+
+    lv_obj_scroll_to_y(table, table_ptr->row_y[30000], LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/table_cell_value_cb.png");
+
+    /*The data has changed*/
+    cb_multiline_row = 30001;
+    lv_table_refresh_rows(table, 30001, 2);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(table_ptr->row_h[0], table_ptr->row_h[30001]);
+    TEST_ASSERT_EQUAL_INT32(table_ptr->row_h[0], table_ptr->row_h[30002]);
+
+    /*Store the cells in the table again*/
+    lv_table_set_cell_value_cb(table, NULL);
+    TEST_ASSERT_EQUAL_STRING("", lv_table_get_cell_value(table, 12, 1));
+    lv_table_set_cell_value(table, 12, 1, "Stored");
+    TEST_ASSERT_EQUAL_STRING("Stored", lv_table_get_cell_value(table, 12, 1));
+}
+
 #endif
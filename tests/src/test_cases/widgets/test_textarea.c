@@ -104,4 +104,50 @@ void test_textarea_in_one_line_mode_should_ignore_line_break_characters(void)
     TEST_ASSERT_EQUAL_STRING(textarea_default_text, lv_textarea_get_text(textarea));
 }
 
+void test_textarea_edit_long_text(void)
+{
+    lv_obj_set_size(textarea, 200, 300);
+
+    /*Type a long text and delete some characters in the middle*/
+    const char * pattern = "The quick brown fox jumps over the lazy dog.\n";
+    uint32_t i;
+    for(i = 0; i < 1000; i++) {
+        lv_textarea_add_char(textarea, pattern[i % 45]);
+    }
+
+    lv_textarea_set_cursor_pos(textarea, 500);
+    for(i = 0; i < 30; i++) {
+        lv_textarea_delete_char(textarea);
+    }
+    lv_textarea_add_text(textarea, "jumps over the lazy dog again and again");
+    lv_textarea_set_cursor_pos(textarea, 10);
+    lv_textarea_delete_char_forward(textarea);
+
+    TEST_ASSERT_EQUAL_UINT32(1000 - 30 + 39 - 1, lv_strlen(lv_textarea_get_text(textarea)));
+
+    /*The edited text should have the same size as the same text set directly*/
+    lv_obj_t * textarea2 = lv_textarea_create(active_screen);
+    lv_obj_set_size(textarea2, 200, 300);
+    lv_textarea_set_text(textarea2, lv_textarea_get_text(textarea));
+
+    lv_obj_t * label = lv_textarea_get_label(textarea);
+    lv_obj_t * label2 = lv_textarea_get_label(textarea2);
+    lv_obj_update_layout(active_screen);
+    TEST_ASSERT_EQUAL_STRING(lv_label_get_text(label2), lv_label_get_text(label));
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_height(label2), lv_obj_get_height(label));
+
+    /*Type in password mode too*/
+    lv_textarea_set_text(textarea2, "");
+    lv_textarea_set_password_mode(textarea2, true);
+    for(i = 0; i < 100; i++) {
+        lv_textarea_add_char(textarea2, pattern[i % 45]);
+    }
+    lv_textarea_delete_char(textarea2);
+    lv_textarea_set_password_mode(textarea2, false);
+    TEST_ASSERT_EQUAL_UINT32(99, lv_strlen(lv_textarea_get_text(textarea2)));
+    TEST_ASSERT_EQUAL_STRING_LEN(pattern, lv_textarea_get_text(textarea2), 45);
+
+    lv_obj_delete(textarea2);
+}
+
 #endif